@@ -0,0 +1,228 @@
+"""Inverted-file (IVF) approximate nearest-neighbour index over normalised face embeddings.
+
+Embeddings are bucketed by their nearest k-means centroid. A query scores the centroids,
+then scans only the nprobe closest buckets, so its cost is roughly (nlist + nprobe * N / nlist)
+dot products instead of N. nprobe is the recall/latency knob: nlist probes is exact search.
+
+The index is saved as a directory of .npy files plus a JSON of ids and memory-mapped on
+load, so start-up does not depend on registry size. Buckets are copied out of the mapping
+the first time an insert or delete touches them.
+
+Each save goes to a new generation subdirectory (gen-<n>), written under a temporary name
+and renamed into place once complete; load opens the newest. A file that may be mapped is
+never replaced, which Windows refuses, and older generations are removed once unused.
+"""
+import json
+import os
+import re
+import shutil
+import threading
+
+import numpy as np
+
+from embedding_matcher import normalise
+
+KMEANS_ITERATIONS = 12
+KMEANS_SAMPLES_PER_LIST = 32
+RETRAIN_GROWTH = 4          # Rebuild once the registry is this many times the size trained on
+GENERATION_RE = re.compile(r'gen-(\d{6})$')
+
+
+def default_nlist(n):
+    return max(1, int(np.sqrt(n)))
+
+
+def train_centroids(rows, nlist, rng):
+    """Spherical k-means on a sample of rows; centroids stay unit length."""
+    sample = rows[rng.choice(len(rows), min(len(rows), nlist * KMEANS_SAMPLES_PER_LIST), replace=False)]
+    sample = np.asarray(sample, dtype=np.float32)
+    centroids = sample[rng.choice(len(sample), nlist, replace=False)].copy()
+    for _ in range(KMEANS_ITERATIONS):
+        assign = np.argmax(sample @ centroids.T, axis=1)
+        sums = np.zeros_like(centroids)
+        np.add.at(sums, assign, sample)
+        norms = np.linalg.norm(sums, axis=1)
+        empty = norms == 0
+        # An empty cell restarts from a random sample rather than staying dead
+        sums[empty] = sample[rng.choice(len(sample), int(empty.sum()))]
+        norms[empty] = 1
+        centroids = sums / norms[:, None]
+    return centroids.astype(np.float32)
+
+
+class IVFIndex:
+    def __init__(self, centroids, trained_size, nprobe=8):
+        self.centroids = np.ascontiguousarray(centroids, dtype=np.float32)
+        self.trained_size = trained_size
+        self.nprobe = nprobe
+        nlist, dim = self.centroids.shape
+        self.vectors = [np.empty((0, dim), dtype=np.float32) for _ in range(nlist)]
+        self.members = [[] for _ in range(nlist)]
+        self.where = {}         # id -> (list, position)
+        self.versions = {}      # id -> version it was inserted with, e.g. registration timestamp
+        self._owned = [True] * nlist
+        self._mapped = None     # Generation directory the unowned buckets are mapped from
+        self._lock = threading.Lock()
+
+    @classmethod
+    def build(cls, ids, rows, versions, nlist=None, nprobe=8, seed=0):
+        rows = np.asarray(rows, dtype=np.float32)
+        index = cls(train_centroids(rows, nlist or default_nlist(len(rows)), np.random.default_rng(seed)),
+                    len(rows), nprobe)
+        assign = np.argmax(rows @ index.centroids.T, axis=1)
+        for l in range(len(index.centroids)):
+            picked = np.flatnonzero(assign == l)
+            index.vectors[l] = rows[picked]
+            index.members[l] = [ids[i] for i in picked]
+            for pos, i in enumerate(picked):
+                index.where[ids[i]] = (l, pos)
+                index.versions[ids[i]] = versions[i]
+        return index
+
+    # Updates -------------------------------------------------------------
+
+    def add(self, student_id, embedding, version=None):
+        """Insert, or replace when the id is already present (a re-registration)."""
+        v = normalise(embedding)
+        with self._lock:
+            self._remove(student_id)
+            l = int(np.argmax(self.centroids @ v))
+            n = len(self.members[l])
+            self._writable(l, n + 1)
+            self.vectors[l][n] = v
+            self.members[l].append(student_id)
+            self.where[student_id] = (l, n)
+            self.versions[student_id] = version
+
+    def remove(self, student_id):
+        with self._lock:
+            return self._remove(student_id)
+
+    def _remove(self, student_id):
+        if student_id not in self.where:
+            return False
+        l, pos = self.where.pop(student_id)
+        del self.versions[student_id]
+        last = len(self.members[l]) - 1
+        self._writable(l, last + 1)
+        if pos != last:
+            # Swap the last member into the hole so buckets stay dense
+            moved = self.members[l][last]
+            self.vectors[l][pos] = self.vectors[l][last]
+            self.members[l][pos] = moved
+            self.where[moved] = (l, pos)
+        self.members[l].pop()
+        return True
+
+    def _writable(self, l, need):
+        vectors = self.vectors[l]
+        if self._owned[l] and len(vectors) >= need:
+            return
+        grown = np.empty((max(need, 2 * len(self.members[l]), 4), vectors.shape[1]), dtype=np.float32)
+        n = len(self.members[l])
+        grown[:n] = vectors[:n]
+        self.vectors[l] = grown
+        self._owned[l] = True
+
+    def reconcile(self, ids, rows, versions):
+        """Bring the index in line with the registry; returns how many entries changed."""
+        wanted = set(ids)
+        changed = 0
+        for student_id in [s for s in self.where if s not in wanted]:
+            changed += self.remove(student_id)
+        for i, student_id in enumerate(ids):
+            if self.versions.get(student_id, object()) != versions[i]:
+                self.add(student_id, rows[i], versions[i])
+                changed += 1
+        return changed
+
+    # Search --------------------------------------------------------------
+
+    def top_k(self, query, k=1, nprobe=None):
+        """[(student_id, score)] for the k best matches among the probed buckets, best first."""
+        q = normalise(query)
+        nprobe = min(nprobe or self.nprobe, len(self.centroids))
+        ids, scores = [], []
+        with self._lock:
+            coarse = self.centroids @ q
+            for l in np.argpartition(-coarse, nprobe - 1)[:nprobe]:
+                n = len(self.members[l])
+                if n:
+                    scores.append(self.vectors[l][:n] @ q)
+                    ids.extend(self.members[l])
+        if not ids:
+            return []
+        scores = np.concatenate(scores)
+        k = min(k, len(scores))
+        best = np.argpartition(-scores, k - 1)[:k]
+        best = best[np.argsort(-scores[best])]
+        return [(ids[i], float(scores[i])) for i in best]
+
+    def needs_retrain(self):
+        return len(self.where) > RETRAIN_GROWTH * max(self.trained_size, 1)
+
+    def __len__(self):
+        return len(self.where)
+
+    # Persistence ---------------------------------------------------------
+
+    def save(self, directory):
+        os.makedirs(directory, exist_ok=True)
+        with self._lock:
+            counts = [len(m) for m in self.members]
+            vectors = np.concatenate([self.vectors[l][:n] for l, n in enumerate(counts)])
+            ids = [s for m in self.members for s in m]
+            versions = [self.versions[s] for s in ids]
+            centroids = self.centroids
+        offsets = np.concatenate([[0], np.cumsum(counts)]).astype(np.int64)
+        generations = _generations(directory)
+        path = _generation_path(directory, generations[-1] + 1 if generations else 1)
+        shutil.rmtree(path + '.tmp', ignore_errors=True)
+        os.makedirs(path + '.tmp')
+        for name, array in (('centroids', centroids), ('offsets', offsets), ('vectors', vectors)):
+            np.save(os.path.join(path + '.tmp', name + '.npy'), array)
+        with open(os.path.join(path + '.tmp', 'index.json'), 'w', encoding='utf-8') as f:
+            json.dump({'trained_size': self.trained_size, 'ids': ids, 'versions': versions}, f)
+        os.rename(path + '.tmp', path)
+        for generation in generations:
+            stale = _generation_path(directory, generation)
+            if stale != self._mapped:
+                # Another process may still have it mapped; the next save retries
+                shutil.rmtree(stale, ignore_errors=True)
+
+    @classmethod
+    def load(cls, directory, nprobe=8):
+        generations = _generations(directory)
+        if not generations:
+            raise FileNotFoundError(f'{directory}: no saved index')
+        path = _generation_path(directory, generations[-1])
+        with open(os.path.join(path, 'index.json'), encoding='utf-8') as f:
+            meta = json.load(f)
+        centroids = np.load(os.path.join(path, 'centroids.npy'))
+        offsets = np.load(os.path.join(path, 'offsets.npy'))
+        vectors = np.load(os.path.join(path, 'vectors.npy'), mmap_mode='r')
+        if len(vectors) != len(meta['ids']) or offsets[-1] != len(vectors):
+            raise ValueError('index files out of step')
+        index = cls(centroids, meta['trained_size'], nprobe)
+        ids, versions = meta['ids'], meta['versions']
+        for l in range(len(centroids)):
+            lo, hi = int(offsets[l]), int(offsets[l + 1])
+            index.vectors[l] = vectors[lo:hi]
+            index.members[l] = ids[lo:hi]
+            index._owned[l] = False
+            for pos, student_id in enumerate(index.members[l]):
+                index.where[student_id] = (l, pos)
+        index.versions = dict(zip(ids, versions))
+        index._mapped = path
+        return index
+
+
+def _generation_path(directory, generation):
+    return os.path.join(directory, f'gen-{generation:06d}')
+
+
+def _generations(directory):
+    if not os.path.isdir(directory):
+        return []
+    found = (GENERATION_RE.match(name) for name in os.listdir(directory))
+    return sorted(int(m.group(1)) for m in found if m)
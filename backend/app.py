@@ -1,32 +1,130 @@
 from flask import Flask, request, jsonify, send_from_directory, Response
-import torch
-from facenet_pytorch import InceptionResnetV1
-from torchvision import transforms
-from PIL import Image
 import numpy as np
 import os
-import pickle
 import csv
+import atexit
+import threading
 from datetime import datetime
-import requests
+from frame_link_client import FrameLinkClient
+from embedding_matcher import EmbeddingMatcher
+from embedding_store import EmbeddingStore
+from inference_worker import InferenceWorker
+from ann_index import IVFIndex
+from camera_ingest import CameraIngest, StreamError, parse_push_batch
+from face_tracker import FaceRecognizer
+import preprocess
 
-IMG_SIZE = 160
-EMBEDDINGS_PATH = 'registered_students/embeddings.pkl'
-ESP32_CAM_URL = 'http://192.168.10.20/stream'
+EMBEDDINGS_PATH = 'registered_students/embeddings.pkl'     # Pre-store format, imported once
+EMBEDDINGS_DIR = 'registered_students/embeddings'
+ESP32_CAM_HOST = '192.168.10.20'
+MATCH_THRESHOLD = 0.7
+ANN_INDEX_DIR = 'registered_students/ann_index'
+ANN_MIN_IDENTITIES = 20000      # Below this the exact scan is already only a few milliseconds
+ANN_NPROBE = 16                 # Buckets scanned per query; raise for recall, lower for latency
+INFERENCE_MAX_BATCH = 8         # Requests the model worker runs together at most
+INFERENCE_MAX_WAIT_MS = 4       # How long the first request of a batch waits for company
+INFERENCE_THREADS = os.cpu_count() or 1
+# Cameras recognised continuously: name -> stream URL, e.g.
+# {'gate': f'http://{ESP32_CAM_HOST}/stream?fps=5'}. Empty leaves ingest off.
+CAMERAS = {}
+ACCEPT_PUSH = True              # Take frames cameras POST to /ingest (camera.c PUSH_URL)
+RECOGNITION_WORKERS = 2
 
 app = Flask(__name__)
-embedding_model = InceptionResnetV1(pretrained='vggface2').eval()
+inference = InferenceWorker(max_batch=INFERENCE_MAX_BATCH, max_wait_ms=INFERENCE_MAX_WAIT_MS,
+                            threads=INFERENCE_THREADS)
+atexit.register(inference.close)
+store = EmbeddingStore(EMBEDDINGS_DIR)
+store.import_pickle(EMBEDDINGS_PATH)
+# Shared by /detect and /attendance; kept current by /register
+matcher = EmbeddingMatcher()
+matcher.load_rows(*store.load())
 
-def preprocess_image(img):
-    preprocess = transforms.Compose([
-        transforms.Resize((IMG_SIZE, IMG_SIZE)),
-        transforms.ToTensor(),
-        transforms.Normalize([0.5, 0.5, 0.5], [0.5, 0.5, 0.5])
-    ])
-    return preprocess(img).unsqueeze(0)
+def load_ann_index():
+    """Saved IVF index brought up to date with the registry, or a fresh one; None while small."""
+    if len(matcher) < ANN_MIN_IDENTITIES:
+        return None
+    ids, info, rows = matcher.snapshot()
+    versions = [info[i].get('timestamp') for i in ids]
+    try:
+        index = IVFIndex.load(ANN_INDEX_DIR, ANN_NPROBE)
+        changed = index.reconcile(ids, rows, versions)
+        if index.needs_retrain():
+            raise ValueError('registry outgrew the index')
+    except (OSError, ValueError, KeyError):
+        index = IVFIndex.build(ids, rows, versions, nprobe=ANN_NPROBE)
+        changed = True
+    if changed:
+        index.save(ANN_INDEX_DIR)
+    return index
 
-def cosine_similarity(a, b):
-    return np.dot(a, b) / (np.linalg.norm(a) * np.linalg.norm(b))
+ann_index = load_ann_index()
+# Registrations since start-up are otherwise re-inserted from the registry on the next load
+atexit.register(lambda: ann_index and ann_index.save(ANN_INDEX_DIR))
+
+def find_best_match(embedding):
+    if ann_index is not None:
+        hits = ann_index.top_k(embedding)
+        if hits:
+            student_id, score = hits[0]
+            return student_id, matcher.info[student_id], score
+    return matcher.top_k(embedding)[0]
+
+preprocess_buffers = threading.local()
+
+def preprocess_image(source):
+    # One input buffer per request thread; embed() has copied it out by the time it returns
+    if not hasattr(preprocess_buffers, 'tensor'):
+        preprocess_buffers.tensor = np.empty((3, preprocess.IMG_SIZE, preprocess.IMG_SIZE), dtype=np.float32)
+    return preprocess.load_tensor(source, preprocess_buffers.tensor)
+
+attendance_lock = threading.Lock()
+
+def record_attendance(student_id, name, camera=None):
+    attendance_dir = 'attendance_records'
+    os.makedirs(attendance_dir, exist_ok=True)
+    csv_path = os.path.join(attendance_dir, 'attendance.csv')
+    with attendance_lock:
+        file_exists = os.path.isfile(csv_path)
+        with open(csv_path, 'a', newline='', encoding='utf-8') as csvfile:
+            writer = csv.writer(csvfile)
+            if not file_exists:
+                writer.writerow(['Student ID', 'Name', 'Timestamp'])
+            writer.writerow([student_id, name, datetime.now().strftime('%Y-%m-%d %H:%M:%S')])
+
+def embed_and_match(tensor):
+    embedding = inference.embed(tensor)
+    if not len(matcher):
+        return None, None, 0.0, False
+    student_id, info, score = find_best_match(embedding)
+    return student_id, info['name'], score, score >= MATCH_THRESHOLD
+
+ingest = CameraIngest(CAMERAS)
+# Tracks faces between frames so a person is embedded once, not every frame
+recognizer = FaceRecognizer(embed_and_match, record_attendance)
+camera_results = {}     # camera name -> live tracks of the latest frame
+
+def recognize_camera_frames():
+    while True:
+        frame = ingest.get()
+        try:
+            tracks = recognizer.process(frame.camera, frame.jpeg)
+        except Exception as e:  # Undecodable frame, model worker trouble; one frame must not stop the worker
+            camera_results[frame.camera] = {'error': f'{type(e).__name__}: {e}', 'timestamp_ms': frame.timestamp_ms}
+            continue
+        camera_results[frame.camera] = {'timestamp_ms': frame.timestamp_ms, 'tracks': [{
+            'track': t.id,
+            'box': list(t.box),
+            'student_id': t.student_id,
+            'name': t.name,
+            'score': t.score,
+        } for t in tracks if not t.missed]}
+
+if CAMERAS:
+    ingest.start()
+if CAMERAS or ACCEPT_PUSH:
+    for _ in range(RECOGNITION_WORKERS):
+        threading.Thread(target=recognize_camera_frames, daemon=True).start()
 
 @app.route('/')
 def serve_registration():
@@ -34,16 +132,49 @@ def serve_registration():
 
 @app.route('/esp32_cam_feed')
 def esp32_cam_feed():
+    # One persistent frame link; a credit goes back only after the browser took the part
     def generate():
-        while True:
-            response = requests.get(ESP32_CAM_URL, stream=True)
-            if response.status_code == 200:
-                yield (b'--frame\r\n'
-                       b'Content-Type: image/jpeg\r\n\r\n' + response.content + b'\r\n')
-            else:
-                break
+        try:
+            with FrameLinkClient(ESP32_CAM_HOST) as camera:
+                for frame in camera.frames():
+                    yield (b'--frame\r\n'
+                           b'Content-Type: image/jpeg\r\n\r\n' + frame.jpeg + b'\r\n')
+        except OSError:
+            return
     return Response(generate(), mimetype='multipart/x-mixed-replace; boundary=frame')
 
+@app.route('/cameras')
+def camera_status():
+    return jsonify({name: {
+        'connected': stats.connected,
+        'frames': stats.frames,
+        'frames_replaced': stats.replaced,
+        'reconnects': stats.reconnects,
+        'last_error': stats.last_error,
+        'pushed': stats.pushed,
+        'push_batches_refused': stats.refused,
+        'last_result': camera_results.get(name),
+    } for name, stats in ingest.stats.items()})
+
+# Frames a camera in push mode POSTs, several per request, over one keep-alive connection
+@app.route('/ingest', methods=['POST'])
+def ingest_push():
+    if not ACCEPT_PUSH:
+        return jsonify({'error': 'Push ingest is disabled'}), 404
+    camera = request.headers.get('X-Camera')
+    if not camera:
+        return jsonify({'error': 'Missing X-Camera header'}), 400
+    try:
+        parts = parse_push_batch(request.get_data(), request.headers.get('Content-Type'))
+    except (StreamError, ValueError) as e:
+        return jsonify({'error': str(e)}), 400
+    if not ingest.push(camera, parts):
+        # Recognition is behind on this camera; it drops pending frames while it waits
+        response = jsonify({'error': 'Recognition is behind, retry later'})
+        response.headers['Retry-After'] = '1'
+        return response, 429
+    return jsonify({'accepted': len(parts)})
+
 @app.route('/register', methods=['POST'])
 def register_student():
     if 'image' not in request.files or 'name' not in request.form or 'student_id' not in request.form:
@@ -66,24 +197,21 @@ def register_student():
             writer.writerow(['Student ID', 'Name', 'Image Path', 'Timestamp'])
         writer.writerow([student_id, name, img_path, timestamp])
     # Extract face embedding
-    img = Image.open(img_path).convert('RGB')
-    img_tensor = preprocess_image(img)
-    with torch.no_grad():
-        embedding = embedding_model(img_tensor).numpy()
+    img_tensor = preprocess_image(img_path)
+    embedding = inference.embed(img_tensor)
     # Save embedding with student info
-    if os.path.exists(EMBEDDINGS_PATH):
-        with open(EMBEDDINGS_PATH, 'rb') as f:
-            embeddings_db = pickle.load(f)
-    else:
-        embeddings_db = {}
-    embeddings_db[student_id] = {
+    store.put(student_id, name, img_path, timestamp, embedding)
+    matcher.add(student_id, {
         'name': name,
         'embedding': embedding,
         'image_path': img_path,
         'timestamp': timestamp
-    }
-    with open(EMBEDDINGS_PATH, 'wb') as f:
-        pickle.dump(embeddings_db, f)
+    })
+    global ann_index
+    if ann_index is not None:
+        ann_index.add(student_id, embedding, timestamp)
+    elif len(matcher) >= ANN_MIN_IDENTITIES:
+        ann_index = load_ann_index()
     return jsonify({'status': 'registered', 'student_id': student_id, 'name': name, 'image_path': img_path})
 
 @app.route('/detect', methods=['POST'])
@@ -91,30 +219,19 @@ def detect_student():
     if 'image' not in request.files:
         return jsonify({'error': 'Missing image'}), 400
     file = request.files['image']
-    img = Image.open(file.stream).convert('RGB')
-    img_tensor = preprocess_image(img)
-    with torch.no_grad():
-        query_embedding = embedding_model(img_tensor).squeeze().numpy()
-    if not os.path.exists(EMBEDDINGS_PATH):
+    img_tensor = preprocess_image(file.stream)
+    query_embedding = inference.embed(img_tensor)
+    if not len(matcher):
         return jsonify({'error': 'No registered students'}), 404
-    with open(EMBEDDINGS_PATH, 'rb') as f:
-        embeddings_db = pickle.load(f)
-    best_match = None
-    best_score = -1
-    for student_id, info in embeddings_db.items():
-        score = cosine_similarity(query_embedding, info['embedding'])
-        if score > best_score:
-            best_score = score
-            best_match = (student_id, info)
-    threshold = 0.7
-    if best_score >= threshold:
+    student_id, info, best_score = find_best_match(query_embedding)
+    if best_score >= MATCH_THRESHOLD:
         return jsonify({
             'status': 'recognized',
-            'student_id': best_match[0],
-            'name': best_match[1]['name'],
+            'student_id': student_id,
+            'name': info['name'],
             'score': float(best_score),
-            'image_path': best_match[1]['image_path'],
-            'timestamp': best_match[1]['timestamp']
+            'image_path': info['image_path'],
+            'timestamp': info['timestamp']
         })
     else:
         return jsonify({'status': 'unknown', 'score': float(best_score)})
@@ -124,35 +241,22 @@ def mark_attendance():
     if 'image' not in request.files:
         return jsonify({'error': 'Missing image file'}), 400
     file = request.files['image']
-    img = Image.open(file.stream).convert('RGB')
-    img_tensor = preprocess_image(img)
-    with torch.no_grad():
-        embedding = embedding_model(img_tensor).numpy()
-    if not os.path.exists(EMBEDDINGS_PATH):
+    img_tensor = preprocess_image(file.stream)
+    embedding = inference.embed(img_tensor)
+    if not len(matcher):
         return jsonify({'error': 'No registered students found'}), 404
-    with open(EMBEDDINGS_PATH, 'rb') as f:
-        embeddings_db = pickle.load(f)
-    best_match = None
-    best_score = -1
-    for student_id, info in embeddings_db.items():
-        score = cosine_similarity(embedding, info['embedding'])
-        if score > best_score:
-            best_match = {'student_id': student_id, 'name': info['name']}
-            best_score = score
-    threshold = 0.7
-    if best_score >= threshold:
-        attendance_dir = 'attendance_records'
-        os.makedirs(attendance_dir, exist_ok=True)
-        csv_path = os.path.join(attendance_dir, 'attendance.csv')
-        file_exists = os.path.isfile(csv_path)
-        with open(csv_path, 'a', newline='', encoding='utf-8') as csvfile:
-            writer = csv.writer(csvfile)
-            if not file_exists:
-                writer.writerow(['Student ID', 'Name', 'Timestamp'])
-            writer.writerow([best_match['student_id'], best_match['name'], datetime.now().strftime('%Y-%m-%d %H:%M:%S')])
-        return jsonify({'status': 'attendance marked', 'student_id': best_match['student_id'], 'name': best_match['name']})
+    student_id, info, best_score = find_best_match(embedding)
+    if best_score >= MATCH_THRESHOLD:
+        record_attendance(student_id, info['name'])
+        return jsonify({'status': 'attendance marked', 'student_id': student_id, 'name': info['name']})
     else:
         return jsonify({'status': 'no match found'})
 
 if __name__ == '__main__':
-    app.run(host='0.0.0.0', port=5000)
+    try:
+        # waitress keeps HTTP/1.1 connections open, so a pushing camera stays on one
+        # connection; Flask's development server closes the connection after every response
+        from waitress import serve
+        serve(app, host='0.0.0.0', port=5000, threads=8)
+    except ImportError:
+        app.run(host='0.0.0.0', port=5000, threaded=True)
@@ -0,0 +1,479 @@
+"""Backend benchmarks; each subcommand times one path against the code it replaced.
+
+    python benchmark.py match --sizes 1000 10000 100000
+    python benchmark.py ann --size 100000 --nprobe 4 8 16 32
+    python benchmark.py store --sizes 1000 10000 100000
+    python benchmark.py infer --concurrency 1 2 4 8 16
+    python benchmark.py preprocess registered_students/*.jpg
+    python benchmark.py ingest --streams 10 50 200
+    python benchmark.py track recordings/gate recordings/hall
+"""
+import argparse
+import asyncio
+import glob
+import os
+import pickle
+import random
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+
+from ann_index import IVFIndex
+from camera_ingest import STREAM_BOUNDARY, CameraIngest
+from embedding_matcher import EMBEDDING_DIM, EmbeddingMatcher, normalise
+from embedding_store import EmbeddingStore
+from face_tracker import FaceRecognizer
+from inference_worker import InferenceWorker, resolve
+import preprocess
+
+
+def timed(fn, repeat):
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        result = fn()
+        times.append(time.perf_counter() - start)
+    return np.median(times) * 1e3, result
+
+
+def make_db(n, rng):
+    vectors = rng.standard_normal((n, EMBEDDING_DIM)).astype(np.float32)
+    return {
+        f'S{i:06d}': {'name': f'Student {i}', 'embedding': vectors[i:i + 1],
+                      'image_path': f'registered_students/S{i:06d}.jpg', 'timestamp': '20250101_000000'}
+        for i in range(n)
+    }
+
+
+def legacy_match(pkl_path, query):
+    """The previous /detect path: unpickle every request, loop in Python."""
+    with open(pkl_path, 'rb') as f:
+        embeddings_db = pickle.load(f)
+    best_match, best_score = None, -1
+    for student_id, info in embeddings_db.items():
+        e = info['embedding'].reshape(-1)
+        score = np.dot(query, e) / (np.linalg.norm(query) * np.linalg.norm(e))
+        if score > best_score:
+            best_score, best_match = score, student_id
+    return best_match, float(best_score)
+
+
+def bench_match(args):
+    rng = np.random.default_rng(0)
+    print(f'{"identities":>10} {"legacy ms":>10} {"float32 ms":>11} {"int8 ms":>8} {"load ms":>8}  top-1 agree')
+    for n in args.sizes:
+        db = make_db(n, rng)
+        # Queries are noisy copies of registered embeddings, as a real re-detection would be
+        picks = rng.integers(0, n, args.queries)
+        queries = [db[f'S{i:06d}']['embedding'].reshape(-1) + 0.3 * rng.standard_normal(EMBEDDING_DIM)
+                   for i in picks]
+        with tempfile.TemporaryDirectory() as tmp:
+            pkl_path = os.path.join(tmp, 'embeddings.pkl')
+            with open(pkl_path, 'wb') as f:
+                pickle.dump(db, f)
+            EmbeddingMatcher().load_pickle(pkl_path)          # Writes the matrix cache
+
+            fp32 = EmbeddingMatcher()
+            load_ms, _ = timed(lambda: fp32.load_pickle(pkl_path), 1)
+            int8 = EmbeddingMatcher(quantize=True)
+            int8.load_pickle(pkl_path)
+
+            legacy_ms = fp32_ms = int8_ms = 0.0
+            agree = 0
+            for q in queries:
+                ms, (want, _) = timed(lambda: legacy_match(pkl_path, q), 1 if n > 10000 else args.repeat)
+                legacy_ms += ms
+                ms, got = timed(lambda: fp32.top_k(q)[0][0], args.repeat)
+                fp32_ms += ms
+                ms, got8 = timed(lambda: int8.top_k(q)[0][0], args.repeat)
+                int8_ms += ms
+                agree += (got == want) + (got8 == want)
+        k = len(queries)
+        print(f'{n:>10} {legacy_ms / k:>10.2f} {fp32_ms / k:>11.3f} {int8_ms / k:>8.3f} {load_ms:>8.1f}'
+              f'  {agree}/{2 * k}')
+
+
+def clustered_rows(n, rng, groups=256, spread=1.5):
+    """Unit rows with some group structure, as face embeddings have; uniform noise is IVF's worst case."""
+    centres = rng.standard_normal((groups, EMBEDDING_DIM)).astype(np.float32)
+    rows = centres[rng.integers(0, groups, n)] + spread * rng.standard_normal((n, EMBEDDING_DIM)).astype(np.float32)
+    return rows / np.linalg.norm(rows, axis=1, keepdims=True)
+
+
+def percentiles(ms):
+    p50, p90, p99 = np.percentile(ms, [50, 90, 99])
+    return f'{p50:>7.3f} {p90:>7.3f} {p99:>7.3f}'
+
+
+def bench_ann(args):
+    rng = np.random.default_rng(0)
+    rows = clustered_rows(args.size, rng)
+    ids = [f'S{i:06d}' for i in range(args.size)]
+    versions = ['20250101_000000'] * args.size
+    exact = EmbeddingMatcher()
+    exact.load_db({s: {'embedding': rows[i]} for i, s in enumerate(ids)})
+    # Noise of unit norm puts a re-detection near the 0.7 match threshold
+    queries = [rows[i] + rng.standard_normal(EMBEDDING_DIM) / np.sqrt(EMBEDDING_DIM)
+               for i in rng.integers(0, args.size, args.queries)]
+
+    start = time.perf_counter()
+    index = IVFIndex.build(ids, rows, versions)
+    build_s = time.perf_counter() - start
+    with tempfile.TemporaryDirectory() as tmp:
+        save_ms, _ = timed(lambda: index.save(tmp), 1)
+        load_ms, index = timed(lambda: IVFIndex.load(tmp), 3)
+    print(f'{args.size} identities, {len(index.centroids)} lists: build {build_s:.2f} s, '
+          f'save {save_ms:.0f} ms, load {load_ms:.1f} ms')
+
+    truth, exact_ms = [], []
+    for q in queries:
+        ms, hit = timed(lambda: exact.top_k(q)[0][0], 1)
+        truth.append(hit)
+        exact_ms.append(ms)
+    print(f'{"nprobe":>8} {"recall@1":>9} {"p50 ms":>7} {"p90 ms":>7} {"p99 ms":>7}')
+    print(f'{"exact":>8} {1:>9.3f} {percentiles(exact_ms)}')
+    for nprobe in args.nprobe:
+        hits, ms = 0, []
+        for q, want in zip(queries, truth):
+            t, got = timed(lambda: index.top_k(q, nprobe=nprobe), 1)
+            ms.append(t)
+            hits += bool(got) and got[0][0] == want
+        print(f'{nprobe:>8} {hits / len(queries):>9.3f} {percentiles(ms)}')
+
+    # Re-registration is a delete plus an insert into the nearest bucket
+    churn = rng.integers(0, args.size, 1000)
+    ms, _ = timed(lambda: [index.add(ids[i], normalise(rows[i]), 'v2') for i in churn], 1)
+    print(f're-register: {ms / len(churn) * 1e3:.1f} us each')
+
+
+def legacy_register(pkl_path, student_id, info):
+    """The previous /register path: read the whole pickle, add one entry, rewrite it."""
+    with open(pkl_path, 'rb') as f:
+        embeddings_db = pickle.load(f)
+    embeddings_db[student_id] = info
+    with open(pkl_path, 'wb') as f:
+        pickle.dump(embeddings_db, f)
+
+
+def bench_store(args):
+    rng = np.random.default_rng(0)
+    print(f'{"identities":>10} {"pickle reg/s":>12} {"store reg/s":>11} {"no-fsync reg/s":>14}'
+          f' {"pickle load ms":>14} {"store load ms":>13}')
+    for n in args.sizes:
+        db = make_db(n, rng)
+        extra = [(f'N{i:06d}', dict(db[f'S{i % n:06d}'])) for i in range(args.registrations)]
+        with tempfile.TemporaryDirectory() as tmp:
+            pkl_path = os.path.join(tmp, 'embeddings.pkl')
+            with open(pkl_path, 'wb') as f:
+                pickle.dump(db, f)
+            store = EmbeddingStore(os.path.join(tmp, 'store'))
+            store.import_pickle(pkl_path)
+            store.close()
+
+            legacy = extra[:max(1, min(args.registrations, 1000000 // n))]
+            ms, _ = timed(lambda: [legacy_register(pkl_path, s, info) for s, info in legacy], 1)
+            pickle_rate = len(legacy) / ms * 1e3
+            rates = []
+            for durable in (True, False):
+                # The /register path as app.py runs it: append to the store, then to the live matcher
+                store = EmbeddingStore(os.path.join(tmp, 'store'), durable=durable)
+                matcher = EmbeddingMatcher()
+                matcher.load_rows(*store.load())
+
+                def register(student_id, info):
+                    store.put(student_id, info['name'], info['image_path'], info['timestamp'], info['embedding'])
+                    matcher.add(student_id, info)
+
+                ms, _ = timed(lambda: [register(s, i) for s, i in extra], 1)
+                store.close()
+                rates.append(len(extra) / ms * 1e3)
+
+            def pickle_load():
+                with open(pkl_path, 'rb') as f:
+                    return pickle.load(f)
+
+            def store_load():
+                store = EmbeddingStore(os.path.join(tmp, 'store'))
+                ids, info, rows = store.load()
+                store.close()
+                return rows
+
+            store = EmbeddingStore(os.path.join(tmp, 'store'))
+            store.compact()     # Cold load of the steady state: a snapshot and an empty log
+            store.close()
+            pickle_ms, _ = timed(pickle_load, 3)
+            store_ms, _ = timed(store_load, 3)
+        print(f'{n:>10} {pickle_rate:>12.1f} {rates[0]:>11.1f} {rates[1]:>14.1f}'
+              f' {pickle_ms:>14.1f} {store_ms:>13.1f}')
+
+
+def facenet_eager(threads):
+    """The previous inline path: the eager facenet model, one image per call."""
+    import torch
+    from facenet_pytorch import InceptionResnetV1
+    torch.set_num_threads(threads)
+    model = InceptionResnetV1(pretrained='vggface2').eval()
+
+    def run(batch):
+        with torch.no_grad():
+            return model(torch.from_numpy(batch)).numpy()
+    return run
+
+
+def load_generator(embed, concurrency, requests):
+    """Closed loop: concurrency threads each send their next request as soon as one returns."""
+    image = np.random.default_rng(0).uniform(-1, 1, (3, 160, 160)).astype(np.float32)
+    latencies, lock = [], threading.Lock()
+
+    def client(count):
+        for _ in range(count):
+            start = time.perf_counter()
+            embed(image)
+            with lock:
+                latencies.append((time.perf_counter() - start) * 1e3)
+
+    start = time.perf_counter()
+    with ThreadPoolExecutor(concurrency) as pool:
+        list(pool.map(client, [requests // concurrency] * concurrency))
+    elapsed = time.perf_counter() - start
+    return len(latencies) / elapsed, np.percentile(latencies, 50), np.percentile(latencies, 99)
+
+
+def bench_infer(args):
+    run = resolve(args.inline_loader)(args.threads)
+    embed_inline = lambda image: run(image[None])[0]
+    worker = InferenceWorker(args.loader, args.max_batch, args.max_wait_ms, args.threads)
+    for embed in (embed_inline, worker.embed):
+        embed(np.zeros((3, 160, 160), dtype=np.float32))       # Warm up outside the timings
+    print(f'{"clients":>7} {"inline req/s":>12} {"p50 ms":>7} {"p99 ms":>7}'
+          f' {"worker req/s":>12} {"p50 ms":>7} {"p99 ms":>7} {"batch":>5}')
+    for concurrency in args.concurrency:
+        inline = load_generator(embed_inline, concurrency, args.requests)
+        batches, requests = worker.batches, worker.requests
+        batched = load_generator(worker.embed, concurrency, args.requests)
+        mean_batch = (worker.requests - requests) / max(1, worker.batches - batches)
+        print(f'{concurrency:>7} {inline[0]:>12.1f} {inline[1]:>7.1f} {inline[2]:>7.1f}'
+              f' {batched[0]:>12.1f} {batched[1]:>7.1f} {batched[2]:>7.1f} {mean_batch:>5.1f}')
+    worker.close()
+
+
+def legacy_preprocess():
+    """The previous preprocess_image path; PIL plus numpy stand-ins when torchvision is missing."""
+    from PIL import Image
+    try:
+        from torchvision import transforms
+        compose = transforms.Compose([
+            transforms.Resize((preprocess.IMG_SIZE, preprocess.IMG_SIZE)),
+            transforms.ToTensor(),
+            transforms.Normalize([0.5, 0.5, 0.5], [0.5, 0.5, 0.5])
+        ])
+        return lambda path: compose(Image.open(path).convert('RGB')).numpy()
+    except ImportError:
+        def run(path):
+            img = Image.open(path).convert('RGB').resize((preprocess.IMG_SIZE,) * 2, Image.BILINEAR)
+            tensor = np.asarray(img, dtype=np.float32).transpose(2, 0, 1) / 255
+            return (tensor - 0.5) / 0.5
+        return run
+
+
+def bench_preprocess(args):
+    paths = [p for pattern in args.images for p in glob.glob(pattern)]
+    legacy = legacy_preprocess()
+    out = np.empty((3, preprocess.IMG_SIZE, preprocess.IMG_SIZE), dtype=np.float32)
+    diffs = [np.abs(legacy(p) - preprocess.load_tensor(p, out)) for p in paths]
+    print(f'{len(paths)} images: max abs diff {max(d.max() for d in diffs):.4f}, '
+          f'mean abs diff {np.mean([d.mean() for d in diffs]):.5f} (inputs span [-1, 1])')
+    for name, fn in (('legacy', legacy), ('draft+lut', lambda p: preprocess.load_tensor(p, out))):
+        ms = [timed(lambda: fn(p), 1)[0] for _ in range(args.repeat) for p in paths]
+        print(f'{name:>10}: {np.mean(ms):.2f} ms/image mean, p50 {np.percentile(ms, 50):.2f}, '
+              f'p99 {np.percentile(ms, 99):.2f}')
+    batch = np.empty((len(paths), 3, preprocess.IMG_SIZE, preprocess.IMG_SIZE), dtype=np.float32)
+    ms, _ = timed(lambda: preprocess.load_batch(paths, batch), args.repeat)
+    print(f'{"batch":>10}: {ms / len(paths):.2f} ms/image')
+
+
+def simulate_cameras(args):
+    """Serve --count fake /stream endpoints on consecutive ports, framed like camera_server.c."""
+    if args.jpeg:
+        with open(args.jpeg, 'rb') as f:
+            jpeg = f.read()
+    else:
+        jpeg = b'\xff\xd8' + os.urandom(args.frame_bytes - 4) + b'\xff\xd9'
+
+    async def stream(reader, writer):
+        await reader.readuntil(b'\r\n\r\n')
+        writer.write(b'HTTP/1.1 200 OK\r\nContent-Type: multipart/x-mixed-replace;boundary=' +
+                     STREAM_BOUNDARY + b'\r\n\r\n--' + STREAM_BOUNDARY + b'\r\n')
+        # A flaky camera drops the connection now and then, to exercise reconnects
+        frames = random.randint(50, 300) if random.random() < args.flaky else -1
+        try:
+            while frames != 0:
+                frames -= 1
+                writer.write(b'Content-Type: image/jpeg\r\nContent-Length: %10d\r\nX-Timestamp: %13d\r\n\r\n'
+                             % (len(jpeg), time.time() * 1000) + jpeg + b'\r\n--' + STREAM_BOUNDARY + b'\r\n')
+                await writer.drain()
+                await asyncio.sleep(1 / args.fps)
+        except ConnectionError:
+            pass
+        writer.close()
+
+    async def serve():
+        for n in range(args.count):
+            await asyncio.start_server(stream, '127.0.0.1', args.port + n)
+        print('ready', flush=True)
+        await asyncio.Event().wait()
+    asyncio.run(serve())
+
+
+def bench_ingest(args):
+    print(f'{"streams":>7} {"offered/s":>9} {"ingested/s":>10} {"consumed/s":>10} {"replaced":>8}'
+          f' {"p50 ms":>7} {"p99 ms":>7} {"cpu %":>6} {"reconnects":>10}')
+    for count in args.streams:
+        cameras = subprocess.Popen(
+            [sys.executable, __file__, 'cameras', '--count', str(count), '--port', str(args.port),
+             '--fps', str(args.fps), '--frame-bytes', str(args.frame_bytes), '--flaky', str(args.flaky)],
+            stdout=subprocess.PIPE, text=True)
+        cameras.stdout.readline()
+        ingest = CameraIngest({f'cam{n}': f'http://127.0.0.1:{args.port + n}/stream' for n in range(count)})
+        latencies, consumed, running = [], [0], [True]
+
+        def consume():
+            while running[0]:
+                frame = ingest.get(timeout=0.1)
+                if frame:
+                    latencies.append(time.time() * 1000 - frame.timestamp_ms)
+                    consumed[0] += 1
+                    time.sleep(args.work_ms / 1000)     # Stand-in for recognition
+        consumer = threading.Thread(target=consume)
+        ingest.start()
+        consumer.start()
+        time.sleep(2)       # Let every stream connect before measuring
+        frames0 = sum(s.frames for s in ingest.stats.values())
+        consumed0, cpu0, wall0 = consumed[0], time.process_time(), time.perf_counter()
+        del latencies[:]
+        time.sleep(args.seconds)
+        elapsed = time.perf_counter() - wall0
+        cpu = (time.process_time() - cpu0) / elapsed * 100
+        frames = sum(s.frames for s in ingest.stats.values()) - frames0
+        eaten = consumed[0] - consumed0
+        running[0] = False
+        consumer.join()
+        ingest.stop()
+        cameras.kill()
+        cameras.wait()
+        reconnects = sum(s.reconnects for s in ingest.stats.values())
+        print(f'{count:>7} {count * args.fps:>9.0f} {frames / elapsed:>10.1f} {eaten / elapsed:>10.1f}'
+              f' {1 - eaten / max(frames, 1):>8.1%} {np.percentile(latencies, 50):>7.1f}'
+              f' {np.percentile(latencies, 99):>7.1f} {cpu:>6.1f} {reconnects:>10}')
+
+
+def synthetic_stream(images, fps, seconds, rng):
+    """Each image in turn as one person standing in view, drifting a little, then a short gap."""
+    from io import BytesIO
+    from PIL import Image
+    for path in images:
+        img = Image.open(path).convert('RGB')
+        dx = dy = 0.0
+        for _ in range(int(fps * seconds)):
+            dx, dy = dx + rng.normal(0, 1.5), dy + rng.normal(0, 1.0)
+            out = BytesIO()
+            img.transform(img.size, Image.AFFINE, (1, 0, -dx, 0, 1, -dy)).save(out, 'JPEG', quality=80)
+            yield out.getvalue()
+        for _ in range(int(fps)):
+            out = BytesIO()
+            Image.new('RGB', img.size, (90, 90, 90)).save(out, 'JPEG', quality=80)
+            yield out.getvalue()
+
+
+def bench_track(args):
+    calls = [0]
+
+    def embed_and_match(tensor):
+        calls[0] += 1
+        return 'S000001', 'Student 1', 0.8, True     # Only the number of calls matters here
+
+    recognizer = FaceRecognizer(embed_and_match, lambda *a: None)
+    streams = {}
+    for path in args.recordings:
+        streams[path] = [open(f, 'rb').read() for f in sorted(glob.glob(os.path.join(path, '*.jpg')))]
+    if args.synth:
+        streams['synthetic'] = synthetic_stream(args.synth, args.fps, args.seconds, np.random.default_rng(0))
+
+    frames_with_faces = 0
+    for camera, frames in streams.items():
+        for n, jpeg in enumerate(frames):
+            tracks = recognizer.process(camera, jpeg, now=n / args.fps)
+            frames_with_faces += any(not t.missed for t in tracks)
+    print(f'{recognizer.frames} frames, {frames_with_faces} with a face, {recognizer.faces} detections')
+    print(f'inference calls, every frame (old flow): {recognizer.frames}')
+    print(f'inference calls, every detection:        {recognizer.faces}')
+    print(f'inference calls, tracked:                {calls[0]} '
+          f'({recognizer.faces / max(calls[0], 1):.1f}x fewer than per detection)')
+    print(f'attendance rows: old flow up to {frames_with_faces}, tracked {recognizer.attendances} '
+          f'(every face matches one stand-in student, so the cooldown also merges people)')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    sub = parser.add_subparsers(dest='command', required=True)
+    match = sub.add_parser('match', help='embedding matcher against the per-request pickle loop')
+    match.add_argument('--sizes', type=int, nargs='+', default=[1000, 10000, 100000])
+    match.add_argument('--queries', type=int, default=5)
+    match.add_argument('--repeat', type=int, default=5)
+    match.set_defaults(run=bench_match)
+    ann = sub.add_parser('ann', help='IVF index recall@1 against exact search, and latency')
+    ann.add_argument('--size', type=int, default=100000)
+    ann.add_argument('--nprobe', type=int, nargs='+', default=[4, 8, 16, 32])
+    ann.add_argument('--queries', type=int, default=500)
+    ann.set_defaults(run=bench_ann)
+    store = sub.add_parser('store', help='registration rate and cold load, store against the pickle')
+    store.add_argument('--sizes', type=int, nargs='+', default=[1000, 10000, 100000])
+    store.add_argument('--registrations', type=int, default=200)
+    store.set_defaults(run=bench_store)
+    infer = sub.add_parser('infer', help='micro-batching model worker against inline inference')
+    infer.add_argument('--concurrency', type=int, nargs='+', default=[1, 2, 4, 8, 16])
+    infer.add_argument('--requests', type=int, default=256)
+    infer.add_argument('--max-batch', type=int, default=8)
+    infer.add_argument('--max-wait-ms', type=float, default=4)
+    infer.add_argument('--threads', type=int, default=os.cpu_count() or 1)
+    infer.add_argument('--loader', default='inference_worker:load_facenet')
+    infer.add_argument('--inline-loader', default='benchmark:facenet_eager')
+    infer.set_defaults(run=bench_infer)
+    prep = sub.add_parser('preprocess', help='JPEG to model input, draft decode against the old path')
+    prep.add_argument('images', nargs='+', help='JPEG files or glob patterns, e.g. camera frames')
+    prep.add_argument('--repeat', type=int, default=5)
+    prep.set_defaults(run=bench_preprocess)
+    ingest = sub.add_parser('ingest', help='multi-camera MJPEG ingest against simulated local cameras')
+    ingest.add_argument('--streams', type=int, nargs='+', default=[10, 50, 200])
+    ingest.add_argument('--seconds', type=float, default=10)
+    ingest.add_argument('--fps', type=float, default=10)
+    ingest.add_argument('--frame-bytes', type=int, default=20000)
+    ingest.add_argument('--flaky', type=float, default=0.1, help='share of connections that drop early')
+    ingest.add_argument('--work-ms', type=float, default=2, help='simulated recognition time per frame')
+    ingest.add_argument('--port', type=int, default=18000)
+    ingest.set_defaults(run=bench_ingest)
+    track = sub.add_parser('track', help='replay recorded streams; inference calls with face tracking')
+    track.add_argument('recordings', nargs='*', help='directories of one stream\'s frames as sorted .jpg files')
+    track.add_argument('--synth', nargs='+', help='or synthesise a stream, one drifting person per image')
+    track.add_argument('--fps', type=float, default=15)
+    track.add_argument('--seconds', type=float, default=5, help='per synthesised person')
+    track.set_defaults(run=bench_track)
+    cameras = sub.add_parser('cameras', help='(used by ingest) serve simulated camera streams')
+    cameras.add_argument('--count', type=int, default=10)
+    cameras.add_argument('--port', type=int, default=18000)
+    cameras.add_argument('--fps', type=float, default=10)
+    cameras.add_argument('--frame-bytes', type=int, default=20000)
+    cameras.add_argument('--flaky', type=float, default=0)
+    cameras.add_argument('--jpeg', help='serve this file as every frame instead of random bytes')
+    cameras.set_defaults(run=simulate_cameras)
+    args = parser.parse_args()
+    args.run(args)
+
+
+if __name__ == '__main__':
+    main()
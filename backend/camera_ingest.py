@@ -0,0 +1,247 @@
+"""MJPEG ingest from many cameras on one event loop.
+
+Each camera's /stream is read by a coroutine on a single asyncio loop (epoll/IOCP underneath)
+running in a background thread. Parts are framed by their Content-Length, so a JPEG is read
+in one exact-size read with no scanning for markers. Only the newest frame per camera is kept:
+a camera is queued for recognition at most once, and a frame that arrives before the previous
+one was taken simply replaces it. A dropped connection is retried with jittered exponential
+backoff.
+
+    ingest = CameraIngest({'gate': 'http://192.168.10.20/stream'})
+    ingest.start()
+    frame = ingest.get(timeout=1)
+
+Cameras in push mode (camera/main/frame_push.h) POST batches of frames instead; push() feeds
+them into the same newest-frame-per-camera queue, so get() serves both kinds alike.
+"""
+import asyncio
+import queue
+import random
+import threading
+import time
+from collections import namedtuple
+from urllib.parse import urlsplit
+
+STREAM_BOUNDARY = b'123456789000000000000987654321'    # camera_server.c STREAM_BOUNDARY
+READ_TIMEOUT_S = 10         # No bytes for this long and the connection is considered dead
+BACKOFF_MIN_S = 0.5
+BACKOFF_MAX_S = 30
+MAX_HEADER_LINES = 32
+PUSH_BACKLOG_LIMIT = 8      # Pushed frames replaced unseen before push() asks the camera to back off
+
+Frame = namedtuple('Frame', 'camera timestamp_ms received jpeg')
+
+
+class StreamError(Exception):
+    pass
+
+
+def header_int(value, name):
+    """An integer header field; StreamError rather than ValueError when it is malformed."""
+    try:
+        return int(value)
+    except ValueError:
+        raise StreamError(f'bad {name}: {value[:32]!r}') from None
+
+
+class CameraStats:
+    __slots__ = ('frames', 'replaced', 'reconnects', 'connected', 'last_error', 'pushed', 'refused')
+
+    def __init__(self, pushed=False):
+        self.frames = self.replaced = self.reconnects = 0
+        self.connected = False
+        self.last_error = None
+        self.pushed = pushed        # Frames arrive by push() rather than from a stream we read
+        self.refused = 0            # Push batches turned away because recognition was behind
+
+
+def parse_push_batch(body, content_type):
+    """[(headers, jpeg)] of one push request: multipart/mixed with a Content-Length per part.
+
+    Raises StreamError on anything malformed, including a non-numeric X-Timestamp.
+    """
+    if 'boundary=' not in (content_type or ''):
+        raise StreamError('not a multipart request')
+    delimiter = b'--' + content_type.split('boundary=', 1)[1].split(';')[0].strip().strip('"').encode()
+    parts, pos = [], 0
+    while True:
+        if not body.startswith(delimiter, pos):
+            raise StreamError('lost multipart framing')
+        pos += len(delimiter)
+        if body.startswith(b'--', pos):
+            return parts
+        head_end = body.find(b'\r\n\r\n', pos)
+        if head_end < 0:
+            raise StreamError('truncated part header')
+        headers = {}
+        for line in body[pos:head_end].split(b'\r\n'):
+            key, _, value = line.partition(b':')
+            if key:
+                headers[key.strip().lower()] = value.strip()
+        length = header_int(headers.get(b'content-length', b'-1'), 'Content-Length')
+        start = head_end + 4
+        if length <= 0 or start + length > len(body):
+            raise StreamError('bad part Content-Length')
+        if headers.get(b'x-timestamp'):
+            header_int(headers[b'x-timestamp'], 'X-Timestamp')     # Checked here, before push() takes the batch
+        parts.append((headers, body[start:start + length]))
+        pos = start + length
+        if body.startswith(b'\r\n', pos):
+            pos += 2
+
+
+class CameraIngest:
+    def __init__(self, cameras):
+        """cameras maps a name to its stream URL, e.g. http://192.168.10.20/stream?fps=5."""
+        self.cameras = dict(cameras)
+        self.stats = {name: CameraStats() for name in self.cameras}
+        self._latest = {}
+        self._queued = set()
+        self._unseen = {}           # Pushing camera -> frames replaced since one was last taken
+        self._lock = threading.Lock()
+        # One entry per camera at most; unbounded only because pushing cameras join at any time
+        self._ready = queue.Queue()
+        self._loop = None
+        self._thread = None
+
+    # Consumer side -------------------------------------------------------
+
+    def get(self, timeout=None):
+        """Newest unseen frame of whichever camera has waited longest; None on timeout."""
+        try:
+            name = self._ready.get(timeout=timeout)
+        except queue.Empty:
+            return None
+        with self._lock:
+            self._queued.discard(name)
+            self._unseen.pop(name, None)
+            return self._latest.pop(name)
+
+    def push(self, camera, parts):
+        """Take a push batch from parse_push_batch(); False if the camera should back off.
+
+        Only the newest frame of a batch reaches recognition, as with streamed cameras. A batch
+        is refused, not queued, once PUSH_BACKLOG_LIMIT pushed frames went unseen.
+        """
+        with self._lock:
+            stats = self.stats.get(camera)
+            if stats is None:
+                stats = self.stats[camera] = CameraStats(pushed=True)
+            stats.connected = True
+            if self._unseen.get(camera, 0) >= PUSH_BACKLOG_LIMIT:
+                stats.refused += 1
+                return False
+        received = time.time()
+        for headers, jpeg in parts:
+            timestamp = headers.get(b'x-timestamp')
+            self._publish(Frame(camera, header_int(timestamp, 'X-Timestamp') if timestamp else None, received, jpeg))
+        return True
+
+    def _publish(self, frame):
+        with self._lock:
+            stats = self.stats[frame.camera]
+            stats.frames += 1
+            self._latest[frame.camera] = frame
+            if frame.camera in self._queued:
+                stats.replaced += 1
+                if stats.pushed:
+                    self._unseen[frame.camera] = self._unseen.get(frame.camera, 0) + 1
+                return
+            self._queued.add(frame.camera)
+        self._ready.put_nowait(frame.camera)
+
+    # Event loop ----------------------------------------------------------
+
+    def start(self):
+        self._loop = asyncio.new_event_loop()
+        self._thread = threading.Thread(target=self._run, name='camera-ingest', daemon=True)
+        self._thread.start()
+
+    def _run(self):
+        asyncio.set_event_loop(self._loop)
+        self._tasks = [self._loop.create_task(self._camera(name, url)) for name, url in self.cameras.items()]
+        self._loop.run_forever()
+        self._loop.close()
+
+    def stop(self):
+        if self._loop:
+            asyncio.run_coroutine_threadsafe(self._shutdown(), self._loop).result()
+            self._loop.call_soon_threadsafe(self._loop.stop)
+            self._thread.join()
+            self._loop = None
+
+    async def _shutdown(self):
+        for task in self._tasks:
+            task.cancel()
+        await asyncio.gather(*self._tasks, return_exceptions=True)
+
+    async def _camera(self, name, url):
+        stats = self.stats[name]
+        failures = 0
+        while True:
+            frames_before = stats.frames
+            try:
+                await self._read_stream(name, url)
+                stats.last_error = 'closed by camera'
+            except (OSError, asyncio.TimeoutError, asyncio.IncompleteReadError, StreamError) as e:
+                stats.last_error = f'{type(e).__name__}: {e}'
+            stats.connected = False
+            stats.reconnects += 1
+            failures = 0 if stats.frames > frames_before else failures + 1
+            delay = min(BACKOFF_MAX_S, BACKOFF_MIN_S * 2 ** failures)
+            await asyncio.sleep(delay * random.uniform(0.5, 1.0))
+
+    async def _read_stream(self, name, url):
+        parts = urlsplit(url)
+        path = (parts.path or '/stream') + (f'?{parts.query}' if parts.query else '')
+        reader, writer = await asyncio.wait_for(
+            asyncio.open_connection(parts.hostname, parts.port or 80), READ_TIMEOUT_S)
+        try:
+            writer.write(f'GET {path} HTTP/1.1\r\nHost: {parts.hostname}\r\n\r\n'.encode())
+            status = await self._readline(reader)
+            if b' 200 ' not in status:
+                raise StreamError(status.decode(errors='replace').strip())
+            headers = await self._headers(reader)
+            boundary = STREAM_BOUNDARY
+            if b'boundary=' in headers.get(b'content-type', b''):
+                boundary = headers[b'content-type'].split(b'boundary=', 1)[1].strip(b'"')
+            self.stats[name].connected = True
+
+            while True:
+                line = await self._readline(reader)
+                if not line.strip():
+                    continue        # CRLF that ends the previous part
+                if line.strip() != b'--' + boundary:
+                    raise StreamError('lost multipart framing')
+                part = await self._headers(reader)
+                length = header_int(part.get(b'content-length', b'-1'), 'Content-Length')
+                if length <= 0:
+                    raise StreamError('part without Content-Length')
+                jpeg = await asyncio.wait_for(reader.readexactly(length), READ_TIMEOUT_S)
+                timestamp = part.get(b'x-timestamp')
+                timestamp = header_int(timestamp, 'X-Timestamp') if timestamp else None
+                self._publish(Frame(name, timestamp, time.time(), jpeg))
+        finally:
+            writer.close()
+
+    @staticmethod
+    async def _readline(reader):
+        try:
+            line = await asyncio.wait_for(reader.readline(), READ_TIMEOUT_S)
+        except ValueError as e:
+            # readline() reports a line longer than the reader's limit (64 KiB) as ValueError
+            raise StreamError(f'line too long: {e}') from None
+        if not line:
+            raise asyncio.IncompleteReadError(b'', None)
+        return line
+
+    async def _headers(self, reader):
+        headers = {}
+        for _ in range(MAX_HEADER_LINES):
+            line = await self._readline(reader)
+            if line in (b'\r\n', b'\n'):
+                return headers
+            key, _, value = line.partition(b':')
+            # The camera pads numeric fields with spaces so it can patch them in place
+            headers[key.strip().lower()] = value.strip()
+        raise StreamError('too many header lines')
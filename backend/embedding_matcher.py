@@ -0,0 +1,230 @@
+"""Cosine matching of a face embedding against every registered student in one pass.
+
+Embeddings are L2-normalised once and kept as a contiguous float32 matrix (or int8 with a
+per-row scale), so a query is a single matrix-vector product instead of a Python loop.
+The app loads it from EmbeddingStore (load_rows) and appends each registration with add();
+the store, not this class, is what persists registrations.
+
+load_pickle and save_cache serve benchmark.py's comparison against the old embeddings.pkl:
+they cache the matrix next to the pickle as an .npy file, memory-mapped on load and rebuilt
+when the pickle changes. Cache files are replaced, never rewritten in place, so a process
+still mapping the old matrix keeps reading valid pages.
+"""
+import json
+import os
+import pickle
+import threading
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+
+EMBEDDING_DIM = 512
+BLOCK_ROWS = 16384          # Rows per worker; numpy releases the GIL inside each block's dot
+
+
+def normalise(embedding):
+    v = np.asarray(embedding, dtype=np.float32).reshape(-1)
+    norm = np.linalg.norm(v)
+    return v / norm if norm > 0 else v
+
+
+class EmbeddingMatcher:
+    def __init__(self, quantize=False, threads=None):
+        self.quantize = quantize
+        self.ids = []
+        self.info = {}
+        self.matrix = np.empty((0, EMBEDDING_DIM), dtype=np.int8 if quantize else np.float32)
+        self.scales = np.empty(0, dtype=np.float32)
+        self._row = {}          # id -> row in matrix
+        self._buffer = self.matrix              # matrix is a view of its first len(ids) rows
+        self._scale_buffer = self.scales
+        self._owned = True      # False while matrix is the caller's array or the memory-mapped cache
+        self._lock = threading.Lock()
+        self._write_lock = threading.Lock()     # Serialises add() so concurrent registrations all land
+        threads = threads or min(8, os.cpu_count() or 1)
+        self._pool = ThreadPoolExecutor(threads) if threads > 1 else None
+
+    # Loading -------------------------------------------------------------
+
+    def load_db(self, embeddings_db):
+        """Replace the contents with an embeddings.pkl style dict."""
+        ids = list(embeddings_db)
+        rows = np.stack([normalise(embeddings_db[i]['embedding']) for i in ids]) if ids else \
+            np.empty((0, EMBEDDING_DIM), dtype=np.float32)
+        self._set(ids, {i: self._meta(embeddings_db[i]) for i in ids}, rows)
+
+    def load_rows(self, ids, info, rows):
+        """Replace the contents from embedding-free info; unit-length rows (facenet's are) are kept as given."""
+        rows = np.asarray(rows, dtype=np.float32)
+        norms = np.linalg.norm(rows, axis=1)
+        if not np.allclose(norms, 1, atol=1e-3):
+            rows = rows / np.where(norms > 0, norms, 1)[:, None]
+        self._set(list(ids), info, rows)
+
+    def load_pickle(self, pkl_path):
+        """Load from embeddings.pkl, through the memory-mapped matrix cache when it is current."""
+        matrix_path, meta_path = self._cache_paths(pkl_path)
+        if not os.path.exists(pkl_path):
+            self._set([], {}, np.empty((0, EMBEDDING_DIM), dtype=np.float32))
+            return
+        stamp = os.stat(pkl_path).st_mtime_ns
+        try:
+            with open(meta_path, encoding='utf-8') as f:
+                meta = json.load(f)
+            matrix = np.load(matrix_path, mmap_mode='r')
+            if meta['source_mtime_ns'] == stamp and matrix.shape[0] == len(meta['ids']):
+                scales = np.asarray(meta['scales'], dtype=np.float32) if self.quantize else None
+                self._install(meta['ids'], meta['info'], matrix,
+                              scales if scales is not None else np.ones(len(matrix), dtype=np.float32))
+                return
+        except (OSError, ValueError, KeyError):
+            pass
+
+        with open(pkl_path, 'rb') as f:
+            self.load_db(pickle.load(f))
+        self.save_cache(pkl_path)
+
+    def save_cache(self, pkl_path):
+        matrix_path, meta_path = self._cache_paths(pkl_path)
+        with self._lock:
+            n = len(self.matrix)
+            ids, info, matrix, scales = self.ids[:n], dict(self.info), self.matrix, self.scales
+        with open(matrix_path + '.tmp', 'wb') as f:
+            np.save(f, np.ascontiguousarray(matrix))
+        os.replace(matrix_path + '.tmp', matrix_path)
+        meta = {
+            'source_mtime_ns': os.stat(pkl_path).st_mtime_ns,
+            'ids': ids,
+            'info': info,
+            'scales': scales.tolist() if self.quantize else [],
+        }
+        with open(meta_path + '.tmp', 'w', encoding='utf-8') as f:
+            json.dump(meta, f)
+        os.replace(meta_path + '.tmp', meta_path)
+
+    def add(self, student_id, info):
+        """Add or replace one student, e.g. right after /register.
+
+        Amortised O(1): a new row goes into spare capacity, which doubles when full, and a
+        re-registration overwrites its row. The first add copies a loaded or memory-mapped
+        matrix into a buffer of its own, the way IVFIndex copies a bucket out of its mapping.
+        """
+        row, scale = self._encode(normalise(info['embedding'])[None, :])
+        with self._write_lock:
+            n = len(self.ids)
+            at = self._row.get(student_id, n)
+            self._writable(n + 1 if at == n else n)
+            self._buffer[at], self._scale_buffer[at] = row[0], scale[0]
+            with self._lock:
+                if at == n:
+                    # Readers index only the first len(their matrix) ids, so appending in place is safe
+                    self.ids.append(student_id)
+                    self._row[student_id] = n
+                    n += 1
+                self.info[student_id] = self._meta(info)
+                self.matrix, self.scales = self._buffer[:n], self._scale_buffer[:n]
+
+    # Matching ------------------------------------------------------------
+
+    def scores(self, query):
+        """Cosine similarity of query with every registered embedding, in self.ids order."""
+        _, _, matrix, scales = self._current()
+        return self._scores(normalise(query), matrix, scales)
+
+    def top_k(self, query, k=1):
+        """[(student_id, info, score)] for the k best matches, best first."""
+        # Score and index one consistent view; a concurrent add() may swap in longer ids/rows
+        ids, info, matrix, scales = self._current()
+        scores = self._scores(normalise(query), matrix, scales)
+        if len(scores) == 0:
+            return []
+        k = min(k, len(scores))
+        best = np.argpartition(-scores, k - 1)[:k]
+        best = best[np.argsort(-scores[best])]
+        return [(ids[i], info[ids[i]], float(scores[i])) for i in best]
+
+    def snapshot(self):
+        """(ids, info, float32 rows) as of now; rows may be the memory-mapped cache."""
+        with self._lock:
+            n = len(self.matrix)
+            ids, info, matrix, scales = self.ids[:n], dict(self.info), self.matrix, self.scales
+        return ids, info, self._dequantize(matrix, scales)
+
+    def __len__(self):
+        return len(self.ids)
+
+    # Internals -----------------------------------------------------------
+
+    def _current(self):
+        with self._lock:
+            return self.ids, self.info, self.matrix, self.scales
+
+    def _scores(self, q, matrix, scales):
+        n = matrix.shape[0]
+        out = np.empty(n, dtype=np.float32)
+        blocks = [(i, min(i + BLOCK_ROWS, n)) for i in range(0, n, BLOCK_ROWS)]
+
+        def run(block):
+            lo, hi = block
+            rows = matrix[lo:hi]
+            if self.quantize:
+                np.multiply(rows.astype(np.float32) @ q, scales[lo:hi], out=out[lo:hi])
+            else:
+                np.dot(rows, q, out=out[lo:hi])
+
+        if self._pool and len(blocks) > 1:
+            list(self._pool.map(run, blocks))
+        else:
+            for block in blocks:
+                run(block)
+        return out
+
+    @staticmethod
+    def _meta(info):
+        return {k: v for k, v in info.items() if k != 'embedding'}
+
+    def _cache_paths(self, pkl_path):
+        base = os.path.splitext(pkl_path)[0] + ('_matrix_i8' if self.quantize else '_matrix_f32')
+        return base + '.npy', base + '.json'
+
+    def _dequantize(self, matrix, scales):
+        if self.quantize:
+            return matrix.astype(np.float32) * scales[:, None]
+        return np.asarray(matrix, dtype=np.float32)
+
+    def _encode(self, rows):
+        """(matrix, scales) in storage form; scales are all ones unless quantizing."""
+        rows = np.ascontiguousarray(rows, dtype=np.float32)
+        if not self.quantize:
+            return rows, np.ones(len(rows), dtype=np.float32)
+        # Symmetric per-row int8: row ~= q * scale
+        peak = np.abs(rows).max(axis=1) if len(rows) else np.empty(0, dtype=np.float32)
+        scales = np.where(peak > 0, peak / 127.0, 1.0).astype(np.float32)
+        return np.round(rows / scales[:, None]).astype(np.int8), scales
+
+    def _set(self, ids, info, rows):
+        self._install(ids, info, *self._encode(rows))
+
+    def _install(self, ids, info, matrix, scales):
+        with self._write_lock, self._lock:
+            self.ids, self.info = list(ids), dict(info)
+            self._row = {student_id: i for i, student_id in enumerate(self.ids)}
+            self.matrix = self._buffer = matrix
+            self.scales = self._scale_buffer = np.asarray(scales, dtype=np.float32)
+            self._owned = False
+
+    def _writable(self, need):
+        """Make the buffers ours and at least need rows long; called under _write_lock."""
+        if self._owned and len(self._buffer) >= need:
+            return
+        n = len(self.ids)
+        capacity = max(need, 2 * n, 64)
+        grown = np.empty((capacity, EMBEDDING_DIM), dtype=self._buffer.dtype)
+        grown[:n] = self._buffer[:n]
+        grown_scales = np.ones(capacity, dtype=np.float32)
+        grown_scales[:n] = self._scale_buffer[:n]
+        # Readers keep the old buffers through their snapshot, so swapping needs only the lock
+        with self._lock:
+            self._buffer, self._scale_buffer = grown, grown_scales
+            self.matrix, self.scales = grown[:n], grown_scales[:n]
+        self._owned = True
@@ -0,0 +1,279 @@
+"""Append-only embedding store: a checksummed log of registrations plus compacted snapshots.
+
+A registration is one appended log record, so its cost does not depend on how many students
+are registered and a crash can at worst leave a torn last record, which is dropped on the
+next open. Compaction folds the log into a new snapshot in the background; re-registrations
+only keep their latest record.
+
+Files live in one directory and carry a generation number:
+
+    snapshot-<gen>.bin  64-byte header, count x dim float32 matrix, then a JSON object of
+                        columns: student_id, name, image_path, timestamp lists in row order
+    log-<gen>.bin       records appended since snapshot <gen> was taken
+
+Snapshot header, little-endian: magic "ESS1", u32 version, u32 count, u32 dim, u64 meta
+offset, u64 meta length, u32 meta crc32. Log record: magic "ESR1", u32 crc32 of everything
+after it, u16 lengths of the four strings, the UTF-8 strings, then dim float32.
+
+A snapshot is written under a temporary name and only renamed into place once complete, so
+the newest snapshot is always whole. Its matrix is memory-mapped, not read. Files are never
+replaced in place, which also keeps them usable while mapped on Windows.
+"""
+import json
+import os
+import pickle
+import re
+import struct
+import threading
+import zlib
+
+import numpy as np
+
+SNAPSHOT_MAGIC = b'ESS1'
+RECORD_MAGIC = b'ESR1'
+SNAPSHOT_VERSION = 1
+SNAPSHOT_HEADER = struct.Struct('<4sIIIQQI')
+SNAPSHOT_DATA_OFFSET = 64
+RECORD_HEADER = struct.Struct('<4sIHHHH')
+COMPACT_MIN_RECORDS = 1000      # Compact once the log holds this many records...
+COMPACT_LOG_FRACTION = 0.25     # ...and at least this fraction of the snapshot's row count
+
+FILE_RE = re.compile(r'(snapshot|log)-(\d{6})\.bin$')
+O_BINARY = getattr(os, 'O_BINARY', 0)
+
+
+class EmbeddingStore:
+    def __init__(self, directory, dim=512, durable=True):
+        self.directory = directory
+        self.dim = dim
+        self.durable = durable      # fsync every append; off only for bulk imports and benchmarks
+        self.generation = 0
+        self.snapshot_ids = []
+        self._snapshot_set = set()
+        self.snapshot_rows = np.empty((0, dim), dtype=np.float32)
+        self.info = {}              # student_id -> {'name', 'image_path', 'timestamp'}
+        self.rows = {}              # student_id -> embedding appended since the snapshot
+        self.log_records = 0
+        self._log_fd = None
+        self._lock = threading.Lock()
+        self._compact_lock = threading.Lock()
+        self._compacting = None
+        os.makedirs(directory, exist_ok=True)
+        self._open()
+
+    # Opening -------------------------------------------------------------
+
+    def _path(self, kind, generation):
+        return os.path.join(self.directory, f'{kind}-{generation:06d}.bin')
+
+    def _generations(self, kind):
+        found = (FILE_RE.match(name) for name in os.listdir(self.directory))
+        return sorted(int(m.group(2)) for m in found if m and m.group(1) == kind)
+
+    def _open(self):
+        snapshots = self._generations('snapshot')
+        if snapshots:
+            self.generation = snapshots[-1]
+            self._load_snapshot(self._path('snapshot', self.generation))
+        log = self._path('log', self.generation)
+        previous = self._path('log', self.generation - 1)
+        if not os.path.exists(log) and os.path.exists(previous):
+            # A crash between a snapshot and its log: the whole previous log becomes this one.
+            # Replaying records the snapshot already holds is harmless; the newest one wins.
+            with open(previous, 'rb') as f:
+                self._write_log(log, f.read())
+        if os.path.exists(log):
+            self.log_records = self._replay(log)
+        self._log_fd = os.open(log, os.O_WRONLY | os.O_APPEND | os.O_CREAT | O_BINARY)
+        self._remove_stale()
+
+    def _write_log(self, path, data):
+        with open(path + '.tmp', 'wb') as f:
+            f.write(data)
+            f.flush()
+            os.fsync(f.fileno())
+        os.replace(path + '.tmp', path)
+
+    def _load_snapshot(self, path):
+        with open(path, 'rb') as f:
+            magic, version, count, dim, meta_offset, meta_len, meta_crc = SNAPSHOT_HEADER.unpack(
+                f.read(SNAPSHOT_HEADER.size))
+            if magic != SNAPSHOT_MAGIC or version != SNAPSHOT_VERSION or dim != self.dim:
+                raise ValueError(f'{path}: not a {self.dim}-d embedding snapshot')
+            f.seek(meta_offset)
+            meta = f.read(meta_len)
+        if zlib.crc32(meta) != meta_crc:
+            raise ValueError(f'{path}: metadata checksum mismatch')
+        columns = json.loads(meta)
+        self.snapshot_ids = columns['student_id']
+        self._snapshot_set = set(self.snapshot_ids)
+        self.info = {student_id: {'name': name, 'image_path': image_path, 'timestamp': timestamp}
+                     for student_id, name, image_path, timestamp in zip(
+                         self.snapshot_ids, columns['name'], columns['image_path'], columns['timestamp'])}
+        if count:
+            self.snapshot_rows = np.memmap(path, dtype=np.float32, mode='r',
+                                           offset=SNAPSHOT_DATA_OFFSET, shape=(count, dim))
+
+    def _replay(self, path):
+        """Apply a log's records; a torn or corrupt tail is cut off. Returns the record count."""
+        with open(path, 'rb') as f:
+            data = f.read()
+        pos = records = 0
+        while pos + RECORD_HEADER.size <= len(data):
+            magic, crc, *lengths = RECORD_HEADER.unpack_from(data, pos)
+            end = pos + RECORD_HEADER.size + sum(lengths) + 4 * self.dim
+            if magic != RECORD_MAGIC or end > len(data) or zlib.crc32(data[pos + 8:end]) != crc:
+                break
+            fields, at = [], pos + RECORD_HEADER.size
+            for n in lengths:
+                fields.append(data[at:at + n].decode('utf-8'))
+                at += n
+            self._apply(fields, np.frombuffer(data, dtype=np.float32, count=self.dim, offset=at).copy())
+            pos, records = end, records + 1
+        if pos < len(data):
+            with open(path, 'r+b') as f:
+                f.truncate(pos)
+        return records
+
+    def _apply(self, fields, embedding):
+        student_id, name, image_path, timestamp = fields
+        self.info[student_id] = {'name': name, 'image_path': image_path, 'timestamp': timestamp}
+        self.rows[student_id] = embedding
+
+    def _remove_stale(self):
+        for kind in ('snapshot', 'log'):
+            for generation in self._generations(kind):
+                if generation < self.generation:
+                    try:
+                        os.remove(self._path(kind, generation))
+                    except OSError:
+                        pass        # Still mapped somewhere (Windows); next compaction retries
+
+    # Writing -------------------------------------------------------------
+
+    def put(self, student_id, name, image_path, timestamp, embedding):
+        """Register or re-register a student with one appended record."""
+        embedding = np.array(embedding, dtype=np.float32).reshape(-1)
+        if embedding.size != self.dim:
+            raise ValueError(f'expected a {self.dim}-d embedding, got {embedding.size}')
+        fields = [student_id, name, image_path, timestamp]
+        encoded = [str(s).encode('utf-8') for s in fields]
+        body = struct.pack('<HHHH', *map(len, encoded)) + b''.join(encoded) + embedding.tobytes()
+        record = RECORD_MAGIC + struct.pack('<I', zlib.crc32(body)) + body
+        with self._lock:
+            # One write() on an O_APPEND descriptor: records never interleave
+            os.write(self._log_fd, record)
+            if self.durable:
+                os.fsync(self._log_fd)
+            self._apply([str(s) for s in fields], embedding)
+            self.log_records += 1
+        self.maybe_compact()
+
+    def import_pickle(self, pkl_path):
+        """One-time migration from the old embeddings.pkl; skipped once the store has data."""
+        if len(self) or not os.path.exists(pkl_path):
+            return 0
+        with open(pkl_path, 'rb') as f:
+            embeddings_db = pickle.load(f)
+        durable, self.durable = self.durable, False
+        for student_id, info in embeddings_db.items():
+            self.put(student_id, info['name'], info['image_path'], info['timestamp'], info['embedding'])
+        self.durable = durable
+        self.compact()
+        return len(embeddings_db)
+
+    # Compaction ----------------------------------------------------------
+
+    def maybe_compact(self):
+        with self._lock:
+            due = self.log_records >= max(COMPACT_MIN_RECORDS,
+                                          COMPACT_LOG_FRACTION * len(self.snapshot_ids))
+            if not due or (self._compacting and self._compacting.is_alive()):
+                return
+            self._compacting = threading.Thread(target=self.compact, daemon=True)
+            self._compacting.start()
+
+    def compact(self):
+        """Write every live row to snapshot <gen + 1> and start log <gen + 1> with what came after."""
+        with self._compact_lock:
+            self._compact()
+
+    def _compact(self):
+        with self._lock:
+            ids, info, snapshot_rows, rows = self._state()
+            old_log = self._path('log', self.generation)
+            log_offset = os.lseek(self._log_fd, 0, os.SEEK_END)
+            generation = self.generation + 1
+
+        path = self._path('snapshot', generation)
+        # Columns rather than one list per row: several times quicker to parse at start-up
+        meta = json.dumps({'student_id': ids,
+                           **{key: [info[i][key] for i in ids] for key in ('name', 'image_path', 'timestamp')}}
+                          ).encode('utf-8')
+        matrix_len = 4 * self.dim * len(ids)
+        position = {s: n for n, s in enumerate(self.snapshot_ids)}
+        with open(path + '.tmp', 'wb') as f:
+            f.write(SNAPSHOT_HEADER.pack(SNAPSHOT_MAGIC, SNAPSHOT_VERSION, len(ids), self.dim,
+                                         SNAPSHOT_DATA_OFFSET + matrix_len, len(meta),
+                                         zlib.crc32(meta)).ljust(SNAPSHOT_DATA_OFFSET, b'\0'))
+            for student_id in ids:
+                row = rows.get(student_id)
+                f.write((row if row is not None else snapshot_rows[position[student_id]]).tobytes())
+            f.write(meta)
+            f.flush()
+            os.fsync(f.fileno())
+        os.replace(path + '.tmp', path)
+
+        with self._lock:
+            # Records appended while the snapshot was written move on to the new log
+            with open(old_log, 'rb') as f:
+                f.seek(log_offset)
+                tail = f.read()
+            self._write_log(self._path('log', generation), tail)
+            os.close(self._log_fd)
+            self._log_fd = os.open(self._path('log', generation), os.O_WRONLY | os.O_APPEND | O_BINARY)
+            late = {s: e for s, e in self.rows.items() if rows.get(s) is not e}
+            self.generation = generation
+            self.snapshot_ids = ids
+            self._snapshot_set = set(ids)
+            self.snapshot_rows = np.memmap(path, dtype=np.float32, mode='r', offset=SNAPSHOT_DATA_OFFSET,
+                                           shape=(len(ids), self.dim)) if ids else \
+                np.empty((0, self.dim), dtype=np.float32)
+            self.rows = late
+            self.log_records = len(late)
+        self._remove_stale()
+
+    # Reading -------------------------------------------------------------
+
+    def _state(self):
+        ids = self.snapshot_ids + [s for s in self.rows if s not in self._snapshot_set]
+        return ids, dict(self.info), self.snapshot_rows, dict(self.rows)
+
+    def load(self):
+        """(ids, info, rows) for every registered student, rows in ids order.
+
+        rows is the memory-mapped snapshot matrix itself while no registration is newer than
+        the snapshot; otherwise it is a copy with the newer rows applied.
+        """
+        with self._lock:
+            ids, info, snapshot_rows, rows = self._state()
+        if not rows:
+            return ids, info, snapshot_rows
+        matrix = np.empty((len(ids), self.dim), dtype=np.float32)
+        n = len(snapshot_rows)
+        matrix[:n] = snapshot_rows
+        for i, student_id in enumerate(ids):
+            if student_id in rows:
+                matrix[i] = rows[student_id]
+        return ids, info, matrix
+
+    def close(self):
+        if self._compacting:
+            self._compacting.join()
+        with self._lock:
+            if self._log_fd is not None:
+                os.close(self._log_fd)
+                self._log_fd = None
+
+    def __len__(self):
+        return len(self.info)
@@ -0,0 +1,199 @@
+"""Face tracks across consecutive frames, so a face is embedded once rather than every frame.
+
+Each frame's face boxes are matched to the existing tracks of that camera by IoU against
+where each track is predicted to be (its last box moved by its recent velocity). A matched
+track keeps its identity, and its confidence decays a little with every frame and more with
+every poor match. A track is sent for embedding only when it is new, when its confidence has
+decayed below REEMBED_CONFIDENCE, or, while still unknown, every UNKNOWN_RETRY_FRAMES frames.
+Attendance is emitted once per track, and at most once per student per ATTENDANCE_COOLDOWN_S
+across tracks and cameras.
+"""
+import io
+import itertools
+import math
+import threading
+import time
+
+import numpy as np
+from PIL import Image
+
+import preprocess
+
+MATCH_IOU = 0.3             # Least IoU between a predicted track box and a detection
+MAX_MISSED_FRAMES = 10      # A track not seen for this many frames ends
+CONFIDENCE_DECAY = 0.99     # Per tracked frame: about 3 s at 15 fps from a 0.8 match to re-embedding
+SOLID_IOU = 0.5             # Matches below this IoU cost confidence in proportion
+REEMBED_CONFIDENCE = 0.5
+UNKNOWN_RETRY_FRAMES = 5
+ATTENDANCE_COOLDOWN_S = 300
+VELOCITY_SMOOTHING = 0.5
+FACE_MARGIN = 0.15          # Crop context around a detection, as the camera's face chips use
+
+_track_ids = itertools.count(1)
+
+
+def iou(a, b):
+    ax, ay, aw, ah = a
+    bx, by, bw, bh = b
+    w = min(ax + aw, bx + bw) - max(ax, bx)
+    h = min(ay + ah, by + bh) - max(ay, by)
+    if w <= 0 or h <= 0:
+        return 0.0
+    inter = w * h
+    return inter / (aw * ah + bw * bh - inter)
+
+
+class Track:
+    __slots__ = ('id', 'box', 'velocity', 'missed', 'since_embed', 'confidence',
+                 'student_id', 'name', 'score', 'attended')
+
+    def __init__(self, box):
+        self.id = next(_track_ids)
+        self.box = box
+        self.velocity = (0.0, 0.0)
+        self.missed = 0
+        self.since_embed = None     # Frames since the last embedding; None before the first
+        self.confidence = 0.0
+        self.student_id = self.name = None
+        self.score = 0.0
+        self.attended = False
+
+    def predicted(self):
+        x, y, w, h = self.box
+        return (x + self.velocity[0] * (self.missed + 1), y + self.velocity[1] * (self.missed + 1), w, h)
+
+    def needs_embedding(self):
+        if self.since_embed is None:
+            return True
+        if self.student_id is None:
+            return self.since_embed >= UNKNOWN_RETRY_FRAMES
+        return self.confidence < REEMBED_CONFIDENCE
+
+
+class FaceTracker:
+    """Tracks of one camera."""
+
+    def __init__(self):
+        self.tracks = []
+
+    def update(self, boxes):
+        """Associate this frame's (x, y, w, h) boxes; returns the tracks that need an embedding."""
+        pairs = sorted(((iou(t.predicted(), b), ti, bi) for ti, t in enumerate(self.tracks)
+                        for bi, b in enumerate(boxes)), reverse=True)
+        matched_tracks, matched_boxes = set(), set()
+        for overlap, ti, bi in pairs:
+            if overlap < MATCH_IOU:
+                break
+            if ti in matched_tracks or bi in matched_boxes:
+                continue
+            matched_tracks.add(ti)
+            matched_boxes.add(bi)
+            track = self.tracks[ti]
+            (x, y, _, _), (nx, ny, _, _) = track.box, boxes[bi]
+            steps = track.missed + 1
+            track.velocity = tuple(VELOCITY_SMOOTHING * v + (1 - VELOCITY_SMOOTHING) * d / steps
+                                   for v, d in zip(track.velocity, (nx - x, ny - y)))
+            track.box = boxes[bi]
+            track.missed = 0
+            track.confidence *= CONFIDENCE_DECAY * min(1.0, overlap / SOLID_IOU)
+            if track.since_embed is not None:   # Still None if its first embedding failed
+                track.since_embed += 1
+
+        for ti, track in enumerate(self.tracks):
+            if ti not in matched_tracks:
+                track.missed += 1
+        self.tracks = [t for t in self.tracks if t.missed <= MAX_MISSED_FRAMES]
+        self.tracks += [Track(b) for bi, b in enumerate(boxes) if bi not in matched_boxes]
+        return [t for t in self.tracks if t.missed == 0 and t.needs_embedding()]
+
+    @staticmethod
+    def identify(track, student_id, name, score, recognized):
+        track.since_embed = 0
+        track.score = score
+        if recognized:
+            if student_id != track.student_id:
+                track.attended = False
+            track.student_id, track.name = student_id, name
+            track.confidence = score
+        else:
+            track.student_id = track.name = None
+            track.confidence = 0.0
+
+
+class FaceRecognizer:
+    """Face detection, tracking, embedding and attendance for frames from any number of cameras.
+
+    embed_and_match(tensor) returns (student_id, name, score, recognized) for one preprocessed
+    face; on_attendance(student_id, name, camera) is called once per attended track.
+    """
+
+    def __init__(self, embed_and_match, on_attendance, min_face=40):
+        import cv2
+        self._cv2 = cv2
+        self._cascade = cv2.CascadeClassifier(cv2.data.haarcascades + 'haarcascade_frontalface_default.xml')
+        self.embed_and_match = embed_and_match
+        self.on_attendance = on_attendance
+        self.min_face = min_face
+        self.trackers = {}
+        self.last_attended = {}     # student_id -> time of the last attendance
+        self.frames = self.faces = self.embeddings = self.attendances = 0
+        self._lock = threading.Lock()
+        self._camera_locks = {}
+        self._buffers = threading.local()
+
+    def detect(self, jpeg):
+        """Face boxes in frame pixels, detected on a half-scale grayscale decode."""
+        gray = self._cv2.imdecode(np.frombuffer(jpeg, np.uint8), self._cv2.IMREAD_REDUCED_GRAYSCALE_2)
+        if gray is None:
+            raise OSError('undecodable frame')
+        found = self._cascade.detectMultiScale(gray, scaleFactor=1.2, minNeighbors=4,
+                                               minSize=(self.min_face // 2,) * 2)
+        return [tuple(int(v) * 2 for v in box) for box in found]
+
+    def process(self, camera, jpeg, now=None):
+        """Run one frame; returns the camera's live tracks."""
+        with self._lock:
+            camera_lock = self._camera_locks.setdefault(camera, threading.Lock())
+            tracker = self.trackers.setdefault(camera, FaceTracker())
+        # Frames of one camera go through its tracker in order, even with several workers
+        with camera_lock:
+            return self._process(camera, tracker, jpeg, time.time() if now is None else now)
+
+    def _process(self, camera, tracker, jpeg, now):
+        boxes = self.detect(jpeg)
+        pending = tracker.update(boxes)
+        with self._lock:
+            self.frames += 1
+            self.faces += len(boxes)
+        if pending:
+            img = Image.open(io.BytesIO(jpeg))
+            frame_w, frame_h = img.size
+            # libjpeg can only scale the whole frame, by 1/2, 1/4 or 1/8 as it decodes: take the
+            # smallest decode that still leaves every face crop IMG_SIZE across. Only the crops
+            # are converted to RGB.
+            side = min(min(w, h) * (1 + 2 * FACE_MARGIN) for _, _, w, h in (t.box for t in pending))
+            img.draft('RGB', (math.ceil(frame_w * preprocess.IMG_SIZE / side),
+                              math.ceil(frame_h * preprocess.IMG_SIZE / side)))
+            scale = img.width / frame_w
+            if not hasattr(self._buffers, 'tensor'):
+                self._buffers.tensor = np.empty((3, preprocess.IMG_SIZE, preprocess.IMG_SIZE), dtype=np.float32)
+            for track in pending:
+                x, y, w, h = track.box
+                m = int(FACE_MARGIN * max(w, h))
+                box = (max(0, x - m), max(0, y - m), min(frame_w, x + w + m), min(frame_h, y + h + m))
+                crop = img.crop(tuple(round(v * scale) for v in box)).convert('RGB')
+                FaceTracker.identify(track, *self.embed_and_match(
+                    preprocess.crop_tensor(crop, (0, 0, crop.width, crop.height), self._buffers.tensor)))
+                with self._lock:
+                    self.embeddings += 1
+        with self._lock:
+            for track in tracker.tracks:
+                if track.student_id is None or track.attended or track.missed:
+                    continue
+                track.attended = True
+                if now - self.last_attended.get(track.student_id, -ATTENDANCE_COOLDOWN_S) < ATTENDANCE_COOLDOWN_S:
+                    continue
+                self.last_attended[track.student_id] = now
+                self.attendances += 1
+                self.on_attendance(track.student_id, track.name, camera)
+            return list(tracker.tracks)
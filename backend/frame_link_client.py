@@ -0,0 +1,111 @@
+"""Reference client for the camera's frame link (camera/main/frame_link.h).
+
+The camera sends one length-prefixed JPEG per credit, always the newest frame. Granting the
+next credit only after a frame has been handled keeps the camera from queueing stale frames.
+
+    python frame_link_client.py 192.168.10.20 --seconds 10
+    python frame_link_client.py 192.168.10.20 --compare-stream http://192.168.10.20/stream
+"""
+import argparse
+import socket
+import struct
+import time
+from collections import namedtuple
+
+FRAME_LINK_PORT = 81
+FRAME_MAGIC = 0x314B4C46    # "FLK1"
+CREDIT_MAGIC = 0x31434C46   # "FLC1"
+HEADER = struct.Struct('<IIQIHHBBHI')
+CREDIT = struct.Struct('<II')
+FLAG_CHANGED = 0x01
+
+Frame = namedtuple('Frame', 'seq timestamp_us width height changed change_score skipped jpeg')
+
+
+class FrameLinkClient:
+    def __init__(self, host, port=FRAME_LINK_PORT, credits=1, timeout=10):
+        self.sock = socket.create_connection((host, port), timeout=timeout)
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self._grant(credits)
+
+    def _grant(self, credits):
+        self.sock.sendall(CREDIT.pack(CREDIT_MAGIC, credits))
+
+    def _recv_exact(self, n):
+        buf = bytearray(n)
+        view = memoryview(buf)
+        while n:
+            got = self.sock.recv_into(view[-n:], n)
+            if not got:
+                raise ConnectionError('frame link closed')
+            n -= got
+        return buf
+
+    def frames(self):
+        """Yield frames; the next credit is granted when the consumer asks for the next frame."""
+        while True:
+            magic, seq, ts, length, width, height, fmt, flags, score, skipped = HEADER.unpack(
+                self._recv_exact(HEADER.size))
+            if magic != FRAME_MAGIC:
+                raise ConnectionError('bad frame header')
+            jpeg = bytes(self._recv_exact(length))
+            yield Frame(seq, ts, width, height, bool(flags & FLAG_CHANGED), score, skipped, jpeg)
+            self._grant(1)
+
+    def close(self):
+        self.sock.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+
+def iter_stream_jpegs(url, timeout=10):
+    """JPEG parts of a /stream response, read the way an MJPEG consumer has to."""
+    import requests
+    with requests.get(url, stream=True, timeout=timeout) as response:
+        buf = b''
+        for chunk in response.iter_content(chunk_size=16384):
+            buf += chunk
+            while True:
+                start = buf.find(b'\xff\xd8')
+                end = buf.find(b'\xff\xd9', start + 2)
+                if start < 0 or end < 0:
+                    break
+                yield buf[start:end + 2]
+                buf = buf[end + 2:]
+
+
+def measure(frames, seconds):
+    count = size = 0
+    start = time.perf_counter()
+    for jpeg in frames:
+        count += 1
+        size += len(jpeg)
+        if time.perf_counter() - start >= seconds:
+            break
+    elapsed = time.perf_counter() - start
+    return count / elapsed, size / elapsed / 1e6
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Frame link throughput, optionally against /stream')
+    parser.add_argument('host')
+    parser.add_argument('--port', type=int, default=FRAME_LINK_PORT)
+    parser.add_argument('--credits', type=int, default=1)
+    parser.add_argument('--seconds', type=float, default=10)
+    parser.add_argument('--compare-stream', metavar='URL')
+    args = parser.parse_args()
+
+    with FrameLinkClient(args.host, args.port, args.credits) as client:
+        fps, mbps = measure((f.jpeg for f in client.frames()), args.seconds)
+    print(f'frame link: {fps:.1f} fps, {mbps:.2f} MB/s')
+    if args.compare_stream:
+        fps, mbps = measure(iter_stream_jpegs(args.compare_stream), args.seconds)
+        print(f'/stream:    {fps:.1f} fps, {mbps:.2f} MB/s')
+
+
+if __name__ == '__main__':
+    main()
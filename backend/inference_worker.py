@@ -0,0 +1,274 @@
+"""Embedding model in its own process, fed with micro-batches.
+
+Flask request threads call InferenceWorker.embed() with a preprocessed 3x160x160 image. The
+requests travel over a local multiprocessing connection to a worker process, which takes the
+first waiting request, keeps collecting until it has max_batch of them or max_wait_ms has
+passed, and runs them through the model as one batch on its own intra-op thread pool. The
+Flask process never runs the model itself, so requests no longer contend for the GIL.
+
+If the worker process dies, the requests it held fail and the next embed() starts a new one,
+waiting RESPAWN_BACKOFF_MIN_S, doubling to RESPAWN_BACKOFF_MAX_S, between attempts while
+the worker keeps dying before it returns a batch.
+
+The worker loads facenet's InceptionResnetV1 as TorchScript, tracing and saving it on first
+use, so later starts skip building the Python model. It can also be run by hand:
+
+    python inference_worker.py --address 127.0.0.1:6001 --max-batch 8 --max-wait-ms 4
+"""
+import argparse
+import importlib
+import itertools
+import os
+import queue
+import socket
+import subprocess
+import sys
+import threading
+import time
+from concurrent.futures import Future
+from multiprocessing import AuthenticationError
+from multiprocessing.connection import Client, Listener
+
+import numpy as np
+
+TORCHSCRIPT_PATH = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'models',
+                                'inception_resnet_v1_vggface2.pt')
+INPUT_SHAPE = (1, 3, 160, 160)
+AUTHKEY_ENV = 'INFERENCE_WORKER_AUTHKEY'
+RESPAWN_BACKOFF_MIN_S = 1
+RESPAWN_BACKOFF_MAX_S = 60
+
+
+def load_facenet(threads):
+    """Batch (B, 3, 160, 160) float32 -> (B, 512) embeddings, via TorchScript."""
+    import torch
+    torch.set_num_threads(threads)
+    if os.path.exists(TORCHSCRIPT_PATH):
+        model = torch.jit.load(TORCHSCRIPT_PATH)
+    else:
+        from facenet_pytorch import InceptionResnetV1
+        model = torch.jit.trace(InceptionResnetV1(pretrained='vggface2').eval(), torch.zeros(INPUT_SHAPE))
+        os.makedirs(os.path.dirname(TORCHSCRIPT_PATH), exist_ok=True)
+        model.save(TORCHSCRIPT_PATH)
+    model = torch.jit.freeze(model.eval())
+
+    def run(batch):
+        with torch.inference_mode():
+            return model(torch.from_numpy(batch)).numpy()
+    return run
+
+
+# Worker process ----------------------------------------------------------
+
+def serve(conn, run, max_batch, max_wait):
+    """Collect requests into batches until the connection closes."""
+    inbox = queue.Queue()
+
+    def receive():
+        try:
+            while True:
+                inbox.put(conn.recv())
+        except (EOFError, OSError):
+            inbox.put(None)
+    threading.Thread(target=receive, daemon=True).start()
+
+    while True:
+        item = inbox.get()
+        if item is None:
+            return
+        batch = [item]
+        deadline = time.monotonic() + max_wait
+        while len(batch) < max_batch:
+            try:
+                item = inbox.get(timeout=max(0.0, deadline - time.monotonic()))
+            except queue.Empty:
+                break
+            if item is None:
+                inbox.put(None)
+                break
+            batch.append(item)
+        ids = [request_id for request_id, _ in batch]
+        try:
+            out = run(np.stack([array for _, array in batch]))
+            conn.send((ids, np.ascontiguousarray(out, dtype=np.float32), None))
+        except Exception as e:      # Fails this batch only; the worker keeps serving
+            conn.send((ids, None, f'{type(e).__name__}: {e}'))
+
+
+def resolve(spec):
+    module, _, name = spec.partition(':')
+    return getattr(importlib.import_module(module), name)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Micro-batching embedding model worker')
+    parser.add_argument('--address', required=True, help='host:port of the InferenceWorker listener')
+    parser.add_argument('--loader', default='inference_worker:load_facenet')
+    parser.add_argument('--max-batch', type=int, default=8)
+    parser.add_argument('--max-wait-ms', type=float, default=4)
+    parser.add_argument('--threads', type=int, default=os.cpu_count() or 1)
+    args = parser.parse_args()
+
+    run = resolve(args.loader)(args.threads)
+    host, port = args.address.rsplit(':', 1)
+    conn = Client((host, int(port)), authkey=os.environ[AUTHKEY_ENV].encode())
+    serve(conn, run, args.max_batch, args.max_wait_ms / 1000)
+
+
+# Flask side ---------------------------------------------------------------
+
+def hang_up(conn):
+    """Close conn so the worker sees EOF. close() alone leaves the socket open while the
+    collector thread is blocked reading it, and the worker waits on a connection nobody uses."""
+    try:
+        with socket.fromfd(conn.fileno(), socket.AF_INET, socket.SOCK_STREAM) as s:
+            s.shutdown(socket.SHUT_RDWR)
+    except OSError:
+        pass
+    conn.close()
+
+
+class InferenceWorker:
+    def __init__(self, loader='inference_worker:load_facenet', max_batch=8, max_wait_ms=4,
+                 threads=None, start_timeout=300):
+        authkey = os.urandom(16).hex()
+        self._listener = Listener(('127.0.0.1', 0), authkey=authkey.encode())
+        host, port = self._listener.address
+        self._env = dict(os.environ, **{AUTHKEY_ENV: authkey})
+        here = os.path.dirname(os.path.abspath(__file__))
+        self._env['PYTHONPATH'] = os.pathsep.join(filter(None, [here, self._env.get('PYTHONPATH')]))
+        self._command = [sys.executable, os.path.join(here, 'inference_worker.py'), '--address', f'{host}:{port}',
+                         '--loader', loader, '--max-batch', str(max_batch), '--max-wait-ms', str(max_wait_ms),
+                         '--threads', str(threads or os.cpu_count() or 1)]
+        self._start_timeout = start_timeout
+        self._accepted = queue.Queue()
+        threading.Thread(target=self._accept_loop, daemon=True).start()
+        self._send_lock = threading.Lock()     # Also guards _conn, _process and the respawn state
+        self._pending = {}                      # request id -> (connection it was sent on, future)
+        self._pending_lock = threading.Lock()
+        self._ids = itertools.count()
+        self._conn = None
+        self._failures = 0                      # Worker deaths since one last returned a batch
+        self._retry_at = 0.0
+        self._closed = False
+        self.batches = self.requests = self.restarts = 0
+        with self._send_lock:
+            self._start()
+
+    def _accept_loop(self):
+        # Listener.accept() cannot time out, so one thread accepts for every worker started
+        while True:
+            try:
+                self._accepted.put(self._listener.accept())
+            except OSError:
+                return          # Listener closed
+            except AuthenticationError:
+                continue
+
+    def _start(self):
+        """Spawn a worker and wait for it to connect; called with _send_lock held."""
+        while not self._accepted.empty():
+            self._accepted.get_nowait().close()     # From a worker given up on while starting
+        self._process = subprocess.Popen(self._command, env=self._env)
+        deadline = time.monotonic() + self._start_timeout
+        while True:
+            try:
+                conn = self._accepted.get(timeout=0.1)
+                break
+            except queue.Empty:
+                pass
+            if self._process.poll() is not None or time.monotonic() > deadline:
+                self._process.kill()
+                self._process.wait()
+                raise RuntimeError('inference worker failed to start')
+        self._conn = conn
+        threading.Thread(target=self._collect, args=(conn,), daemon=True).start()
+
+    def _respawn(self):
+        wait = self._retry_at - time.monotonic()
+        if wait > 0:
+            raise RuntimeError(f'inference worker exited; restarting in {wait:.1f} s')
+        self.restarts += 1
+        try:
+            self._start()
+        except RuntimeError:
+            self._back_off()
+            raise
+
+    def _back_off(self):
+        self._failures += 1
+        delay = min(RESPAWN_BACKOFF_MAX_S, RESPAWN_BACKOFF_MIN_S * 2 ** (self._failures - 1))
+        self._retry_at = time.monotonic() + delay
+
+    def _lost(self, conn):
+        """Forget a dead worker so the next embed() starts another; called with _send_lock held."""
+        if self._conn is not conn:
+            return
+        self._conn = None
+        hang_up(conn)
+        if self._process.poll() is None:
+            self._process.kill()
+        self._process.wait()
+        self._back_off()
+
+    def embed(self, image, timeout=30):
+        """512-d embedding of one preprocessed (3, 160, 160) float32 image."""
+        image = np.ascontiguousarray(image, dtype=np.float32).reshape(INPUT_SHAPE[1:])
+        future = Future()
+        request_id = next(self._ids)
+        with self._send_lock:
+            if self._closed:
+                raise RuntimeError('inference worker is closed')
+            if self._conn is None:
+                self._respawn()
+            conn = self._conn
+            with self._pending_lock:
+                self._pending[request_id] = (conn, future)
+            try:
+                conn.send((request_id, image))
+            except OSError:
+                with self._pending_lock:
+                    self._pending.pop(request_id, None)
+                self._lost(conn)
+                raise RuntimeError('inference worker is gone')
+        return future.result(timeout)
+
+    def _collect(self, conn):
+        try:
+            while True:
+                ids, out, error = conn.recv()
+                self._failures = 0
+                self.batches += 1
+                self.requests += len(ids)
+                with self._pending_lock:
+                    futures = [self._pending.pop(i)[1] for i in ids]
+                for n, future in enumerate(futures):
+                    if error:
+                        future.set_exception(RuntimeError(error))
+                    else:
+                        future.set_result(out[n])
+        except (EOFError, OSError):
+            with self._send_lock:
+                self._lost(conn)
+            # Only the requests this worker held; any sent to a replacement carry on
+            with self._pending_lock:
+                lost = [i for i, (sent_on, _) in self._pending.items() if sent_on is conn]
+                futures = [self._pending.pop(i)[1] for i in lost]
+            for future in futures:
+                future.set_exception(RuntimeError('inference worker exited'))
+
+    def close(self):
+        with self._send_lock:
+            self._closed = True
+            conn, self._conn = self._conn, None
+        if conn:
+            hang_up(conn)
+        self._listener.close()
+        try:
+            self._process.wait(5)
+        except subprocess.TimeoutExpired:
+            self._process.kill()
+
+
+if __name__ == '__main__':
+    main()
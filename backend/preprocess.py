@@ -0,0 +1,46 @@
+"""JPEG to model input in as few passes as PIL allows.
+
+Image.draft() makes libjpeg decode straight to 1/2, 1/4 or 1/8 scale in the DCT domain,
+picking the smallest scale that still covers the target, so a 640x480 camera frame is decoded
+at 320x240 rather than decoded in full and then thrown away by the resize. The resize to
+160x160 is PIL's bilinear, as transforms.Resize uses on PIL images. ToTensor and
+Normalize([0.5] * 3, [0.5] * 3) become one table lookup from the uint8 pixels straight into
+a caller-provided float32 CHW buffer.
+"""
+import numpy as np
+from PIL import Image
+
+IMG_SIZE = 160
+
+# (v / 255 - 0.5) / 0.5 for every byte value, computed the way ToTensor + Normalize do
+NORMALISE_LUT = ((np.arange(256, dtype=np.float32) / 255 - 0.5) / 0.5).astype(np.float32)
+
+
+def load_tensor(source, out=None, size=IMG_SIZE):
+    """Decode a JPEG (path or file object) into out, a (3, size, size) float32 array."""
+    if out is None:
+        out = np.empty((3, size, size), dtype=np.float32)
+    img = Image.open(source)
+    img.draft('RGB', (size, size))
+    img = img.convert('RGB').resize((size, size), Image.BILINEAR)
+    np.take(NORMALISE_LUT, np.asarray(img).transpose(2, 0, 1), out=out)
+    return out
+
+
+def crop_tensor(img, box, out=None, size=IMG_SIZE):
+    """The (x, y, w, h) region of an RGB PIL image as model input, like load_tensor()."""
+    if out is None:
+        out = np.empty((3, size, size), dtype=np.float32)
+    x, y, w, h = box
+    crop = img.resize((size, size), Image.BILINEAR, box=(x, y, x + w, y + h))
+    np.take(NORMALISE_LUT, np.asarray(crop).transpose(2, 0, 1), out=out)
+    return out
+
+
+def load_batch(sources, out=None, size=IMG_SIZE):
+    """load_tensor() for several images into one (N, 3, size, size) buffer."""
+    if out is None:
+        out = np.empty((len(sources), 3, size, size), dtype=np.float32)
+    for n, source in enumerate(sources):
+        load_tensor(source, out[n], size)
+    return out[:len(sources)]
@@ -0,0 +1,239 @@
+// Accuracy and cost of the /faces pipeline (face_roi.c) on a labelled image set.
+//
+//   face_bench <labels.csv> [-n iterations] [-u min_iou]
+//
+// labels.csv has one line per face, "image,x,y,w,h" in frame pixels, with image paths
+// relative to the CSV. An image without faces is listed with its name alone. A detection
+// counts as correct when its IoU with an unmatched label reaches min_iou (default 0.5).
+
+#include <libgen.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "esp_timer.h"
+#include "face_roi.h"
+
+#define MAX_LABELS  16
+
+typedef struct {
+    char *name;
+    face_box_t labels[MAX_LABELS];
+    int label_count;
+} bench_image_t;
+
+static uint8_t *read_file(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *buf = malloc(*len);
+    if (buf && fread(buf, 1, *len, f) != *len) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    return buf;
+}
+
+// Read width and height from the first SOFn marker
+static void jpeg_dimensions(const uint8_t *buf, size_t len, uint16_t *width, uint16_t *height) {
+    size_t i = 2;
+    *width = *height = 0;
+    while (i + 9 < len) {
+        if (buf[i] != 0xFF) {
+            i++;
+            continue;
+        }
+        uint8_t marker = buf[i + 1];
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+            *height = (uint16_t)((buf[i + 5] << 8) | buf[i + 6]);
+            *width = (uint16_t)((buf[i + 7] << 8) | buf[i + 8]);
+            return;
+        }
+        i += 2 + ((buf[i + 2] << 8) | buf[i + 3]);
+    }
+}
+
+static float iou(const face_box_t *a, const face_box_t *b) {
+    int x0 = a->x > b->x ? a->x : b->x;
+    int y0 = a->y > b->y ? a->y : b->y;
+    int x1 = a->x + a->w < b->x + b->w ? a->x + a->w : b->x + b->w;
+    int y1 = a->y + a->h < b->y + b->h ? a->y + a->h : b->y + b->h;
+    if (x1 <= x0 || y1 <= y0) {
+        return 0;
+    }
+    float inter = (float)(x1 - x0) * (y1 - y0);
+    return inter / ((float)a->w * a->h + (float)b->w * b->h - inter);
+}
+
+static size_t load_labels(const char *csv, bench_image_t **out) {
+    *out = NULL;
+    FILE *f = fopen(csv, "r");
+    if (!f) {
+        perror(csv);
+        return 0;
+    }
+    bench_image_t *images = NULL;
+    size_t count = 0;
+    char line[1024];
+    while (fgets(line, sizeof(line), f)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        char *name = strtok(line, ",");
+        if (!name || strcmp(name, "image") == 0) {
+            continue;
+        }
+        if (count == 0 || strcmp(images[count - 1].name, name) != 0) {
+            images = realloc(images, (count + 1) * sizeof(*images));
+            images[count].name = strdup(name);
+            images[count].label_count = 0;
+            count++;
+        }
+        char *fields[4];
+        int n = 0;
+        while (n < 4 && (fields[n] = strtok(NULL, ",")) != NULL) {
+            n++;
+        }
+        bench_image_t *img = &images[count - 1];
+        if (n == 4 && img->label_count < MAX_LABELS) {
+            face_box_t *b = &img->labels[img->label_count++];
+            b->x = atoi(fields[0]);
+            b->y = atoi(fields[1]);
+            b->w = atoi(fields[2]);
+            b->h = atoi(fields[3]);
+        }
+    }
+    fclose(f);
+    *out = images;
+    return count;
+}
+
+static int compare_doubles(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv) {
+    int iterations = 5;
+    float min_iou = 0.5f;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:u:")) != -1) {
+        if (opt == 'n') {
+            iterations = atoi(optarg) > 0 ? atoi(optarg) : 1;
+        } else if (opt == 'u') {
+            min_iou = atof(optarg);
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s <labels.csv> [-n iterations] [-u min_iou]\n", argv[0]);
+        return 2;
+    }
+
+    bench_image_t *images = NULL;
+    size_t count = load_labels(argv[optind], &images);
+    char *csv_copy = strdup(argv[optind]);
+    const char *dir = dirname(csv_copy);
+    double *detect_us = calloc(count ? count : 1, sizeof(double));
+    int labels = 0, detections = 0, correct = 0;
+    double frame_bytes = 0, chip_bytes = 0, extract_total_us = 0;
+    size_t timed = 0, extracted = 0;
+
+    printf("%-32s %6s %6s %6s %10s %11s %9s\n", "image", "faces", "found", "match", "detect_us", "extract_us", "chip_kb");
+    for (size_t i = 0; i < count; i++) {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s", dir, images[i].name);
+        size_t len;
+        uint8_t *jpg = read_file(path, &len);
+        uint16_t width, height;
+        if (!jpg) {
+            printf("%-32s  unreadable\n", images[i].name);
+            continue;
+        }
+        jpeg_dimensions(jpg, len, &width, &height);
+
+        face_box_t found[FACE_CHIP_MAX];
+        int n = 0;
+        int64_t start = esp_timer_get_time();
+        for (int k = 0; k < iterations && n >= 0; k++) {
+            n = face_roi_detect(jpg, len, width, height, found, FACE_CHIP_MAX);
+        }
+        double us = (esp_timer_get_time() - start) / (double)iterations;
+        if (n < 0) {
+            printf("%-32s  decode error\n", images[i].name);
+            free(jpg);
+            continue;
+        }
+        detect_us[timed++] = us;
+
+        // Greedy matching, largest detection first
+        int used[MAX_LABELS] = { 0 };
+        int matched = 0;
+        for (int d = 0; d < n; d++) {
+            int best = -1;
+            float best_iou = min_iou;
+            for (int l = 0; l < images[i].label_count; l++) {
+                float v = iou(&found[d], &images[i].labels[l]);
+                if (!used[l] && v >= best_iou) {
+                    best = l;
+                    best_iou = v;
+                }
+            }
+            if (best >= 0) {
+                used[best] = 1;
+                matched++;
+            }
+        }
+        labels += images[i].label_count;
+        detections += n;
+        correct += matched;
+
+        double extract_us = 0;
+        size_t chips_len = 0;
+        if (n > 0) {
+            face_chip_t chips[FACE_CHIP_MAX];
+            start = esp_timer_get_time();
+            int c = face_roi_extract(jpg, len, width, height, chips, FACE_CHIP_MAX);
+            extract_us = (double)(esp_timer_get_time() - start);
+            for (int k = 0; k < c; k++) {
+                chips_len += chips[k].len;
+            }
+            face_roi_free(chips, c > 0 ? c : 0);
+            if (c > 0) {
+                frame_bytes += len;
+                chip_bytes += chips_len;
+                extract_total_us += extract_us;
+                extracted++;
+            }
+        }
+        printf("%-32s %6d %6d %6d %10.0f %11.0f %9.1f\n", images[i].name, images[i].label_count, n, matched,
+               us, extract_us, chips_len / 1024.0);
+        free(jpg);
+    }
+
+    if (timed) {
+        qsort(detect_us, timed, sizeof(double), compare_doubles);
+        double sum = 0;
+        for (size_t i = 0; i < timed; i++) {
+            sum += detect_us[i];
+        }
+        printf("\n%zu frames, %d labelled faces, %d detections (IoU >= %.2f)\n", timed, labels, detections, min_iou);
+        printf("recall %.3f  precision %.3f\n",
+               labels ? (double)correct / labels : 0.0, detections ? (double)correct / detections : 0.0);
+        printf("detect us/frame: mean %.0f  p50 %.0f  max %.0f\n", sum / timed, detect_us[timed / 2], detect_us[timed - 1]);
+    }
+    if (extracted) {
+        printf("extract us/frame with faces: mean %.0f; chips are %.1f%% of the frame bytes (%.1fx smaller)\n",
+               extract_total_us / extracted, 100.0 * chip_bytes / frame_bytes, frame_bytes / chip_bytes);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        free(images[i].name);
+    }
+    free(images);
+    free(detect_us);
+    free(csv_copy);
+    return 0;
+}
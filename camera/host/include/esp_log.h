@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Host stand-in for esp_log: prints to stderr, filtered by mock_log_level
+
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+extern esp_log_level_t mock_log_level;
+
+uint32_t esp_log_timestamp();
+
+#define MOCK_LOG(level, letter, tag, format, ...) do { \
+        if (mock_log_level >= (level)) { \
+            fprintf(stderr, letter " (%u) %s: " format "\n", (unsigned)esp_log_timestamp(), tag, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+#define ESP_LOGE(tag, format, ...) MOCK_LOG(ESP_LOG_ERROR, "E", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) MOCK_LOG(ESP_LOG_WARN, "W", tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) MOCK_LOG(ESP_LOG_INFO, "I", tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) MOCK_LOG(ESP_LOG_DEBUG, "D", tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) MOCK_LOG(ESP_LOG_VERBOSE, "V", tag, format, ##__VA_ARGS__)
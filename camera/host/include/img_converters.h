@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_camera.h"
+#include "esp_jpg_decode.h"
+
+// Host stand-in for esp32-camera's format converters; only the JPEG encoder is provided
+
+// RGB888 input is read in B, G, R byte order, as on the device
+bool fmt2jpg(uint8_t *src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format,
+             uint8_t quality, uint8_t **out, size_t *out_len);
@@ -0,0 +1,4 @@
+#pragma once
+
+// Host stand-in for lwIP's resolver: the POSIX getaddrinfo it mirrors
+#include <netdb.h>
@@ -0,0 +1,4 @@
+#pragma once
+
+// Host stand-in for the generated sdkconfig.h; mirrors ../../sdkconfig.defaults
+#define CONFIG_LWIP_MAX_SOCKETS 16
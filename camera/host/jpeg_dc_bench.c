@@ -0,0 +1,165 @@
+// Cost per frame of the reduced-scale (DC-only) decode and the change score, plus the
+// score each frame gets when the directory is replayed in name order as a sequence.
+// First checks that over-subscribed Huffman tables are rejected; exits 1 if one is not.
+//
+//   jpeg_dc_bench <jpeg_dir> [-n iterations]
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include "esp_timer.h"
+#include "jpeg_dc.h"
+#include "change_detect.h"
+
+#define MAX_DC_PIXELS   (JPEG_DC_SCALED(2048) * JPEG_DC_SCALED(1536))
+
+static int compare_names(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static uint8_t *read_file(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *buf = malloc(*len);
+    if (buf && fread(buf, 1, *len, f) != *len) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    return buf;
+}
+
+// SOI, one DHT segment with the given code counts per length, EOI. Returns the length.
+static size_t malformed_dht(uint8_t *buf, const uint8_t counts[16]) {
+    int total = 0;
+    for (int i = 0; i < 16; i++) {
+        total += counts[i];
+    }
+    size_t seg_len = 2 + 17 + total;
+    size_t n = 0;
+    buf[n++] = 0xFF; buf[n++] = 0xD8;
+    buf[n++] = 0xFF; buf[n++] = 0xC4;
+    buf[n++] = seg_len >> 8; buf[n++] = seg_len & 0xFF;
+    buf[n++] = 0x00;                    // DC table 0
+    memcpy(buf + n, counts, 16);
+    n += 16;
+    for (int i = 0; i < total; i++) {
+        buf[n++] = (uint8_t)i;
+    }
+    buf[n++] = 0xFF; buf[n++] = 0xD9;
+    return n;
+}
+
+// Tables claiming more codes of some length than the code space holds
+static int check_malformed_dht(void) {
+    static const uint8_t cases[][16] = {
+        { 200 },                        // 200 one-bit codes
+        { 2, 1 },                       // Both one-bit codes used, then a two-bit one
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3 },   // One 16-bit code too many
+    };
+    static uint8_t jpg[4 + 2 + 17 + 256 + 2];
+    static uint8_t out[64];
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        size_t len = malformed_dht(jpg, cases[i]);
+        uint16_t w, h;
+        int err = jpeg_dc_decode(jpg, len, out, sizeof(out), &w, &h);
+        if (err != JPEG_DC_ERR_FORMAT) {
+            printf("malformed DHT case %zu: got %d, expected %d\n", i, err, JPEG_DC_ERR_FORMAT);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+int main(int argc, char **argv) {
+    int iterations = 50;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:")) != -1) {
+        if (opt == 'n') {
+            iterations = atoi(optarg) > 0 ? atoi(optarg) : 1;
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s <jpeg_dir> [-n iterations]\n", argv[0]);
+        return 2;
+    }
+
+    int failures = check_malformed_dht();
+
+    DIR *d = opendir(argv[optind]);
+    if (!d) {
+        perror(argv[optind]);
+        return 1;
+    }
+    char **names = NULL;
+    size_t count = 0;
+    struct dirent *entry;
+    while ((entry = readdir(d)) != NULL) {
+        const char *dot = strrchr(entry->d_name, '.');
+        if (dot && (strcasecmp(dot, ".jpg") == 0 || strcasecmp(dot, ".jpeg") == 0)) {
+            names = realloc(names, (count + 1) * sizeof(*names));
+            names[count++] = strdup(entry->d_name);
+        }
+    }
+    closedir(d);
+    qsort(names, count, sizeof(*names), compare_names);
+
+    static uint8_t dc[MAX_DC_PIXELS];
+    change_detector_t detector;
+    change_detect_init(&detector, 12, 4);
+    double total_decode_us = 0, total_score_us = 0, total_bytes = 0;
+    size_t decoded = 0;
+
+    printf("%-32s %8s %9s %10s %9s %6s\n", "file", "bytes", "dc_size", "decode_us", "score_us", "score");
+    for (size_t i = 0; i < count; i++) {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s", argv[optind], names[i]);
+        size_t len;
+        uint8_t *jpg = read_file(path, &len);
+        if (!jpg) {
+            continue;
+        }
+
+        uint16_t w = 0, h = 0;
+        int err = JPEG_DC_OK;
+        int64_t start = esp_timer_get_time();
+        for (int k = 0; k < iterations && err == JPEG_DC_OK; k++) {
+            err = jpeg_dc_decode(jpg, len, dc, sizeof(dc), &w, &h);
+        }
+        double decode_us = (esp_timer_get_time() - start) / (double)iterations;
+        if (err != JPEG_DC_OK) {
+            printf("%-32s %8zu  decode error %d\n", names[i], len, err);
+            free(jpg);
+            continue;
+        }
+
+        start = esp_timer_get_time();
+        int score = change_detect_update(&detector, dc, w, h);
+        double score_us = (double)(esp_timer_get_time() - start);
+
+        char size[16];
+        snprintf(size, sizeof(size), "%ux%u", w, h);
+        printf("%-32s %8zu %9s %10.1f %9.1f %6d\n", names[i], len, size, decode_us, score_us, score);
+        total_decode_us += decode_us;
+        total_score_us += score_us;
+        total_bytes += len;
+        decoded++;
+        free(jpg);
+    }
+
+    if (decoded) {
+        printf("\n%zu frames: decode %.1f us/frame (%.1f MB/s of JPEG), score %.1f us/frame\n",
+               decoded, total_decode_us / decoded, total_bytes / total_decode_us, total_score_us / decoded);
+    }
+    change_detect_free(&detector);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,180 @@
+// Checks jpeg_dc_decode() against libjpeg's own 1/8 scale decode (scale_denom = 8, luma
+// only) on JPEGs encoded here: 4:4:4, 4:2:2, 4:2:0 and grayscale, sizes that are not a
+// multiple of the MCU, with and without restart intervals. libjpeg rounds the DC term where
+// jpeg_dc truncates, so a pixel may differ by 1; anything more, a size mismatch or a failed
+// decode is reported and the test exits 1. Registered with ctest.
+//
+//   jpeg_dc_test [-v]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <jpeglib.h>
+#include "jpeg_dc.h"
+
+#define MAX_DIFF    1
+
+typedef struct {
+    const char *name;
+    int components;
+    int h_samp;         // Luma sampling factors; chroma is always 1x1
+    int v_samp;
+} subsampling_t;
+
+static const subsampling_t subsamplings[] = {
+    { "4:4:4", 3, 1, 1 },
+    { "4:2:2", 3, 2, 1 },
+    { "4:2:0", 3, 2, 2 },
+    { "gray",  1, 1, 1 },
+};
+static const int sizes[][2] = { { 1, 1 }, { 8, 8 }, { 17, 9 }, { 33, 31 }, { 160, 120 }, { 321, 241 } };
+static const int restart_intervals[] = { 0, 1, 5 };    // In MCUs
+static const int qualities[] = { 30, 90 };
+
+// Gradients with a noisy patch, so blocks have AC terms to skip and DC values that vary
+static uint8_t *make_image(int w, int h, int components) {
+    uint8_t *img = malloc((size_t)w * h * components);
+    uint32_t seed = 12345;
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            seed = seed * 1103515245 + 12345;
+            int noise = (x > w / 3 && x < 2 * w / 3 && y > h / 4) ? (int)(seed >> 24) - 128 : 0;
+            for (int c = 0; c < components; c++) {
+                int v = (x * 255 / (w > 1 ? w - 1 : 1) + y * (c + 1) * 97 / (h > 1 ? h : 1) + noise) & 0x1FF;
+                img[((size_t)y * w + x) * components + c] = v > 255 ? 511 - v : v;
+            }
+        }
+    }
+    return img;
+}
+
+static int encode(const uint8_t *img, int w, int h, const subsampling_t *s, int restart, int quality,
+                  unsigned char **jpg, unsigned long *len) {
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    *jpg = NULL;
+    *len = 0;
+    jpeg_mem_dest(&cinfo, jpg, len);
+    cinfo.image_width = w;
+    cinfo.image_height = h;
+    cinfo.input_components = s->components;
+    cinfo.in_color_space = s->components == 1 ? JCS_GRAYSCALE : JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, quality, TRUE);
+    cinfo.comp_info[0].h_samp_factor = s->h_samp;
+    cinfo.comp_info[0].v_samp_factor = s->v_samp;
+    for (int c = 1; c < s->components; c++) {
+        cinfo.comp_info[c].h_samp_factor = cinfo.comp_info[c].v_samp_factor = 1;
+    }
+    cinfo.restart_interval = restart;
+    jpeg_start_compress(&cinfo, TRUE);
+    while (cinfo.next_scanline < cinfo.image_height) {
+        JSAMPROW row = (JSAMPROW)(img + (size_t)cinfo.next_scanline * w * s->components);
+        jpeg_write_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    jpeg_destroy_compress(&cinfo);
+    return *jpg != NULL;
+}
+
+// libjpeg's reference: the DC-only 1x1 IDCT of every luma block
+static uint8_t *reference_decode(const unsigned char *jpg, unsigned long len, int *w, int *h) {
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, jpg, len);
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = 8;
+    cinfo.out_color_space = JCS_GRAYSCALE;
+    jpeg_start_decompress(&cinfo);
+    *w = cinfo.output_width;
+    *h = cinfo.output_height;
+    uint8_t *out = malloc((size_t)*w * *h);
+    while (cinfo.output_scanline < cinfo.output_height) {
+        JSAMPROW row = out + (size_t)cinfo.output_scanline * *w;
+        jpeg_read_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    return out;
+}
+
+// 0 when jpeg_dc agrees with libjpeg on this encoding, otherwise 1 with the reason printed
+static int check_case(const subsampling_t *s, int w, int h, int restart, int quality, int verbose) {
+    uint8_t *img = make_image(w, h, s->components);
+    unsigned char *jpg;
+    unsigned long len;
+    char name[64];
+    snprintf(name, sizeof(name), "%s %dx%d restart=%d q=%d", s->name, w, h, restart, quality);
+    if (!img || !encode(img, w, h, s, restart, quality, &jpg, &len)) {
+        printf("FAIL %s: could not encode\n", name);
+        free(img);
+        return 1;
+    }
+    free(img);
+
+    int ref_w, ref_h;
+    uint8_t *ref = reference_decode(jpg, len, &ref_w, &ref_h);
+    uint8_t *out = malloc((size_t)ref_w * ref_h);
+    uint16_t out_w = 0, out_h = 0;
+    int err = jpeg_dc_decode(jpg, len, out, (size_t)ref_w * ref_h, &out_w, &out_h);
+
+    int failed = 1;
+    if (err != JPEG_DC_OK) {
+        printf("FAIL %s: jpeg_dc_decode returned %d\n", name, err);
+    } else if (out_w != ref_w || out_h != ref_h) {
+        printf("FAIL %s: %ux%u output, libjpeg gives %dx%d\n", name, out_w, out_h, ref_w, ref_h);
+    } else {
+        int worst = 0, at = 0;
+        for (int i = 0; i < ref_w * ref_h; i++) {
+            int d = abs(out[i] - ref[i]);
+            if (d > worst) {
+                worst = d;
+                at = i;
+            }
+        }
+        failed = worst > MAX_DIFF;
+        if (failed) {
+            printf("FAIL %s: block (%d,%d) is %d, libjpeg gives %d\n", name, at % ref_w, at / ref_w,
+                   out[at], ref[at]);
+        } else if (verbose) {
+            printf("ok   %s: %dx%d, max diff %d\n", name, ref_w, ref_h, worst);
+        }
+    }
+    free(out);
+    free(ref);
+    free(jpg);
+    return failed;
+}
+
+int main(int argc, char **argv) {
+    int verbose = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "v")) != -1) {
+        if (opt != 'v') {
+            fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+            return 2;
+        }
+        verbose = 1;
+    }
+
+    int cases = 0, failures = 0;
+    for (size_t s = 0; s < sizeof(subsamplings) / sizeof(subsamplings[0]); s++) {
+        for (size_t z = 0; z < sizeof(sizes) / sizeof(sizes[0]); z++) {
+            for (size_t r = 0; r < sizeof(restart_intervals) / sizeof(restart_intervals[0]); r++) {
+                for (size_t q = 0; q < sizeof(qualities) / sizeof(qualities[0]); q++) {
+                    failures += check_case(&subsamplings[s], sizes[z][0], sizes[z][1], restart_intervals[r],
+                                           qualities[q], verbose);
+                    cases++;
+                }
+            }
+        }
+    }
+    printf("%d of %d encodings match libjpeg's 1/8 scale decode\n", cases - failures, cases);
+    return failures ? 1 : 0;
+}
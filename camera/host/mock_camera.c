@@ -0,0 +1,167 @@
+// Replays a directory of JPEGs through the esp_camera API at a fixed frame rate
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_camera.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "mock_camera";
+
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    uint16_t width;
+    uint16_t height;
+} mock_frame_t;
+
+static mock_frame_t *frames;
+static size_t frame_count;
+static size_t next_frame;
+static int64_t frame_interval_us;
+static int64_t next_due_us;
+static volatile bool hold_frame;
+static camera_fb_t current_fb;
+static sensor_t sensor;
+
+// Read width and height from the first SOFn marker
+static void jpeg_dimensions(const uint8_t *buf, size_t len, uint16_t *width, uint16_t *height) {
+    size_t i = 2;
+    *width = *height = 0;
+    while (i + 9 < len) {
+        if (buf[i] != 0xFF) {
+            i++;
+            continue;
+        }
+        uint8_t marker = buf[i + 1];
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+            *height = (uint16_t)((buf[i + 5] << 8) | buf[i + 6]);
+            *width = (uint16_t)((buf[i + 7] << 8) | buf[i + 8]);
+            return;
+        }
+        i += 2 + ((buf[i + 2] << 8) | buf[i + 3]);
+    }
+}
+
+static int has_jpeg_suffix(const char *name) {
+    const char *dot = strrchr(name, '.');
+    return dot && (strcasecmp(dot, ".jpg") == 0 || strcasecmp(dot, ".jpeg") == 0);
+}
+
+static int compare_names(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static int set_quality(sensor_t *s, int quality) {
+    s->status.quality = (uint8_t)quality;
+    return 0;
+}
+
+static int set_framesize(sensor_t *s, framesize_t framesize) {
+    s->status.framesize = framesize;
+    return 0;
+}
+
+esp_err_t mock_camera_open(const char *dir, int fps) {
+    DIR *d = opendir(dir);
+    if (!d) {
+        ESP_LOGE(TAG, "Cannot open frame directory %s", dir);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    char **names = NULL;
+    size_t count = 0;
+    struct dirent *entry;
+    while ((entry = readdir(d)) != NULL) {
+        if (has_jpeg_suffix(entry->d_name)) {
+            names = realloc(names, (count + 1) * sizeof(*names));
+            names[count++] = strdup(entry->d_name);
+        }
+    }
+    closedir(d);
+    qsort(names, count, sizeof(*names), compare_names);
+
+    frames = calloc(count ? count : 1, sizeof(*frames));
+    for (size_t i = 0; i < count; i++) {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s", dir, names[i]);
+        FILE *f = fopen(path, "rb");
+        if (f) {
+            fseek(f, 0, SEEK_END);
+            long len = ftell(f);
+            fseek(f, 0, SEEK_SET);
+            mock_frame_t *frame = &frames[frame_count];
+            frame->buf = malloc(len);
+            if (frame->buf && fread(frame->buf, 1, len, f) == (size_t)len) {
+                frame->len = len;
+                jpeg_dimensions(frame->buf, frame->len, &frame->width, &frame->height);
+                frame_count++;
+            } else {
+                free(frame->buf);
+            }
+            fclose(f);
+        }
+        free(names[i]);
+    }
+    free(names);
+
+    if (frame_count == 0) {
+        ESP_LOGE(TAG, "No JPEG frames found in %s", dir);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    frame_interval_us = 1000000 / (fps > 0 ? fps : 1);
+    next_due_us = esp_timer_get_time();
+    sensor.status.framesize = FRAMESIZE_VGA;
+    sensor.status.quality = 10;
+    sensor.set_quality = set_quality;
+    sensor.set_framesize = set_framesize;
+    ESP_LOGI(TAG, "Replaying %zu frames from %s at %d fps", frame_count, dir, fps);
+    return ESP_OK;
+}
+
+camera_fb_t *esp_camera_fb_get() {
+    if (frame_count == 0) {
+        return NULL;
+    }
+
+    // Block until the next exposure is due, like the driver waiting on VSYNC
+    int64_t now = esp_timer_get_time();
+    if (next_due_us > now) {
+        vTaskDelay(pdMS_TO_TICKS((next_due_us - now + 999) / 1000));
+    } else {
+        next_due_us = now;
+    }
+    next_due_us += frame_interval_us;
+
+    mock_frame_t *frame = &frames[next_frame];
+    if (!hold_frame) {
+        next_frame = (next_frame + 1) % frame_count;
+    }
+
+    int64_t ts = esp_timer_get_time();
+    current_fb.buf = frame->buf;
+    current_fb.len = frame->len;
+    current_fb.width = frame->width;
+    current_fb.height = frame->height;
+    current_fb.format = PIXFORMAT_JPEG;
+    current_fb.timestamp.tv_sec = ts / 1000000;
+    current_fb.timestamp.tv_usec = ts % 1000000;
+    return &current_fb;
+}
+
+void mock_camera_hold(bool hold) {
+    hold_frame = hold;
+}
+
+void esp_camera_fb_return(camera_fb_t *fb) {
+    (void)fb;
+}
+
+sensor_t *esp_camera_sensor_get() {
+    return frame_count ? &sensor : NULL;
+}
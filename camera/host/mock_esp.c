@@ -0,0 +1,91 @@
+// Host stand-ins for esp_log, esp_timer, esp_err and the heap capability allocator
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <time.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_system.h"
+#include "esp_random.h"
+
+esp_log_level_t mock_log_level = ESP_LOG_WARN;
+
+static int64_t monotonic_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int64_t boot_us = -1;
+
+int64_t esp_timer_get_time() {
+    // First call defines "boot"; the bench calls this before starting any task
+    if (boot_us < 0) {
+        boot_us = monotonic_us();
+    }
+    return monotonic_us() - boot_us;
+}
+
+uint32_t esp_log_timestamp() {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+const char *esp_err_to_name(esp_err_t code) {
+    switch (code) {
+    case ESP_OK: return "ESP_OK";
+    case ESP_FAIL: return "ESP_FAIL";
+    case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+    default: return "UNKNOWN ERROR";
+    }
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps) {
+    (void)caps;
+    return malloc(size);
+}
+
+void *heap_caps_malloc_prefer(size_t size, size_t num, ...) {
+    (void)num;
+    return malloc(size);
+}
+
+void heap_caps_free(void *ptr) {
+    free(ptr);
+}
+
+uint32_t esp_get_free_heap_size() {
+    return 4 * 1024 * 1024;
+}
+
+uint32_t esp_get_minimum_free_heap_size() {
+    return 4 * 1024 * 1024;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    (void)caps;
+    return 4 * 1024 * 1024;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    (void)caps;
+    return 4 * 1024 * 1024;
+}
+
+uint32_t esp_random() {
+    static uint32_t state;
+    if (state == 0) {
+        state = (uint32_t)monotonic_us() | 1;
+    }
+    // xorshift32; the device uses its hardware RNG
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
@@ -0,0 +1,234 @@
+// FreeRTOS tasks, semaphores and event groups on top of pthreads.
+// Priorities and core affinity are ignored; timing comes from CLOCK_MONOTONIC.
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "esp_timer.h"
+
+struct mock_semaphore {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    UBaseType_t count;
+    UBaseType_t max_count;
+};
+
+struct mock_event_group {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    EventBits_t bits;
+    uint32_t generation;    // Bumped on every set so set-then-clear still wakes waiters
+    EventBits_t last_set;
+};
+
+typedef struct {
+    TaskFunction_t fn;
+    void *arg;
+} task_start_t;
+
+static void deadline_after(struct timespec *ts, TickType_t ticks) {
+    clock_gettime(CLOCK_MONOTONIC, ts);
+    uint64_t ns = (uint64_t)pdTICKS_TO_MS(ticks) * 1000000ULL + (uint64_t)ts->tv_nsec;
+    ts->tv_sec += ns / 1000000000ULL;
+    ts->tv_nsec = ns % 1000000000ULL;
+}
+
+static void init_cond(pthread_cond_t *cond) {
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static void *task_trampoline(void *arg) {
+    task_start_t start = *(task_start_t *)arg;
+    free(arg);
+    start.fn(start.arg);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                                   void *arg, UBaseType_t priority, TaskHandle_t *created, BaseType_t core_id) {
+    (void)name; (void)stack_depth; (void)priority; (void)core_id;
+    task_start_t *start = malloc(sizeof(*start));
+    if (!start) {
+        return pdFAIL;
+    }
+    start->fn = fn;
+    start->arg = arg;
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, task_trampoline, start) != 0) {
+        free(start);
+        return pdFAIL;
+    }
+    pthread_detach(thread);
+    if (created) {
+        *created = (TaskHandle_t)(uintptr_t)thread;
+    }
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    (void)task;
+    pthread_exit(NULL);
+}
+
+void vTaskDelay(TickType_t ticks) {
+    struct timespec ts = {
+        .tv_sec = pdTICKS_TO_MS(ticks) / 1000,
+        .tv_nsec = (long)(pdTICKS_TO_MS(ticks) % 1000) * 1000000L,
+    };
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+TickType_t xTaskGetTickCount() {
+    return pdMS_TO_TICKS(esp_timer_get_time() / 1000);
+}
+
+BaseType_t xPortGetCoreID() {
+    return 0;
+}
+
+static SemaphoreHandle_t semaphore_create(UBaseType_t max_count, UBaseType_t initial_count) {
+    SemaphoreHandle_t sem = calloc(1, sizeof(*sem));
+    if (!sem) {
+        return NULL;
+    }
+    pthread_mutex_init(&sem->lock, NULL);
+    init_cond(&sem->cond);
+    sem->count = initial_count;
+    sem->max_count = max_count;
+    return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return semaphore_create(1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return semaphore_create(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count) {
+    return semaphore_create(max_count, initial_count);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t timeout) {
+    struct timespec deadline;
+    if (timeout != portMAX_DELAY) {
+        deadline_after(&deadline, timeout);
+    }
+
+    pthread_mutex_lock(&sem->lock);
+    while (sem->count == 0) {
+        if (timeout == portMAX_DELAY) {
+            pthread_cond_wait(&sem->cond, &sem->lock);
+        } else if (timeout == 0 || pthread_cond_timedwait(&sem->cond, &sem->lock, &deadline) == ETIMEDOUT) {
+            pthread_mutex_unlock(&sem->lock);
+            return pdFALSE;
+        }
+    }
+    sem->count--;
+    pthread_mutex_unlock(&sem->lock);
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    BaseType_t ret = pdFALSE;
+    pthread_mutex_lock(&sem->lock);
+    if (sem->count < sem->max_count) {
+        sem->count++;
+        pthread_cond_signal(&sem->cond);
+        ret = pdTRUE;
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return ret;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    pthread_mutex_destroy(&sem->lock);
+    pthread_cond_destroy(&sem->cond);
+    free(sem);
+}
+
+EventGroupHandle_t xEventGroupCreate() {
+    EventGroupHandle_t group = calloc(1, sizeof(*group));
+    if (!group) {
+        return NULL;
+    }
+    pthread_mutex_init(&group->lock, NULL);
+    init_cond(&group->cond);
+    return group;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits) {
+    pthread_mutex_lock(&group->lock);
+    group->bits |= bits;
+    group->last_set = group->bits;
+    group->generation++;
+    EventBits_t now = group->bits;
+    pthread_cond_broadcast(&group->cond);
+    pthread_mutex_unlock(&group->lock);
+    return now;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits) {
+    pthread_mutex_lock(&group->lock);
+    EventBits_t before = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&group->lock);
+    return before;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group) {
+    pthread_mutex_lock(&group->lock);
+    EventBits_t now = group->bits;
+    pthread_mutex_unlock(&group->lock);
+    return now;
+}
+
+static int bits_satisfied(EventBits_t have, EventBits_t want, BaseType_t wait_for_all) {
+    return wait_for_all ? (have & want) == want : (have & want) != 0;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+                                BaseType_t wait_for_all, TickType_t timeout) {
+    struct timespec deadline;
+    if (timeout != portMAX_DELAY) {
+        deadline_after(&deadline, timeout);
+    }
+
+    pthread_mutex_lock(&group->lock);
+    EventBits_t seen = group->bits;
+    while (!bits_satisfied(seen, bits, wait_for_all)) {
+        uint32_t generation = group->generation;
+        int rc = 0;
+        while (group->generation == generation && rc != ETIMEDOUT) {
+            if (timeout == portMAX_DELAY) {
+                pthread_cond_wait(&group->cond, &group->lock);
+            } else if (timeout == 0) {
+                rc = ETIMEDOUT;
+            } else {
+                rc = pthread_cond_timedwait(&group->cond, &group->lock, &deadline);
+            }
+        }
+        if (group->generation == generation) {
+            break;
+        }
+        // A set that was cleared straight away still counts, as on the real kernel
+        seen = group->last_set | group->bits;
+    }
+    if (bits_satisfied(seen, bits, wait_for_all) && clear_on_exit) {
+        group->bits &= ~bits;
+    }
+    pthread_mutex_unlock(&group->lock);
+    return seen;
+}
@@ -0,0 +1,373 @@
+// esp_http_server over real TCP sockets. A single worker thread accepts a connection,
+// runs the matching handler and closes it, unless the handler went async.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "esp_http_server.h"
+#include "esp_log.h"
+
+#define MOCK_MAX_REQ_HDR    2048
+#define MOCK_MAX_RESP_HDRS  16
+
+static const char *TAG = "mock_httpd";
+
+typedef struct {
+    int listen_fd;
+    httpd_config_t config;
+    httpd_uri_t *handlers;
+    size_t handler_count;
+    pthread_t thread;
+} mock_server_t;
+
+typedef struct {
+    int fd;
+    bool async;             // Ownership of fd moved to an async copy
+    bool headers_sent;
+    const char *status;
+    const char *content_type;
+    const char *hdr_field[MOCK_MAX_RESP_HDRS];
+    const char *hdr_value[MOCK_MAX_RESP_HDRS];
+    size_t hdr_count;
+    char req_hdr[MOCK_MAX_REQ_HDR];
+} mock_req_aux_t;
+
+static uint16_t port_override;
+
+void mock_httpd_set_port(uint16_t port) {
+    port_override = port;
+}
+
+static esp_err_t send_all(int fd, const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = send(fd, buf, len, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return ESP_FAIL;
+        }
+        buf += n;
+        len -= n;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t send_headers(httpd_req_t *r, const char *framing) {
+    mock_req_aux_t *aux = r->aux;
+    char hdr[1024];
+    int n = snprintf(hdr, sizeof(hdr), "HTTP/1.1 %s\r\nContent-Type: %s\r\n%s",
+                     aux->status, aux->content_type, framing);
+    for (size_t i = 0; i < aux->hdr_count && n < (int)sizeof(hdr); i++) {
+        n += snprintf(hdr + n, sizeof(hdr) - n, "%s: %s\r\n", aux->hdr_field[i], aux->hdr_value[i]);
+    }
+    if (n + 2 >= (int)sizeof(hdr)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    n += snprintf(hdr + n, sizeof(hdr) - n, "\r\n");
+    aux->headers_sent = true;
+    return send_all(aux->fd, hdr, n);
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t *r, const char *status) {
+    ((mock_req_aux_t *)r->aux)->status = status;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type) {
+    ((mock_req_aux_t *)r->aux)->content_type = type;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t *r, const char *field, const char *value) {
+    mock_req_aux_t *aux = r->aux;
+    if (aux->hdr_count >= MOCK_MAX_RESP_HDRS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    aux->hdr_field[aux->hdr_count] = field;
+    aux->hdr_value[aux->hdr_count] = value;
+    aux->hdr_count++;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len) {
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? strlen(buf) : 0;
+    }
+    char framing[64];
+    snprintf(framing, sizeof(framing), "Content-Length: %zd\r\n", buf_len);
+    if (send_headers(r, framing) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    return send_all(((mock_req_aux_t *)r->aux)->fd, buf, buf_len);
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len) {
+    mock_req_aux_t *aux = r->aux;
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? strlen(buf) : 0;
+    }
+    if (!aux->headers_sent && send_headers(r, "Transfer-Encoding: chunked\r\n") != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    char size_line[16];
+    int n = snprintf(size_line, sizeof(size_line), "%zx\r\n", buf_len);
+    if (send_all(aux->fd, size_line, n) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    if (buf_len > 0 && send_all(aux->fd, buf, buf_len) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    return send_all(aux->fd, "\r\n", 2);
+}
+
+esp_err_t httpd_resp_send_err(httpd_req_t *req, httpd_err_code_t error, const char *msg) {
+    const char *status;
+    switch (error) {
+    case HTTPD_400_BAD_REQUEST: status = "400 Bad Request"; break;
+    case HTTPD_404_NOT_FOUND: status = "404 Not Found"; break;
+    case HTTPD_405_METHOD_NOT_ALLOWED: status = "405 Method Not Allowed"; break;
+    case HTTPD_408_REQ_TIMEOUT: status = "408 Request Timeout"; break;
+    default: status = "500 Internal Server Error"; break;
+    }
+    httpd_resp_set_status(req, status);
+    httpd_resp_set_type(req, "text/plain");
+    return httpd_resp_send(req, msg, HTTPD_RESP_USE_STRLEN);
+}
+
+static httpd_req_t *alloc_req() {
+    httpd_req_t *r = calloc(1, sizeof(*r));
+    mock_req_aux_t *aux = calloc(1, sizeof(*aux));
+    if (!r || !aux) {
+        free(r);
+        free(aux);
+        return NULL;
+    }
+    r->aux = aux;
+    return r;
+}
+
+static void free_req(httpd_req_t *r) {
+    free(r->aux);
+    free(r);
+}
+
+esp_err_t httpd_req_async_handler_begin(httpd_req_t *r, httpd_req_t **out) {
+    httpd_req_t *copy = alloc_req();
+    if (!copy) {
+        return ESP_ERR_NO_MEM;
+    }
+    mock_req_aux_t *aux = r->aux;
+    void *copy_aux = copy->aux;
+    memcpy(copy, r, sizeof(*copy));
+    memcpy(copy_aux, aux, sizeof(*aux));
+    copy->aux = copy_aux;
+    aux->async = true;
+    *out = copy;
+    return ESP_OK;
+}
+
+esp_err_t httpd_req_async_handler_complete(httpd_req_t *r) {
+    close(((mock_req_aux_t *)r->aux)->fd);
+    free_req(r);
+    return ESP_OK;
+}
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t *r, char *buf, size_t buf_len) {
+    const char *q = strchr(r->uri, '?');
+    if (!q) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    q++;
+    if (strlen(q) >= buf_len) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    strcpy(buf, q);
+    return ESP_OK;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t *r, const char *field, char *val, size_t val_size) {
+    // Header lines follow the request line; field names are case-insensitive
+    size_t field_len = strlen(field);
+    const char *line = strstr(((mock_req_aux_t *)r->aux)->req_hdr, "\r\n");
+    while (line && line[2] != '\r') {
+        line += 2;
+        if (strncasecmp(line, field, field_len) == 0 && line[field_len] == ':') {
+            const char *v = line + field_len + 1;
+            v += strspn(v, " \t");
+            size_t n = strcspn(v, "\r");
+            if (n >= val_size) {
+                return ESP_ERR_INVALID_SIZE;
+            }
+            memcpy(val, v, n);
+            val[n] = '\0';
+            return ESP_OK;
+        }
+        line = strstr(line, "\r\n");
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t httpd_query_key_value(const char *qry, const char *key, char *val, size_t val_size) {
+    size_t key_len = strlen(key);
+    const char *p = qry;
+    while (p && *p) {
+        const char *end = strchr(p, '&');
+        size_t pair_len = end ? (size_t)(end - p) : strlen(p);
+        if (pair_len > key_len && strncmp(p, key, key_len) == 0 && p[key_len] == '=') {
+            size_t n = pair_len - key_len - 1;
+            if (n >= val_size) {
+                return ESP_ERR_INVALID_SIZE;
+            }
+            memcpy(val, p + key_len + 1, n);
+            val[n] = '\0';
+            return ESP_OK;
+        }
+        p = end ? end + 1 : NULL;
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+int httpd_req_to_sockfd(httpd_req_t *r) {
+    return ((mock_req_aux_t *)r->aux)->fd;
+}
+
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int sockfd) {
+    // Connections are closed when the request completes
+    (void)handle;
+    (void)sockfd;
+    return ESP_OK;
+}
+
+// Read the request head; returns its length or -1
+static int read_request_head(int fd, char *buf, size_t cap) {
+    size_t len = 0;
+    while (len + 1 < cap) {
+        ssize_t n = recv(fd, buf + len, cap - 1 - len, 0);
+        if (n <= 0) {
+            return -1;
+        }
+        len += n;
+        buf[len] = '\0';
+        if (strstr(buf, "\r\n\r\n")) {
+            return (int)len;
+        }
+    }
+    return -1;
+}
+
+static void handle_connection(mock_server_t *server, int fd) {
+    httpd_req_t *r = alloc_req();
+    if (!r) {
+        close(fd);
+        return;
+    }
+    mock_req_aux_t *aux = r->aux;
+    aux->fd = fd;
+    aux->status = "200 OK";
+    aux->content_type = "text/html";
+    r->handle = server;
+
+    char method[8];
+    char *uri = (char *)r->uri;
+    if (read_request_head(fd, aux->req_hdr, sizeof(aux->req_hdr)) < 0 ||
+        sscanf(aux->req_hdr, "%7s %512s", method, uri) != 2) {
+        close(fd);
+        free_req(r);
+        return;
+    }
+    r->method = strcmp(method, "POST") == 0 ? HTTP_POST : HTTP_GET;
+
+    // Match on the path only, like the default httpd matcher
+    size_t path_len = strcspn(uri, "?");
+    const httpd_uri_t *match = NULL;
+    for (size_t i = 0; i < server->handler_count; i++) {
+        const httpd_uri_t *h = &server->handlers[i];
+        if ((int)h->method == r->method && strlen(h->uri) == path_len && strncmp(h->uri, uri, path_len) == 0) {
+            match = h;
+            break;
+        }
+    }
+
+    if (!match) {
+        httpd_resp_send_err(r, HTTPD_404_NOT_FOUND, "Nothing matches the given URI");
+    } else {
+        r->user_ctx = match->user_ctx;
+        match->handler(r);
+    }
+
+    if (!aux->async) {
+        close(fd);
+    }
+    free_req(r);
+}
+
+static void *server_thread(void *arg) {
+    mock_server_t *server = arg;
+    while (true) {
+        int fd = accept(server->listen_fd, NULL, NULL);
+        if (fd < 0) {
+            break;
+        }
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        handle_connection(server, fd);
+    }
+    return NULL;
+}
+
+esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config) {
+    mock_server_t *server = calloc(1, sizeof(*server));
+    if (!server) {
+        return ESP_ERR_NO_MEM;
+    }
+    server->config = *config;
+    server->handlers = calloc(config->max_uri_handlers, sizeof(httpd_uri_t));
+
+    uint16_t port = port_override ? port_override : config->server_port;
+    server->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(server->listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(port),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    if (bind(server->listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+        listen(server->listen_fd, config->backlog_conn) != 0) {
+        ESP_LOGE(TAG, "Cannot listen on port %u", port);
+        close(server->listen_fd);
+        free(server->handlers);
+        free(server);
+        return ESP_FAIL;
+    }
+
+    pthread_create(&server->thread, NULL, server_thread, server);
+    *handle = server;
+    return ESP_OK;
+}
+
+esp_err_t httpd_stop(httpd_handle_t handle) {
+    mock_server_t *server = handle;
+    shutdown(server->listen_fd, SHUT_RDWR);
+    close(server->listen_fd);
+    pthread_join(server->thread, NULL);
+    free(server->handlers);
+    free(server);
+    return ESP_OK;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t *uri_handler) {
+    mock_server_t *server = handle;
+    if (server->handler_count >= server->config.max_uri_handlers) {
+        ESP_LOGE(TAG, "No slot left for URI handler %s", uri_handler->uri);
+        return ESP_FAIL;
+    }
+    server->handlers[server->handler_count++] = *uri_handler;
+    return ESP_OK;
+}
@@ -0,0 +1,102 @@
+// esp_jpg_decode and fmt2jpg on top of the system libjpeg
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <jpeglib.h>
+#include "img_converters.h"
+
+esp_err_t esp_jpg_decode(size_t len, jpg_scale_t scale, jpg_reader_cb reader, jpg_writer_cb writer, void *arg) {
+    uint8_t *jpg = malloc(len);
+    if (jpg == NULL || reader(arg, 0, jpg, len) != len) {
+        free(jpg);
+        return ESP_FAIL;
+    }
+
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, jpg, len);
+    if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK) {
+        jpeg_destroy_decompress(&cinfo);
+        free(jpg);
+        return ESP_FAIL;
+    }
+    cinfo.out_color_space = JCS_RGB;
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = 1 << scale;
+    jpeg_start_decompress(&cinfo);
+
+    esp_err_t res = ESP_OK;
+    uint16_t w = cinfo.output_width, h = cinfo.output_height;
+    uint8_t *row = malloc((size_t)w * 3);
+    if (row == NULL || !writer(arg, 0, 0, w, h, NULL)) {
+        res = ESP_FAIL;
+    }
+    // One-line tiles; tjpgd hands out MCU blocks but the writers only rely on (x, y, w, h)
+    while (res == ESP_OK && cinfo.output_scanline < h) {
+        uint16_t y = cinfo.output_scanline;
+        jpeg_read_scanlines(&cinfo, &row, 1);
+        if (!writer(arg, 0, y, w, 1, row)) {
+            res = ESP_FAIL;
+        }
+    }
+    if (res == ESP_OK) {
+        writer(arg, w, h, w, h, NULL);
+    }
+    jpeg_abort_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    free(row);
+    free(jpg);
+    return res;
+}
+
+bool fmt2jpg(uint8_t *src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format,
+             uint8_t quality, uint8_t **out, size_t *out_len) {
+    if (format != PIXFORMAT_RGB888 || src_len < (size_t)width * height * 3) {
+        return false;
+    }
+    uint8_t *row = malloc((size_t)width * 3);
+    if (row == NULL) {
+        return false;
+    }
+
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    unsigned char *buf = NULL;
+    unsigned long buf_len = 0;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    jpeg_mem_dest(&cinfo, &buf, &buf_len);
+    cinfo.image_width = width;
+    cinfo.image_height = height;
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, quality, TRUE);
+    jpeg_start_compress(&cinfo, TRUE);
+    while (cinfo.next_scanline < height) {
+        const uint8_t *bgr = src + (size_t)cinfo.next_scanline * width * 3;
+        for (int x = 0; x < width; x++) {
+            row[x * 3 + 0] = bgr[x * 3 + 2];
+            row[x * 3 + 1] = bgr[x * 3 + 1];
+            row[x * 3 + 2] = bgr[x * 3 + 0];
+        }
+        jpeg_write_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    jpeg_destroy_compress(&cinfo);
+    free(row);
+
+    // Callers free() the result, as with the device encoder
+    *out = malloc(buf_len);
+    if (*out == NULL) {
+        free(buf);
+        return false;
+    }
+    memcpy(*out, buf, buf_len);
+    *out_len = buf_len;
+    free(buf);
+    return true;
+}
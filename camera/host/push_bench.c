@@ -0,0 +1,269 @@
+// Push mode (frame_push.c) against a local stand-in for the backend's /ingest: the replayed
+// frames are pushed for -t seconds and the stand-in reports frames/s received, requests,
+// frames per request, connections opened, capture-to-receive latency, and the camera's own
+// sent/dropped counts.
+//
+//   push_bench <jpeg_dir> [-f camera_fps] [-t seconds] [-p port] [-b batch_frames]
+//              [-B batch_bytes] [-r max_fps] [-d response_delay_ms] [-x busy_every] [-c] [-k]
+//
+// -d slows every response, to see the camera drop pending frames instead of queueing them.
+// -x answers every Nth request with 503 and Retry-After: 1. -c answers Connection: close,
+// as an HTTP/1.0 server would, to compare against a connection per request. -k answers 200
+// with a chunked body, which the camera cannot skip and so must reconnect after.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "esp_camera.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "frame_ring.h"
+#include "frame_push.h"
+#include "metrics.h"
+
+#define MAX_REQUEST     (1024 * 1024)
+
+typedef struct {
+    int listen_fd;
+    int delay_ms;
+    int busy_every;
+    bool close_each;
+    bool chunked;
+    size_t connections;
+    size_t requests;
+    size_t busy;
+    size_t frames;
+    size_t bytes;
+    int64_t *latency_us;
+    size_t latency_cap;
+} standin_t;
+
+static int recv_exact(int fd, uint8_t *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = recv(fd, buf, len, 0);
+        if (n <= 0) {
+            return -1;
+        }
+        buf += n;
+        len -= n;
+    }
+    return 0;
+}
+
+// Request head up to and including the blank line, one byte at a time; returns its length
+static int read_head(int fd, char *head, size_t cap) {
+    size_t n = 0;
+    while (n + 1 < cap) {
+        if (recv(fd, head + n, 1, 0) != 1) {
+            return -1;
+        }
+        n++;
+        if (n >= 4 && memcmp(head + n - 4, "\r\n\r\n", 4) == 0) {
+            head[n] = '\0';
+            return (int)n;
+        }
+    }
+    return -1;
+}
+
+static long header_long(const char *head, const char *name) {
+    size_t name_len = strlen(name);
+    for (const char *line = head; line; line = strstr(line, "\r\n")) {
+        line += line == head ? 0 : 2;
+        if (strncasecmp(line, name, name_len) == 0) {
+            return strtol(line + name_len, NULL, 10);
+        }
+    }
+    return -1;
+}
+
+static void record_latency(standin_t *s, int64_t latency) {
+    if (s->frames >= s->latency_cap) {
+        s->latency_cap = s->latency_cap ? s->latency_cap * 2 : 256;
+        s->latency_us = realloc(s->latency_us, s->latency_cap * sizeof(*s->latency_us));
+    }
+    s->latency_us[s->frames] = latency;
+}
+
+// Walk the multipart body by each part's Content-Length, as the backend's parser does
+static int count_parts(standin_t *s, const uint8_t *body, size_t len, int64_t received_us) {
+    const char *p = (const char *)body;
+    const char *end = p + len;
+    int parts = 0;
+    while (p < end) {
+        const char *head_end = memmem(p, end - p, "\r\n\r\n", 4);
+        if (!head_end || strncmp(p, "--" FRAME_PUSH_BOUNDARY "--", sizeof(FRAME_PUSH_BOUNDARY) + 3) == 0) {
+            break;
+        }
+        char head[256];
+        size_t head_len = (size_t)(head_end - p) + 4;
+        if (head_len > sizeof(head) - 1) {
+            head_len = sizeof(head) - 1;
+        }
+        memcpy(head, p, head_len);
+        head[head_len] = '\0';
+        long jpeg_len = header_long(head, "Content-Length:");
+        long timestamp_ms = header_long(head, "X-Timestamp:");
+        if (jpeg_len < 0) {
+            return -1;
+        }
+        record_latency(s, received_us - timestamp_ms * 1000);
+        s->frames++;
+        s->bytes += jpeg_len;
+        parts++;
+        p = head_end + 4 + jpeg_len + 2;
+    }
+    return parts;
+}
+
+static void *standin_thread(void *arg) {
+    standin_t *s = arg;
+    static char head[2048];
+    uint8_t *body = malloc(MAX_REQUEST);
+    while (true) {
+        int fd = accept(s->listen_fd, NULL, NULL);
+        if (fd < 0) {
+            continue;
+        }
+        s->connections++;
+        while (true) {
+            if (read_head(fd, head, sizeof(head)) < 0) {
+                break;
+            }
+            long len = header_long(head, "Content-Length:");
+            if (len < 0 || len > MAX_REQUEST || recv_exact(fd, body, len) < 0) {
+                break;
+            }
+            int64_t received_us = esp_timer_get_time();
+            s->requests++;
+            if (s->delay_ms) {
+                usleep(s->delay_ms * 1000);
+            }
+            const char *reply;
+            if (s->busy_every && s->requests % s->busy_every == 0) {
+                s->busy++;
+                reply = s->close_each ? "HTTP/1.1 503 Service Unavailable\r\nRetry-After: 1\r\nContent-Length: 0\r\nConnection: close\r\n\r\n"
+                                      : "HTTP/1.1 503 Service Unavailable\r\nRetry-After: 1\r\nContent-Length: 0\r\n\r\n";
+            } else {
+                count_parts(s, body, len, received_us);
+                reply = s->close_each ? "HTTP/1.1 200 OK\r\nContent-Length: 2\r\nConnection: close\r\n\r\nok"
+                        : s->chunked  ? "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n2\r\nok\r\n0\r\n\r\n"
+                                      : "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok";
+            }
+            if (send(fd, reply, strlen(reply), 0) < 0 || s->close_each) {
+                break;
+            }
+        }
+        close(fd);
+    }
+    return NULL;
+}
+
+static int compare_i64(const void *a, const void *b) {
+    int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static double percentile_ms(const int64_t *sorted, size_t n, double p) {
+    return n ? sorted[(size_t)(p * (n - 1))] / 1000.0 : 0.0;
+}
+
+#define LOAD(field) ((unsigned)atomic_load_explicit(&camera_metrics.field, memory_order_relaxed))
+
+int main(int argc, char **argv) {
+    int fps = 30, seconds = 5, batch = 2, max_fps = 0;
+    long batch_bytes = 65536;
+    uint16_t port = 8090;
+    standin_t s = { 0 };
+    int opt;
+    while ((opt = getopt(argc, argv, "f:t:p:b:B:r:d:x:ckv")) != -1) {
+        switch (opt) {
+        case 'f': fps = atoi(optarg); break;
+        case 't': seconds = atoi(optarg); break;
+        case 'p': port = (uint16_t)atoi(optarg); break;
+        case 'b': batch = atoi(optarg); break;
+        case 'B': batch_bytes = atol(optarg); break;
+        case 'r': max_fps = atoi(optarg); break;
+        case 'd': s.delay_ms = atoi(optarg); break;
+        case 'x': s.busy_every = atoi(optarg); break;
+        case 'c': s.close_each = true; break;
+        case 'k': s.chunked = true; break;
+        case 'v': mock_log_level = ESP_LOG_INFO; break;
+        default: optind = argc + 1; break;
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s <jpeg_dir> [-f camera_fps] [-t seconds] [-p port] [-b batch_frames] "
+                        "[-B batch_bytes] [-r max_fps] [-d response_delay_ms] [-x busy_every] [-c] [-k] [-v]\n", argv[0]);
+        return 2;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    esp_timer_get_time();
+    s.listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(s.listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(port),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    if (bind(s.listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(s.listen_fd, 4) != 0) {
+        perror("stand-in server");
+        return 1;
+    }
+    pthread_t server;
+    pthread_create(&server, NULL, standin_thread, &s);
+
+    if (mock_camera_open(argv[optind], fps) != ESP_OK) {
+        return 1;
+    }
+    frame_ring_init();
+    start_capture_task();
+
+    char url[64];
+    snprintf(url, sizeof(url), "http://127.0.0.1:%u/ingest", port);
+    frame_push_config_t config = {
+        .url = url,
+        .camera = "bench",
+        .batch_max = batch,
+        .batch_bytes = batch_bytes,
+        .max_fps = max_fps,
+    };
+    if (!start_frame_push(&config)) {
+        return 1;
+    }
+
+    int64_t start = esp_timer_get_time();
+    vTaskDelay(pdMS_TO_TICKS(seconds * 1000));
+    double elapsed = (esp_timer_get_time() - start) / 1e6;
+
+    size_t n = s.frames;
+    int64_t *sorted = malloc((n ? n : 1) * sizeof(*sorted));
+    memcpy(sorted, s.latency_us, n * sizeof(*sorted));
+    qsort(sorted, n, sizeof(*sorted), compare_i64);
+
+    printf("camera %d fps, batch %d frames / %ld bytes, max %d fps, response delay %d ms%s%s\n",
+           fps, batch, batch_bytes, max_fps, s.delay_ms, s.busy_every ? ", 503 every few" : "",
+           s.close_each ? ", Connection: close" : s.chunked ? ", chunked" : "");
+    printf("received  %8.1f frames/s  %8.2f MB/s  %zu frames\n", n / elapsed, s.bytes / elapsed / 1e6, n);
+    printf("requests  %8zu (%zu answered 503)  %.2f frames/request\n", s.requests, s.busy,
+           s.requests > s.busy ? (double)n / (s.requests - s.busy) : 0.0);
+    printf("connections %6zu\n", s.connections);
+    printf("latency   p50 %.1f ms  p90 %.1f ms  p99 %.1f ms\n",
+           percentile_ms(sorted, n, 0.50), percentile_ms(sorted, n, 0.90), percentile_ms(sorted, n, 0.99));
+    printf("camera    sent %u  dropped %u  errors %u\n",
+           LOAD(push_frames_sent), LOAD(push_frames_dropped), LOAD(push_errors));
+    free(sorted);
+    return 0;
+}
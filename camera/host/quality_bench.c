@@ -0,0 +1,231 @@
+// Cost per frame of the focus and exposure scores (frame_quality.c) on the DC-only decode,
+// and a check that they order reference variants of every frame correctly: each frame is
+// decoded in full, re-encoded as itself, motion-blurred, darkened to 5/16 and brightened
+// until its mean is near 230, and the original must outscore the blurred copy on sharpness
+// and the darkened and brightened copies on exposure. Exits 1 if any frame misorders.
+//
+//   quality_bench <jpeg_dir> [-n iterations] [-b blur_px]
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <jpeglib.h>
+#include "esp_timer.h"
+#include "jpeg_dc.h"
+#include "frame_quality.h"
+
+#define MAX_DC_PIXELS   (JPEG_DC_SCALED(2048) * JPEG_DC_SCALED(1536))
+#define REENCODE_QUALITY 90
+#define BRIGHT_MEAN     230
+
+enum { ORIGINAL, BLURRED, DARK, BRIGHT, VARIANTS };
+static const char *VARIANT_NAMES[VARIANTS] = { "original", "blurred", "dark", "bright" };
+
+static int compare_names(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static uint8_t *read_file(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *buf = malloc(*len);
+    if (buf && fread(buf, 1, *len, f) != *len) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    return buf;
+}
+
+static uint8_t *decode_rgb(const uint8_t *jpg, size_t len, int *width, int *height) {
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, jpg, len);
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = JCS_RGB;
+    jpeg_start_decompress(&cinfo);
+    *width = cinfo.output_width;
+    *height = cinfo.output_height;
+    uint8_t *rgb = malloc((size_t)*width * *height * 3);
+    while (cinfo.output_scanline < cinfo.output_height) {
+        JSAMPROW row = rgb + (size_t)cinfo.output_scanline * *width * 3;
+        jpeg_read_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    return rgb;
+}
+
+static uint8_t *encode_rgb(const uint8_t *rgb, int width, int height, size_t *len) {
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    unsigned char *out = NULL;
+    unsigned long out_len = 0;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    jpeg_mem_dest(&cinfo, &out, &out_len);
+    cinfo.image_width = width;
+    cinfo.image_height = height;
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, REENCODE_QUALITY, TRUE);
+    jpeg_start_compress(&cinfo, TRUE);
+    while (cinfo.next_scanline < cinfo.image_height) {
+        JSAMPROW row = (JSAMPROW)rgb + (size_t)cinfo.next_scanline * width * 3;
+        jpeg_write_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    jpeg_destroy_compress(&cinfo);
+    *len = out_len;
+    return out;
+}
+
+// Horizontal box blur of radius px, as a subject crossing the frame during the exposure
+static void motion_blur(const uint8_t *src, uint8_t *dst, int width, int height, int px) {
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            for (int c = 0; c < 3; c++) {
+                int sum = 0, n = 0;
+                for (int k = -px; k <= px; k++) {
+                    int xx = x + k < 0 ? 0 : (x + k >= width ? width - 1 : x + k);
+                    sum += src[((size_t)y * width + xx) * 3 + c];
+                    n++;
+                }
+                dst[((size_t)y * width + x) * 3 + c] = (uint8_t)(sum / n);
+            }
+        }
+    }
+}
+
+// Scale by num/16 and clip, as a wrong exposure time would
+static void exposure_shift(const uint8_t *src, uint8_t *dst, size_t bytes, int num) {
+    for (size_t i = 0; i < bytes; i++) {
+        int v = src[i] * num / 16;
+        dst[i] = v > 255 ? 255 : (uint8_t)v;
+    }
+}
+
+int main(int argc, char **argv) {
+    int iterations = 50;
+    int blur_px = 6;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:b:")) != -1) {
+        if (opt == 'n') {
+            iterations = atoi(optarg) > 0 ? atoi(optarg) : 1;
+        } else if (opt == 'b') {
+            blur_px = atoi(optarg) > 0 ? atoi(optarg) : 1;
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s <jpeg_dir> [-n iterations] [-b blur_px]\n", argv[0]);
+        return 2;
+    }
+
+    DIR *d = opendir(argv[optind]);
+    if (!d) {
+        perror(argv[optind]);
+        return 1;
+    }
+    char **names = NULL;
+    size_t count = 0;
+    struct dirent *entry;
+    while ((entry = readdir(d)) != NULL) {
+        const char *dot = strrchr(entry->d_name, '.');
+        if (dot && (strcasecmp(dot, ".jpg") == 0 || strcasecmp(dot, ".jpeg") == 0)) {
+            names = realloc(names, (count + 1) * sizeof(*names));
+            names[count++] = strdup(entry->d_name);
+        }
+    }
+    closedir(d);
+    qsort(names, count, sizeof(*names), compare_names);
+
+    static uint8_t dc[MAX_DC_PIXELS];
+    double total_score_us = 0;
+    size_t scored = 0, sharp_ok = 0, dark_ok = 0, bright_ok = 0;
+
+    printf("%-28s %9s %9s %9s %9s %5s %5s %5s %8s\n", "file", "sharp", "blurred", "exp", "exp_dark",
+           "exp_br", "clip", "mean", "score_us");
+    for (size_t i = 0; i < count; i++) {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s", argv[optind], names[i]);
+        size_t len;
+        uint8_t *jpg = read_file(path, &len);
+        if (!jpg) {
+            continue;
+        }
+
+        int width, height;
+        uint8_t *rgb = decode_rgb(jpg, len, &width, &height);
+        size_t bytes = (size_t)width * height * 3;
+        uint64_t total = 0;
+        for (size_t k = 0; k < bytes; k++) {
+            total += rgb[k];
+        }
+        // Over-exposed whatever the original: its mean lands near BRIGHT_MEAN
+        uint64_t mean = total / bytes ? total / bytes : 1;
+        int bright_num = (int)(BRIGHT_MEAN * 16 / mean);
+        uint8_t *variant = malloc(bytes);
+        frame_quality_t q[VARIANTS];
+        double score_us = 0;
+        int ok = 1;
+        for (int v = 0; v < VARIANTS && ok; v++) {
+            if (v == ORIGINAL) {
+                memcpy(variant, rgb, bytes);
+            } else if (v == BLURRED) {
+                motion_blur(rgb, variant, width, height, blur_px);
+            } else {
+                exposure_shift(rgb, variant, bytes, v == DARK ? 5 : bright_num);
+            }
+            // Every variant goes through the same encoder, so only the variant differs
+            size_t vlen;
+            uint8_t *vjpg = encode_rgb(variant, width, height, &vlen);
+            uint16_t w, h;
+            ok = jpeg_dc_decode(vjpg, vlen, dc, sizeof(dc), &w, &h) == JPEG_DC_OK;
+            if (ok && v == ORIGINAL) {
+                int64_t start = esp_timer_get_time();
+                for (int k = 0; k < iterations; k++) {
+                    frame_quality_score(dc, w, h, &q[v]);
+                }
+                score_us = (esp_timer_get_time() - start) / (double)iterations;
+            } else if (ok) {
+                frame_quality_score(dc, w, h, &q[v]);
+            }
+            free(vjpg);
+        }
+        free(variant);
+        free(rgb);
+        free(jpg);
+        if (!ok) {
+            printf("%-28s  decode error\n", names[i]);
+            continue;
+        }
+
+        printf("%-28s %9u %9u %9u %9u %5u %5u %5u %8.1f\n", names[i], (unsigned)q[ORIGINAL].sharpness,
+               (unsigned)q[BLURRED].sharpness, (unsigned)q[ORIGINAL].exposure, (unsigned)q[DARK].exposure,
+               (unsigned)q[BRIGHT].exposure, (unsigned)q[ORIGINAL].clipped, (unsigned)q[ORIGINAL].mean, score_us);
+        total_score_us += score_us;
+        scored++;
+        sharp_ok += q[ORIGINAL].sharpness > q[BLURRED].sharpness;
+        dark_ok += q[ORIGINAL].exposure > q[DARK].exposure;
+        bright_ok += q[ORIGINAL].exposure > q[BRIGHT].exposure;
+    }
+
+    if (scored) {
+        printf("\n%zu frames: score %.1f us/frame\n", scored, total_score_us / scored);
+        printf("original ranked above %s: %zu/%zu, %s: %zu/%zu, %s: %zu/%zu\n",
+               VARIANT_NAMES[BLURRED], sharp_ok, scored, VARIANT_NAMES[DARK], dark_ok, scored,
+               VARIANT_NAMES[BRIGHT], bright_ok, scored);
+    }
+    return scored && sharp_ok == scored && dark_ok == scored && bright_ok == scored ? 0 : 1;
+}
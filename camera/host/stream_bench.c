@@ -0,0 +1,404 @@
+// Streams the replayed frames to 1..N concurrent loopback /stream clients and reports
+// delivered fps, capture-to-receive latency percentiles, throughput, and the capture rate
+// and ring_full drops during the round, per client count.
+//
+//   stream_bench <jpeg_dir> [-f camera_fps] [-c max_clients] [-t seconds] [-p port] [-q query]
+//                [-l] [-k credits] [-b best_of]
+//
+// -q passes a query string to every client, e.g. -q "fps=30&max_bps=400000".
+// -l uses the binary frame link (port + 1) instead of /stream; each client keeps -k credits
+// outstanding (default 1, i.e. ack every frame).
+// A last /stream round replays one frame as a still scene, starts N clients a frame apart
+// with best_of=-b (default 8, 0 skips it), and exits 1 if the capture task finds the ring
+// full. Equal frames keep each client's first of the group as its best, so the clients hold
+// different older frames while they wait for the rest of their groups.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "esp_camera.h"
+#include "esp_http_server.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "frame_ring.h"
+#include "camera_server.h"
+#include "frame_link.h"
+#include "metrics.h"
+
+#define READ_BUF_SIZE   65536
+
+typedef struct {
+    int fd;
+    uint8_t buf[READ_BUF_SIZE];
+    size_t pos;
+    size_t len;
+    bool chunked;
+    size_t chunk_left;
+} body_reader_t;
+
+typedef struct {
+    uint16_t port;
+    const char *query;
+    int64_t deadline_us;
+    bool link;
+    int credits;
+    size_t frames;
+    size_t bytes;
+    int64_t *latency_us;
+    size_t latency_cap;
+    bool rejected;
+} client_t;
+
+static int fill(body_reader_t *r) {
+    ssize_t n = recv(r->fd, r->buf, sizeof(r->buf), 0);
+    if (n <= 0) {
+        return -1;
+    }
+    r->pos = 0;
+    r->len = n;
+    return 0;
+}
+
+static int raw_byte(body_reader_t *r) {
+    if (r->pos == r->len && fill(r) < 0) {
+        return -1;
+    }
+    return r->buf[r->pos++];
+}
+
+static int raw_line(body_reader_t *r, char *line, size_t cap) {
+    size_t n = 0;
+    int c;
+    while ((c = raw_byte(r)) >= 0) {
+        if (c == '\n') {
+            if (n > 0 && line[n - 1] == '\r') {
+                n--;
+            }
+            line[n] = '\0';
+            return (int)n;
+        }
+        if (n + 1 < cap) {
+            line[n++] = (char)c;
+        }
+    }
+    return -1;
+}
+
+// Next byte of the response body, undoing chunked transfer encoding when present
+static int body_byte(body_reader_t *r) {
+    if (r->chunked && r->chunk_left == 0) {
+        char line[32];
+        if (raw_line(r, line, sizeof(line)) == 0 && raw_line(r, line, sizeof(line)) < 0) {
+            return -1;
+        }
+        r->chunk_left = strtoul(line, NULL, 16);
+        if (r->chunk_left == 0) {
+            return -1;
+        }
+    }
+    int c = raw_byte(r);
+    if (c >= 0 && r->chunked) {
+        r->chunk_left--;
+    }
+    return c;
+}
+
+static int body_line(body_reader_t *r, char *line, size_t cap) {
+    size_t n = 0;
+    int c;
+    while ((c = body_byte(r)) >= 0) {
+        if (c == '\n') {
+            if (n > 0 && line[n - 1] == '\r') {
+                n--;
+            }
+            line[n] = '\0';
+            return (int)n;
+        }
+        if (n + 1 < cap) {
+            line[n++] = (char)c;
+        }
+    }
+    return -1;
+}
+
+static int body_skip(body_reader_t *r, size_t len) {
+    while (len > 0) {
+        if (r->pos == r->len && fill(r) < 0) {
+            return -1;
+        }
+        size_t n = r->len - r->pos;
+        if (r->chunked) {
+            if (r->chunk_left == 0) {
+                if (body_byte(r) < 0) {
+                    return -1;
+                }
+                len--;
+                continue;
+            }
+            n = n < r->chunk_left ? n : r->chunk_left;
+            r->chunk_left -= n < len ? n : len;
+        }
+        n = n < len ? n : len;
+        r->pos += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static void record_latency(client_t *c, int64_t latency) {
+    if (c->frames >= c->latency_cap) {
+        c->latency_cap = c->latency_cap ? c->latency_cap * 2 : 256;
+        c->latency_us = realloc(c->latency_us, c->latency_cap * sizeof(*c->latency_us));
+    }
+    c->latency_us[c->frames] = latency;
+}
+
+static int recv_exact(int fd, uint8_t *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = recv(fd, buf, len, 0);
+        if (n <= 0) {
+            return -1;
+        }
+        buf += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static int send_credits(int fd, uint32_t credits) {
+    uint32_t msg[2] = { FRAME_LINK_CREDIT_MAGIC, credits };     // Host is little-endian like the device
+    return send(fd, msg, sizeof(msg), 0) == sizeof(msg) ? 0 : -1;
+}
+
+static void *link_client_thread(void *arg) {
+    client_t *c = arg;
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(c->port + 1),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || send_credits(fd, c->credits) < 0) {
+        goto done;
+    }
+
+    uint8_t header[FRAME_LINK_HEADER_LEN];
+    static __thread uint8_t jpeg[512 * 1024];
+    while (esp_timer_get_time() < c->deadline_us) {
+        if (recv_exact(fd, header, sizeof(header)) < 0) {
+            // Closed straight after connecting means the camera had no free link slot
+            c->rejected = c->frames == 0;
+            break;
+        }
+        uint32_t magic, len;
+        uint64_t timestamp_us;
+        memcpy(&magic, header, 4);
+        memcpy(&timestamp_us, header + 8, 8);
+        memcpy(&len, header + 16, 4);
+        if (magic != FRAME_LINK_FRAME_MAGIC || len > sizeof(jpeg) || recv_exact(fd, jpeg, len) < 0 ||
+            send_credits(fd, 1) < 0) {
+            break;
+        }
+        record_latency(c, esp_timer_get_time() - (int64_t)timestamp_us);
+        c->frames++;
+        c->bytes += len;
+    }
+
+done:
+    close(fd);
+    return NULL;
+}
+
+static void *client_thread(void *arg) {
+    client_t *c = arg;
+    body_reader_t *r = calloc(1, sizeof(*r));
+    r->fd = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(c->port),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    // A stalled stream ends the client instead of hanging the round
+    struct timeval timeout = { .tv_sec = 2 };
+    setsockopt(r->fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    char request[256];
+    int request_len = snprintf(request, sizeof(request), "GET /stream%s%s HTTP/1.1\r\nHost: localhost\r\n\r\n",
+                               c->query ? "?" : "", c->query ? c->query : "");
+    if (connect(r->fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+        send(r->fd, request, request_len, 0) < 0) {
+        goto done;
+    }
+
+    char line[256];
+    if (raw_line(r, line, sizeof(line)) < 0 || strncmp(line + 9, "200", 3) != 0) {
+        c->rejected = true;
+        goto done;
+    }
+    while (raw_line(r, line, sizeof(line)) > 0) {
+        if (strncasecmp(line, "Transfer-Encoding: chunked", 26) == 0) {
+            r->chunked = true;
+        }
+    }
+
+    while (esp_timer_get_time() < c->deadline_us) {
+        long content_len = -1;
+        long timestamp_ms = -1;
+        int n;
+        // Skip boundary lines, then read part headers up to the blank line
+        while ((n = body_line(r, line, sizeof(line))) >= 0) {
+            if (strncasecmp(line, "Content-Length:", 15) == 0) {
+                content_len = strtol(line + 15, NULL, 10);
+            } else if (strncasecmp(line, "X-Timestamp:", 12) == 0) {
+                timestamp_ms = strtol(line + 12, NULL, 10);
+            } else if (n == 0 && content_len >= 0) {
+                break;
+            }
+        }
+        if (n < 0 || body_skip(r, content_len) < 0) {
+            break;
+        }
+        int64_t now = esp_timer_get_time();
+        record_latency(c, timestamp_ms >= 0 ? now - timestamp_ms * 1000 : 0);
+        c->frames++;
+        c->bytes += content_len;
+    }
+
+done:
+    close(r->fd);
+    free(r);
+    return NULL;
+}
+
+static int compare_i64(const void *a, const void *b) {
+    int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static double percentile_ms(const int64_t *sorted, size_t n, double p) {
+    return n ? sorted[(size_t)(p * (n - 1))] / 1000.0 : 0.0;
+}
+
+#define LOAD(field) ((unsigned)atomic_load_explicit(&camera_metrics.field, memory_order_relaxed))
+
+// Runs one round and returns the frames the capture task dropped for a full ring during it
+static unsigned run_round(uint16_t port, const char *query, bool link, int credits, int clients, int seconds,
+                        int stagger_ms) {
+    client_t *c = calloc(clients, sizeof(*c));
+    pthread_t *threads = calloc(clients, sizeof(*threads));
+    unsigned captured = LOAD(frames_captured), ring_full = LOAD(dropped_ring_full);
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < clients; i++) {
+        if (i > 0 && stagger_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(stagger_ms));
+        }
+        c[i].port = port;
+        c[i].query = query;
+        c[i].deadline_us = start + (int64_t)seconds * 1000000;
+        c[i].link = link;
+        c[i].credits = credits;
+        pthread_create(&threads[i], NULL, link ? link_client_thread : client_thread, &c[i]);
+    }
+
+    size_t frames = 0, bytes = 0, rejected = 0;
+    for (int i = 0; i < clients; i++) {
+        pthread_join(threads[i], NULL);
+        frames += c[i].frames;
+        bytes += c[i].bytes;
+        rejected += c[i].rejected;
+    }
+    double elapsed = (esp_timer_get_time() - start) / 1e6;
+    double capture_fps = (LOAD(frames_captured) - captured) / elapsed;
+    ring_full = LOAD(dropped_ring_full) - ring_full;
+
+    int64_t *all = malloc((frames ? frames : 1) * sizeof(*all));
+    size_t n = 0;
+    for (int i = 0; i < clients; i++) {
+        memcpy(all + n, c[i].latency_us, c[i].frames * sizeof(*all));
+        n += c[i].frames;
+        free(c[i].latency_us);
+    }
+    qsort(all, n, sizeof(*all), compare_i64);
+
+    int served = clients - (int)rejected;
+    printf("%7d %8zu %9.1f %10.1f %8.1f %8.1f %8.1f %8.1f %9.2f %8.1f %9u\n",
+           clients, rejected, frames / elapsed, served ? frames / elapsed / served : 0.0,
+           percentile_ms(all, n, 0.50), percentile_ms(all, n, 0.90), percentile_ms(all, n, 0.99),
+           n ? all[n - 1] / 1000.0 : 0.0, bytes / elapsed / 1e6, capture_fps, ring_full);
+
+    free(all);
+    free(threads);
+    free(c);
+    return ring_full;
+}
+
+int main(int argc, char **argv) {
+    int fps = 30, max_clients = 3, seconds = 5;
+    uint16_t port = 8080;
+    const char *query = NULL;
+    bool link = false;
+    int credits = 1;
+    int best_of = 8;
+    int opt;
+    while ((opt = getopt(argc, argv, "f:c:t:p:q:lk:b:v")) != -1) {
+        switch (opt) {
+        case 'f': fps = atoi(optarg); break;
+        case 'c': max_clients = atoi(optarg); break;
+        case 't': seconds = atoi(optarg); break;
+        case 'p': port = (uint16_t)atoi(optarg); break;
+        case 'q': query = optarg; break;
+        case 'l': link = true; break;
+        case 'k': credits = atoi(optarg) > 0 ? atoi(optarg) : 1; break;
+        case 'b': best_of = atoi(optarg); break;
+        case 'v': mock_log_level = ESP_LOG_INFO; break;
+        default: optind = argc + 1; break;
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s <jpeg_dir> [-f camera_fps] [-c max_clients] [-t seconds] [-p port] [-q query] [-l] [-k credits] [-b best_of] [-v]\n", argv[0]);
+        return 2;
+    }
+
+    // lwIP never raises SIGPIPE; match that for sends to closed client sockets
+    signal(SIGPIPE, SIG_IGN);
+    esp_timer_get_time();
+    if (mock_camera_open(argv[optind], fps) != ESP_OK) {
+        return 1;
+    }
+    frame_ring_init();
+    start_capture_task();
+    mock_httpd_set_port(port);
+    start_camera_server();
+    start_frame_link(port + 1);
+    vTaskDelay(pdMS_TO_TICKS(100));
+
+    printf("camera %d fps, %d s per round, %s\n", fps, seconds, link ? "frame link" : "/stream");
+    printf("clients rejected  fps_total fps_client  p50_ms   p90_ms   p99_ms   max_ms     MB/s  cap_fps ring_full\n");
+    for (int clients = 1; clients <= max_clients; clients++) {
+        run_round(port, query, link, credits, clients, seconds, 0);
+        // Let stream tasks notice the closed sockets and free their slots
+        vTaskDelay(pdMS_TO_TICKS(500));
+    }
+    if (link || best_of <= 1) {
+        return 0;
+    }
+
+    char best_query[256];
+    snprintf(best_query, sizeof(best_query), "%s%sbest_of=%d", query ? query : "", query ? "&" : "", best_of);
+    printf("\n%d clients a frame apart, %s, still scene\n", max_clients, best_query);
+    mock_camera_hold(true);
+    if (run_round(port, best_query, false, credits, max_clients, seconds, 1000 / fps) > 0) {
+        printf("capture found the ring full with best_of clients\n");
+        return 1;
+    }
+    return 0;
+}
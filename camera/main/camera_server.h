@@ -0,0 +1,4 @@
+#pragma once
+
+// Start the HTTP server with the /, /capture, /test, /stream, /motion, /faces and /metrics endpoints
+void start_camera_server();
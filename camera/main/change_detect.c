@@ -0,0 +1,57 @@
+#include <stdlib.h>
+#include "change_detect.h"
+
+void change_detect_init(change_detector_t *cd, uint8_t pixel_threshold, uint8_t learn_shift) {
+    cd->width = 0;
+    cd->height = 0;
+    cd->background = NULL;
+    cd->pixel_threshold = pixel_threshold;
+    cd->learn_shift = learn_shift;
+}
+
+void change_detect_free(change_detector_t *cd) {
+    free(cd->background);
+    cd->background = NULL;
+    cd->width = cd->height = 0;
+}
+
+int change_detect_update(change_detector_t *cd, const uint8_t *img, uint16_t width, uint16_t height) {
+    size_t n = (size_t)width * height;
+    if (n == 0) {
+        return -1;
+    }
+
+    if (cd->background == NULL || cd->width != width || cd->height != height) {
+        free(cd->background);
+        cd->background = malloc(n * sizeof(*cd->background));
+        if (cd->background == NULL) {
+            cd->width = cd->height = 0;
+            return -1;
+        }
+        for (size_t i = 0; i < n; i++) {
+            cd->background[i] = (uint16_t)(img[i] << 8);
+        }
+        cd->width = width;
+        cd->height = height;
+        return CHANGE_SCORE_MAX;
+    }
+
+    // Mean offset between frame and background, Q8
+    int64_t sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += (img[i] << 8) - cd->background[i];
+    }
+    int32_t offset = (int32_t)(sum / (int64_t)n);
+
+    int32_t threshold = cd->pixel_threshold << 8;
+    size_t changed = 0;
+    for (size_t i = 0; i < n; i++) {
+        int32_t diff = (img[i] << 8) - cd->background[i];
+        int32_t residual = diff - offset;
+        if (residual > threshold || residual < -threshold) {
+            changed++;
+        }
+        cd->background[i] = (uint16_t)(cd->background[i] + (diff >> cd->learn_shift));
+    }
+    return (int)(changed * CHANGE_SCORE_MAX / n);
+}
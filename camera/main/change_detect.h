@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+
+// Running-average background model over 1/8 scale luma images (see jpeg_dc.h).
+// Portable C with no ESP-IDF dependencies so it also builds on the host.
+
+#define CHANGE_SCORE_MAX    1000    // Scores are changed blocks per mille
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint16_t *background;       // Q8 running mean of each block
+    uint8_t pixel_threshold;    // Block difference (0..255) that counts as changed
+    uint8_t learn_shift;        // Each frame moves the background 1/2^shift of the way
+} change_detector_t;
+
+void change_detect_init(change_detector_t *cd, uint8_t pixel_threshold, uint8_t learn_shift);
+
+// Score img against the background, then fold it in. A global brightness shift (auto
+// exposure) is subtracted first so it doesn't count as change. The first frame, or one
+// of a new size, restarts the model and scores CHANGE_SCORE_MAX. Returns -1 if out of memory.
+int change_detect_update(change_detector_t *cd, const uint8_t *img, uint16_t width, uint16_t height);
+
+void change_detect_free(change_detector_t *cd);
@@ -0,0 +1,2216 @@
+// Generated by camera/tools/haar_to_c.py from haarcascade_frontalface_alt.xml - do not edit.
+// Included by face_detect.c only.
+/*
+    Stump-based 20x20 gentle adaboost frontal face detector.
+    Created by Rainer Lienhart.
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+  IMPORTANT: READ BEFORE DOWNLOADING, COPYING, INSTALLING OR USING.
+
+  By downloading, copying, installing or using the software you agree to this license.
+  If you do not agree to this license, do not download, install,
+  copy or use the software.
+
+
+                        Intel License Agreement
+                For Open Source Computer Vision Library
+
+ Copyright (C) 2000, Intel Corporation, all rights reserved.
+ Third party copyrights are property of their respective owners.
+
+ Redistribution and use in source and binary forms, with or without modification,
+ are permitted provided that the following conditions are met:
+
+   * Redistribution's of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+
+   * Redistribution's in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+   * The name of Intel Corporation may not be used to endorse or promote products
+     derived from this software without specific prior written permission.
+
+ This software is provided by the copyright holders and contributors "as is" and
+ any express or implied warranties, including, but not limited to, the implied
+ warranties of merchantability and fitness for a particular purpose are disclaimed.
+ In no event shall the Intel Corporation or contributors be liable for any direct,
+ indirect, incidental, special, exemplary, or consequential damages
+ (including, but not limited to, procurement of substitute goods or services;
+ loss of use, data, or profits; or business interruption) however caused
+ and on any theory of liability, whether in contract, strict liability,
+ or tort (including negligence or otherwise) arising in any way out of
+ the use of this software, even if advised of the possibility of such damage.
+*/
+#pragma once
+
+#define FACE_CASCADE_WIDTH      20
+#define FACE_CASCADE_HEIGHT     20
+#define FACE_CASCADE_STAGES     22
+#define FACE_CASCADE_STUMPS     2135
+#define FACE_THRESHOLD_Q        20
+#define FACE_LEAF_Q             12
+
+static const face_stage_t face_cascade_stages[FACE_CASCADE_STAGES] = {
+    { 0, 3, 3370 },
+    { 3, 16, 28494 },
+    { 19, 21, 38906 },
+    { 40, 39, 75420 },
+    { 79, 33, 62768 },
+    { 112, 44, 86060 },
+    { 156, 50, 97971 },
+    { 206, 51, 100466 },
+    { 257, 56, 111220 },
+    { 313, 71, 141534 },
+    { 384, 80, 160183 },
+    { 464, 103, 207301 },
+    { 567, 111, 223724 },
+    { 678, 102, 205495 },
+    { 780, 135, 273077 },
+    { 915, 137, 277295 },
+    { 1052, 140, 283566 },
+    { 1192, 160, 324604 },
+    { 1352, 177, 359203 },
+    { 1529, 182, 369678 },
+    { 1711, 211, 429053 },
+    { 1922, 213, 433197 },
+};
+
+static const face_stump_t face_cascade_stumps[FACE_CASCADE_STUMPS] = {
+    { 4209, 138, 3432, 2, { { 3, 7, 14, 4, -1 }, { 3, 9, 14, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 15887, 620, 3067, 2, { { 1, 2, 18, 4, -1 }, { 7, 2, 6, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4416, 369, 2611, 2, { { 1, 7, 15, 9, -1 }, { 1, 10, 15, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1702, 284, 2913, 2, { { 5, 6, 2, 6, -1 }, { 5, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2402, 736, 2731, 2, { { 7, 5, 6, 3, -1 }, { 9, 5, 2, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5246, 694, 2685, 2, { { 4, 0, 12, 9, -1 }, { 4, 3, 12, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8353, 2403, 374, 2, { { 6, 9, 10, 8, -1 }, { 6, 13, 10, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -3694, 579, 2471, 2, { { 3, 6, 14, 8, -1 }, { 3, 10, 14, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 38449, 1506, 3244, 2, { { 14, 1, 6, 10, -1 }, { 14, 1, 3, 10, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 9790, 2524, 855, 2, { { 7, 8, 5, 12, -1 }, { 7, 12, 5, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 9119, 1162, 2605, 2, { { 1, 1, 18, 3, -1 }, { 7, 1, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1205, 911, 2376, 2, { { 1, 8, 17, 2, -1 }, { 1, 9, 17, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2253, 986, 2370, 2, { { 16, 6, 4, 2, -1 }, { 16, 7, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2225, 2277, 558, 2, { { 5, 17, 2, 2, -1 }, { 5, 18, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -98513, 3483, 1932, 2, { { 14, 2, 6, 12, -1 }, { 14, 2, 3, 12, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1445, 2455, 1161, 3, { { 4, 0, 4, 12, -1 }, { 4, 0, 2, 6, 2 }, { 6, 6, 2, 6, 2 } } },
+    { 76612, 1778, 2892, 2, { { 2, 11, 18, 8, -1 }, { 8, 11, 6, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 386, 1240, 2479, 2, { { 5, 7, 10, 2, -1 }, { 5, 8, 10, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6342, 737, 2325, 2, { { 15, 11, 5, 3, -1 }, { 15, 12, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -17313, 2721, 584, 2, { { 5, 3, 10, 9, -1 }, { 5, 6, 10, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2837, 2591, 528, 2, { { 9, 4, 2, 14, -1 }, { 9, 11, 2, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2943, 508, 2537, 2, { { 3, 5, 4, 12, -1 }, { 3, 9, 4, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1615, 587, 2322, 2, { { 4, 5, 12, 5, -1 }, { 8, 5, 4, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -591, 679, 2419, 2, { { 5, 6, 10, 8, -1 }, { 5, 10, 10, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2019, 1104, 2351, 2, { { 8, 0, 6, 9, -1 }, { 8, 3, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5265, 776, 2369, 2, { { 9, 12, 1, 8, -1 }, { 9, 16, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2765, 946, 2333, 2, { { 0, 7, 20, 6, -1 }, { 0, 9, 20, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1586, 1130, 2440, 2, { { 7, 0, 6, 17, -1 }, { 9, 0, 2, 17, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -10651, 710, 2262, 2, { { 9, 0, 6, 4, -1 }, { 11, 0, 2, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -12534, 549, 2277, 2, { { 5, 1, 6, 4, -1 }, { 7, 1, 2, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5123, 1486, 2535, 2, { { 12, 1, 6, 16, -1 }, { 14, 1, 2, 16, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -84025, 374, 2243, 3, { { 0, 5, 18, 8, -1 }, { 0, 5, 9, 4, 2 }, { 9, 9, 9, 4, 2 } } },
+    { 1116, 1522, 2339, 3, { { 8, 15, 10, 4, -1 }, { 13, 15, 5, 2, 2 }, { 8, 17, 5, 2, 2 } } },
+    { -1407, 2438, 1359, 3, { { 3, 1, 4, 8, -1 }, { 3, 1, 2, 4, 2 }, { 5, 5, 2, 4, 2 } } },
+    { -57253, 755, 2295, 3, { { 3, 6, 14, 10, -1 }, { 10, 6, 7, 5, 2 }, { 3, 11, 7, 5, 2 } } },
+    { 3048, 1472, 2512, 2, { { 2, 1, 6, 16, -1 }, { 4, 1, 2, 16, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 783, 2455, 1417, 2, { { 0, 18, 20, 2, -1 }, { 0, 19, 20, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4510, 1709, 2863, 2, { { 8, 13, 4, 3, -1 }, { 8, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4720, 1847, 3195, 2, { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 25311, 2227, 541, 2, { { 0, 12, 9, 6, -1 }, { 0, 14, 9, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2015, 580, 2539, 2, { { 5, 7, 3, 4, -1 }, { 5, 9, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -134, 2536, 772, 2, { { 9, 3, 2, 16, -1 }, { 9, 11, 2, 8, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 539, 609, 2399, 2, { { 3, 6, 13, 8, -1 }, { 3, 10, 13, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4391, 1125, 2605, 2, { { 12, 3, 8, 2, -1 }, { 12, 3, 4, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5349, 2405, 891, 2, { { 8, 8, 4, 12, -1 }, { 8, 12, 4, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2249, 2409, 1220, 3, { { 11, 3, 8, 6, -1 }, { 15, 3, 4, 3, 2 }, { 11, 6, 4, 3, 2 } } },
+    { -3038, 972, 2407, 2, { { 7, 1, 6, 19, -1 }, { 9, 1, 2, 19, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -22660, 500, 2128, 2, { { 9, 0, 6, 4, -1 }, { 11, 0, 2, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4855, 1078, 2383, 2, { { 3, 1, 9, 3, -1 }, { 6, 1, 3, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 623, 1490, 2334, 3, { { 8, 15, 10, 4, -1 }, { 13, 15, 5, 2, 2 }, { 8, 17, 5, 2, 2 } } },
+    { 56496, 1763, 3096, 2, { { 0, 3, 6, 10, -1 }, { 3, 3, 3, 10, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1980, 869, 2299, 2, { { 3, 4, 15, 15, -1 }, { 3, 9, 15, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2478, 2307, 1082, 2, { { 6, 5, 8, 6, -1 }, { 6, 7, 8, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 25184, 2374, 1127, 3, { { 4, 4, 12, 10, -1 }, { 10, 4, 6, 5, 2 }, { 4, 9, 6, 5, 2 } } },
+    { 215, 1108, 2356, 2, { { 6, 4, 4, 4, -1 }, { 8, 4, 2, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 889, 2226, 956, 2, { { 15, 11, 1, 2, -1 }, { 15, 12, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1478, 2179, 845, 2, { { 3, 11, 2, 2, -1 }, { 3, 12, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1535, 2220, 1257, 2, { { 16, 11, 1, 3, -1 }, { 16, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1715, 1514, 2504, 3, { { 3, 15, 6, 4, -1 }, { 3, 15, 3, 2, 2 }, { 6, 17, 3, 2, 2 } } },
+    { 872, 1460, 2468, 2, { { 6, 7, 8, 2, -1 }, { 6, 8, 8, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2202, 784, 2197, 2, { { 3, 11, 1, 3, -1 }, { 3, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -778, 1571, 2265, 2, { { 6, 0, 12, 2, -1 }, { 6, 1, 12, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3424, 1767, 2909, 2, { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 935, 1632, 2618, 2, { { 7, 15, 6, 2, -1 }, { 7, 16, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -16027, 969, 2226, 2, { { 0, 5, 4, 6, -1 }, { 0, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5073, 2383, 1327, 2, { { 4, 12, 12, 2, -1 }, { 8, 12, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -955, 2269, 1193, 2, { { 6, 3, 1, 9, -1 }, { 6, 6, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6425, 727, 2129, 2, { { 10, 17, 3, 2, -1 }, { 11, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -467, 1239, 2267, 2, { { 9, 9, 2, 2, -1 }, { 9, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 23747, 1808, 2857, 2, { { 7, 6, 6, 4, -1 }, { 9, 6, 2, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1972, 1143, 2252, 2, { { 7, 17, 3, 2, -1 }, { 8, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7433, 2156, 977, 2, { { 10, 17, 3, 3, -1 }, { 11, 17, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1816, 1769, 2860, 2, { { 8, 12, 3, 2, -1 }, { 8, 13, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -7181, 1262, 2208, 2, { { 9, 3, 6, 2, -1 }, { 11, 3, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -16, 2262, 1278, 2, { { 3, 11, 14, 4, -1 }, { 3, 13, 14, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 30907, 2212, 725, 3, { { 1, 10, 18, 4, -1 }, { 10, 10, 9, 2, 2 }, { 1, 12, 9, 2, 2 } } },
+    { 8534, 2121, 496, 2, { { 0, 10, 3, 3, -1 }, { 0, 11, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 21960, 2167, 1356, 2, { { 9, 1, 6, 6, -1 }, { 11, 1, 2, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -10031, 3061, 1824, 2, { { 8, 7, 3, 6, -1 }, { 9, 7, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -296, 845, 2489, 2, { { 1, 0, 18, 9, -1 }, { 1, 3, 18, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1761, 2397, 514, 2, { { 12, 10, 2, 6, -1 }, { 12, 13, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 732, 385, 2347, 2, { { 0, 5, 19, 8, -1 }, { 0, 9, 19, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 828, 730, 2332, 2, { { 7, 0, 6, 9, -1 }, { 9, 0, 2, 9, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2995, 671, 2371, 2, { { 5, 3, 6, 1, -1 }, { 7, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3997, 854, 2256, 2, { { 11, 3, 6, 1, -1 }, { 13, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1667, 2336, 761, 2, { { 5, 10, 4, 6, -1 }, { 5, 13, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 10568, 2096, 897, 2, { { 11, 3, 6, 1, -1 }, { 13, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -66612, 2921, 1656, 2, { { 4, 4, 12, 6, -1 }, { 4, 6, 12, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9545, 1052, 2238, 2, { { 15, 12, 2, 6, -1 }, { 15, 14, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2520, 697, 2290, 2, { { 9, 3, 2, 2, -1 }, { 10, 3, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1597, 2216, 1073, 2, { { 9, 3, 3, 1, -1 }, { 10, 3, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 18872, 1529, 2677, 2, { { 1, 1, 4, 14, -1 }, { 3, 1, 2, 14, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6767, 1076, 2268, 3, { { 9, 0, 4, 4, -1 }, { 11, 0, 2, 2, 2 }, { 9, 2, 2, 2, 2 } } },
+    { -12458, 821, 2271, 2, { { 7, 5, 1, 14, -1 }, { 7, 12, 1, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1333, 2290, 1242, 2, { { 19, 0, 1, 4, -1 }, { 19, 2, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1193, 1118, 2313, 2, { { 5, 5, 6, 4, -1 }, { 8, 5, 3, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4472, 576, 2237, 2, { { 9, 18, 3, 2, -1 }, { 10, 18, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3104, 735, 2236, 2, { { 8, 18, 3, 2, -1 }, { 9, 18, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9274, 2350, 1151, 2, { { 4, 5, 12, 6, -1 }, { 4, 7, 12, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6966, 971, 2254, 2, { { 3, 12, 2, 6, -1 }, { 3, 14, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4194, 2297, 1353, 2, { { 10, 8, 2, 12, -1 }, { 10, 12, 2, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4322, 672, 2203, 2, { { 7, 18, 3, 2, -1 }, { 8, 18, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 16384, 2141, 937, 2, { { 9, 0, 6, 2, -1 }, { 11, 0, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -10859, 2874, 1742, 2, { { 5, 11, 9, 3, -1 }, { 5, 12, 9, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9223, 1134, 2194, 2, { { 9, 0, 6, 2, -1 }, { 11, 0, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 170152, 1779, 3048, 2, { { 1, 1, 18, 5, -1 }, { 7, 1, 6, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4775, 2346, 1058, 3, { { 8, 0, 4, 4, -1 }, { 10, 0, 2, 2, 2 }, { 8, 2, 2, 2, 2 } } },
+    { -2234, 863, 2196, 2, { { 3, 12, 1, 3, -1 }, { 3, 13, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -13850, 3110, 1865, 2, { { 8, 14, 5, 3, -1 }, { 8, 15, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -69203, 513, 2189, 3, { { 5, 4, 10, 12, -1 }, { 5, 4, 5, 6, 2 }, { 10, 10, 5, 6, 2 } } },
+    { 8299, 1358, 2294, 2, { { 9, 6, 9, 12, -1 }, { 9, 10, 9, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 21909, 2255, 1134, 3, { { 2, 2, 12, 14, -1 }, { 2, 2, 6, 7, 2 }, { 8, 9, 6, 7, 2 } } },
+    { 1254, 722, 2522, 2, { { 4, 7, 12, 2, -1 }, { 8, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1959, 2506, 751, 2, { { 7, 4, 6, 4, -1 }, { 7, 6, 6, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -205, 406, 2344, 2, { { 4, 5, 11, 8, -1 }, { 4, 9, 11, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -842, 2286, 974, 2, { { 3, 10, 16, 4, -1 }, { 3, 12, 16, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2570, 914, 2400, 2, { { 0, 0, 16, 2, -1 }, { 0, 1, 16, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 528, 1087, 2373, 2, { { 7, 5, 6, 2, -1 }, { 9, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4225, 2377, 1018, 3, { { 3, 2, 6, 10, -1 }, { 3, 2, 3, 5, 2 }, { 6, 7, 3, 5, 2 } } },
+    { -15154, 750, 2246, 2, { { 10, 5, 8, 15, -1 }, { 10, 10, 8, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2137, 1378, 2479, 3, { { 3, 14, 8, 6, -1 }, { 3, 14, 4, 3, 2 }, { 7, 17, 4, 3, 2 } } },
+    { -1694, 937, 2229, 2, { { 14, 2, 2, 2, -1 }, { 14, 3, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3508, 2304, 980, 2, { { 1, 10, 7, 6, -1 }, { 1, 13, 7, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1718, 1600, 2443, 2, { { 15, 4, 4, 3, -1 }, { 15, 4, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 31721, 2150, 645, 3, { { 2, 9, 14, 6, -1 }, { 2, 9, 7, 3, 2 }, { 9, 12, 7, 3, 2 } } },
+    { 39062, 1718, 2764, 2, { { 5, 7, 10, 4, -1 }, { 5, 9, 10, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -26330, 771, 2242, 3, { { 6, 9, 8, 8, -1 }, { 6, 9, 4, 4, 2 }, { 10, 13, 4, 4, 2 } } },
+    { -5568, 549, 2141, 2, { { 14, 1, 3, 2, -1 }, { 14, 2, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1267, 1541, 2503, 2, { { 1, 4, 4, 2, -1 }, { 3, 4, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -22972, 1091, 2213, 2, { { 11, 10, 2, 8, -1 }, { 11, 14, 2, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5675, 2197, 914, 2, { { 0, 0, 5, 3, -1 }, { 0, 1, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 73344, 2195, 1005, 3, { { 2, 5, 18, 8, -1 }, { 11, 5, 9, 4, 2 }, { 2, 9, 9, 4, 2 } } },
+    { 362, 987, 2202, 2, { { 6, 6, 1, 6, -1 }, { 6, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1324, 2222, 1293, 2, { { 19, 1, 1, 3, -1 }, { 19, 2, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 23823, 1703, 2702, 2, { { 7, 6, 6, 6, -1 }, { 9, 6, 2, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1899, 1151, 2255, 2, { { 19, 1, 1, 3, -1 }, { 19, 2, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3510, 2155, 775, 2, { { 3, 13, 2, 3, -1 }, { 3, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 428, 2324, 1370, 3, { { 8, 4, 8, 12, -1 }, { 12, 4, 4, 6, 2 }, { 8, 10, 4, 6, 2 } } },
+    { 13353, 2189, 981, 2, { { 5, 2, 6, 3, -1 }, { 7, 2, 2, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7667, 2462, 1647, 2, { { 6, 1, 9, 10, -1 }, { 6, 6, 9, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -59715, 3358, 1861, 2, { { 0, 4, 6, 12, -1 }, { 2, 4, 2, 12, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5255, 901, 2195, 2, { { 15, 13, 2, 3, -1 }, { 15, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6327, 1808, 2942, 2, { { 7, 14, 5, 3, -1 }, { 7, 15, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4135, 2244, 1143, 2, { { 15, 13, 3, 3, -1 }, { 15, 14, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3837, 2604, 1634, 2, { { 6, 14, 8, 3, -1 }, { 6, 15, 8, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4032, 1431, 2171, 2, { { 15, 13, 3, 3, -1 }, { 15, 14, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7542, 459, 2142, 2, { { 2, 13, 3, 3, -1 }, { 2, 14, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -55364, 978, 2234, 3, { { 4, 7, 12, 12, -1 }, { 10, 7, 6, 6, 2 }, { 4, 13, 6, 6, 2 } } },
+    { -8340, 3108, 1818, 2, { { 9, 7, 2, 6, -1 }, { 10, 7, 1, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2867, 1051, 2248, 2, { { 8, 9, 5, 2, -1 }, { 8, 10, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1941, 2758, 1742, 2, { { 8, 6, 3, 4, -1 }, { 9, 6, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 16692, 2248, 939, 2, { { 9, 6, 2, 8, -1 }, { 9, 10, 2, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1330, 2500, 1648, 2, { { 7, 7, 3, 6, -1 }, { 8, 7, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6594, 2175, 629, 2, { { 11, 3, 3, 3, -1 }, { 12, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6528, 708, 2147, 2, { { 5, 4, 6, 1, -1 }, { 7, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -12722, 2702, 1772, 2, { { 5, 6, 10, 3, -1 }, { 5, 7, 10, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4109, 2500, 602, 2, { { 7, 3, 6, 9, -1 }, { 7, 6, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1675, 1078, 2415, 2, { { 6, 7, 9, 1, -1 }, { 9, 7, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 18644, 2406, 721, 2, { { 2, 8, 16, 8, -1 }, { 2, 12, 16, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 685, 642, 2292, 2, { { 14, 6, 2, 6, -1 }, { 14, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -297, 784, 2348, 2, { { 1, 5, 6, 15, -1 }, { 1, 10, 6, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1689, 1194, 2303, 2, { { 10, 0, 6, 9, -1 }, { 10, 3, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -102499, 796, 2314, 2, { { 6, 6, 7, 14, -1 }, { 6, 13, 7, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 579, 1284, 2255, 2, { { 13, 7, 3, 6, -1 }, { 13, 9, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -13483, 1039, 2359, 2, { { 1, 8, 15, 4, -1 }, { 6, 8, 5, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4355, 2362, 1499, 2, { { 11, 2, 3, 10, -1 }, { 11, 7, 3, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1792, 1165, 2424, 2, { { 3, 7, 4, 6, -1 }, { 3, 9, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7887, 1660, 2533, 2, { { 13, 3, 6, 10, -1 }, { 15, 3, 2, 10, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2357, 2369, 1284, 3, { { 5, 7, 8, 10, -1 }, { 5, 7, 4, 5, 2 }, { 9, 12, 4, 5, 2 } } },
+    { 54532, 2270, 785, 3, { { 4, 4, 12, 12, -1 }, { 10, 4, 6, 6, 2 }, { 4, 10, 6, 6, 2 } } },
+    { 12673, 1652, 2722, 2, { { 1, 4, 6, 9, -1 }, { 3, 4, 2, 9, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 15, 1448, 2339, 2, { { 11, 3, 2, 5, -1 }, { 11, 3, 1, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7, 1244, 2298, 2, { { 7, 3, 2, 5, -1 }, { 8, 3, 1, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4824, 2941, 1876, 2, { { 10, 14, 2, 3, -1 }, { 10, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2103, 2303, 1210, 2, { { 5, 12, 6, 2, -1 }, { 8, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4724, 1890, 3121, 2, { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 12317, 2189, 726, 2, { { 4, 11, 12, 6, -1 }, { 4, 14, 12, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -61149, 691, 2188, 2, { { 11, 11, 5, 9, -1 }, { 11, 14, 5, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 248, 1553, 2469, 2, { { 6, 15, 3, 2, -1 }, { 6, 16, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -8195, 620, 2181, 2, { { 11, 0, 3, 5, -1 }, { 12, 0, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -11404, 853, 2179, 2, { { 5, 5, 6, 7, -1 }, { 8, 5, 3, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2909, 1679, 2134, 2, { { 13, 0, 1, 9, -1 }, { 13, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -821, 2332, 1425, 3, { { 3, 2, 4, 8, -1 }, { 3, 2, 2, 4, 2 }, { 5, 6, 2, 4, 2 } } },
+    { 14544, 2182, 925, 2, { { 13, 12, 4, 6, -1 }, { 13, 14, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -24825, 635, 2130, 2, { { 3, 12, 4, 6, -1 }, { 3, 14, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -16, 2253, 1565, 2, { { 13, 11, 3, 4, -1 }, { 13, 13, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3795, 1736, 2720, 2, { { 4, 4, 4, 3, -1 }, { 4, 5, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -20780, 881, 2205, 2, { { 7, 5, 11, 8, -1 }, { 7, 9, 11, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4001, 2734, 1727, 2, { { 7, 8, 3, 4, -1 }, { 8, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5219, 929, 2206, 2, { { 9, 1, 6, 1, -1 }, { 11, 1, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2353, 1765, 2808, 2, { { 5, 5, 3, 3, -1 }, { 5, 6, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 12879, 2391, 1420, 3, { { 0, 9, 20, 6, -1 }, { 10, 9, 10, 3, 2 }, { 0, 12, 10, 3, 2 } } },
+    { -2994, 2874, 1766, 2, { { 8, 6, 3, 5, -1 }, { 9, 6, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3972, 1186, 2140, 2, { { 11, 0, 1, 3, -1 }, { 11, 1, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1279, 1219, 2245, 2, { { 4, 2, 4, 2, -1 }, { 4, 3, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 10654, 2002, 3352, 2, { { 12, 6, 4, 3, -1 }, { 12, 7, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -16960, 607, 2146, 2, { { 5, 0, 6, 4, -1 }, { 7, 0, 2, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 20230, 1960, 3022, 2, { { 9, 7, 3, 8, -1 }, { 10, 7, 1, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3406, 3020, 1831, 2, { { 9, 7, 2, 2, -1 }, { 10, 7, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -9836, 1429, 2268, 3, { { 6, 7, 14, 4, -1 }, { 13, 7, 7, 2, 2 }, { 6, 9, 7, 2, 2 } } },
+    { -13218, 975, 2177, 2, { { 0, 5, 3, 6, -1 }, { 0, 7, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -26867, 805, 2105, 2, { { 13, 11, 3, 4, -1 }, { 13, 13, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -79, 2290, 1379, 2, { { 4, 11, 3, 4, -1 }, { 4, 13, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -93544, 260, 2115, 3, { { 5, 9, 12, 8, -1 }, { 11, 9, 6, 4, 2 }, { 5, 13, 6, 4, 2 } } },
+    { -2901, 3000, 1839, 2, { { 9, 12, 1, 3, -1 }, { 9, 13, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 285, 1685, 2452, 2, { { 10, 15, 2, 4, -1 }, { 10, 17, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1550, 1091, 2721, 2, { { 7, 7, 6, 1, -1 }, { 9, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1965, 2517, 1032, 3, { { 12, 3, 6, 6, -1 }, { 15, 3, 3, 3, 2 }, { 12, 6, 3, 3, 2 } } },
+    { -1798, 2362, 982, 2, { { 0, 4, 10, 6, -1 }, { 0, 6, 10, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1986, 2327, 1036, 3, { { 8, 3, 8, 14, -1 }, { 12, 3, 4, 7, 2 }, { 8, 10, 4, 7, 2 } } },
+    { -5558, 672, 2276, 2, { { 4, 4, 7, 15, -1 }, { 4, 9, 7, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -48929, 2508, 1951, 3, { { 12, 2, 6, 8, -1 }, { 15, 2, 3, 4, 2 }, { 12, 6, 3, 4, 2 } } },
+    { -833, 2338, 1163, 3, { { 2, 2, 6, 8, -1 }, { 2, 2, 3, 4, 2 }, { 5, 6, 3, 4, 2 } } },
+    { 15615, 1675, 2460, 2, { { 2, 13, 18, 7, -1 }, { 8, 13, 6, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1263, 2340, 1108, 3, { { 4, 3, 8, 14, -1 }, { 4, 3, 4, 7, 2 }, { 8, 10, 4, 7, 2 } } },
+    { 6356, 2156, 1336, 2, { { 18, 1, 2, 6, -1 }, { 18, 3, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2651, 2807, 1720, 2, { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6188, 1338, 2226, 2, { { 18, 1, 2, 6, -1 }, { 18, 3, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5946, 2240, 950, 2, { { 0, 1, 2, 6, -1 }, { 0, 3, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3178, 2282, 1109, 2, { { 1, 5, 18, 6, -1 }, { 1, 7, 18, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3125, 1516, 2413, 2, { { 0, 2, 6, 7, -1 }, { 3, 2, 3, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -79525, 877, 2220, 2, { { 7, 3, 6, 14, -1 }, { 7, 10, 6, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 20198, 2264, 1117, 2, { { 3, 7, 13, 10, -1 }, { 3, 12, 13, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 198, 1621, 2465, 2, { { 11, 15, 2, 2, -1 }, { 11, 16, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 30796, 2147, 588, 3, { { 2, 11, 16, 4, -1 }, { 2, 11, 8, 2, 2 }, { 10, 13, 8, 2, 2 } } },
+    { 1092, 1387, 2429, 3, { { 13, 7, 6, 4, -1 }, { 16, 7, 3, 2, 2 }, { 13, 9, 3, 2, 2 } } },
+    { 2739, 2247, 1238, 2, { { 6, 10, 3, 9, -1 }, { 6, 13, 3, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1017, 1383, 2266, 2, { { 14, 6, 1, 6, -1 }, { 14, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 624, 2307, 1376, 2, { { 5, 10, 4, 1, -1 }, { 7, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -106499, 261, 2142, 2, { { 3, 8, 15, 5, -1 }, { 8, 8, 5, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 37913, 2104, 422, 2, { { 1, 6, 5, 4, -1 }, { 1, 8, 5, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3631, 1589, 2277, 2, { { 3, 1, 17, 6, -1 }, { 3, 3, 17, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 20505, 2150, 768, 2, { { 6, 7, 8, 2, -1 }, { 10, 7, 4, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2424, 2733, 1917, 2, { { 9, 7, 3, 2, -1 }, { 10, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1951, 2934, 1775, 2, { { 8, 7, 3, 2, -1 }, { 9, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -986, 1238, 2314, 2, { { 8, 9, 4, 2, -1 }, { 8, 10, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5496, 745, 2151, 2, { { 8, 8, 4, 3, -1 }, { 8, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 123, 1388, 2231, 2, { { 9, 5, 6, 4, -1 }, { 9, 5, 3, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1246, 1673, 2561, 2, { { 8, 13, 4, 3, -1 }, { 8, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -11410, 1384, 2335, 3, { { 4, 7, 12, 6, -1 }, { 10, 7, 6, 3, 2 }, { 4, 10, 6, 3, 2 } } },
+    { 1820, 1722, 2672, 2, { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6828, 1063, 2223, 2, { { 9, 7, 3, 3, -1 }, { 9, 8, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1273, 2525, 1629, 2, { { 7, 4, 3, 8, -1 }, { 8, 4, 1, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -10857, 667, 2138, 2, { { 10, 0, 3, 6, -1 }, { 11, 0, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 586, 1311, 2254, 2, { { 6, 3, 4, 8, -1 }, { 8, 3, 2, 8, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 16043, 1681, 2508, 2, { { 14, 3, 6, 13, -1 }, { 14, 3, 3, 13, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -22637, 424, 2129, 2, { { 8, 13, 3, 6, -1 }, { 8, 16, 3, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -134581, 3479, 2004, 2, { { 14, 3, 6, 13, -1 }, { 14, 3, 3, 13, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2404, 1282, 2241, 3, { { 0, 7, 10, 4, -1 }, { 0, 7, 5, 2, 2 }, { 5, 9, 5, 2, 2 } } },
+    { 83797, 1989, 2488, 2, { { 14, 3, 6, 13, -1 }, { 14, 3, 3, 13, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -83300, 3438, 1894, 2, { { 0, 3, 6, 13, -1 }, { 3, 3, 3, 13, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5536, 771, 2174, 2, { { 9, 1, 4, 1, -1 }, { 9, 1, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1097, 2159, 1058, 2, { { 8, 0, 2, 1, -1 }, { 9, 0, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 276, 1735, 2349, 3, { { 10, 16, 4, 4, -1 }, { 12, 16, 2, 2, 2 }, { 10, 18, 2, 2, 2 } } },
+    { -3793, 2840, 1841, 2, { { 9, 6, 2, 3, -1 }, { 10, 6, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 11977, 2417, 1695, 2, { { 4, 5, 12, 2, -1 }, { 8, 5, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2093, 2649, 1772, 2, { { 8, 7, 3, 5, -1 }, { 9, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -10453, 2516, 1017, 2, { { 6, 4, 8, 6, -1 }, { 6, 6, 8, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 766, 2337, 951, 2, { { 9, 5, 2, 12, -1 }, { 9, 11, 2, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 672, 865, 2382, 2, { { 4, 6, 6, 8, -1 }, { 4, 10, 6, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4763, 1209, 2403, 2, { { 12, 2, 8, 5, -1 }, { 12, 2, 4, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 97, 1225, 2372, 2, { { 0, 8, 18, 3, -1 }, { 0, 9, 18, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9081, 1152, 2308, 2, { { 8, 12, 4, 8, -1 }, { 8, 16, 4, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 8443, 1448, 2480, 2, { { 0, 2, 8, 5, -1 }, { 4, 2, 4, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 460, 2292, 1119, 2, { { 13, 11, 3, 4, -1 }, { 13, 13, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -103, 2449, 1490, 2, { { 5, 11, 6, 1, -1 }, { 7, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1185, 1129, 2225, 2, { { 11, 3, 3, 1, -1 }, { 12, 3, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6748, 1764, 2896, 2, { { 7, 13, 5, 3, -1 }, { 7, 14, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -59590, 1022, 2169, 2, { { 11, 11, 7, 6, -1 }, { 11, 14, 7, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4264, 2244, 1023, 2, { { 2, 11, 7, 6, -1 }, { 2, 14, 7, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 51, 1613, 2337, 2, { { 12, 14, 2, 6, -1 }, { 12, 16, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6480, 1805, 3029, 2, { { 8, 14, 3, 3, -1 }, { 8, 15, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6814, 2230, 1015, 2, { { 11, 0, 3, 5, -1 }, { 12, 0, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1071, 1042, 2187, 2, { { 6, 1, 4, 9, -1 }, { 8, 1, 2, 9, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5688, 1114, 2181, 2, { { 10, 3, 6, 1, -1 }, { 12, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1107, 1302, 2267, 2, { { 8, 8, 3, 4, -1 }, { 8, 10, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 697, 1755, 2686, 2, { { 8, 12, 4, 2, -1 }, { 8, 13, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -289, 2418, 1561, 2, { { 5, 18, 4, 2, -1 }, { 5, 19, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4435, 1563, 2339, 2, { { 2, 1, 18, 6, -1 }, { 2, 3, 18, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3446, 716, 2154, 2, { { 6, 0, 3, 2, -1 }, { 7, 0, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 164, 1475, 2345, 3, { { 13, 8, 6, 2, -1 }, { 16, 8, 3, 1, 2 }, { 13, 9, 3, 1, 2 } } },
+    { -8, 2213, 1247, 2, { { 6, 10, 3, 6, -1 }, { 6, 13, 3, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -15485, 1319, 2283, 3, { { 0, 13, 20, 4, -1 }, { 10, 13, 10, 2, 2 }, { 0, 15, 10, 2, 2 } } },
+    { 25679, 1762, 2670, 2, { { 7, 7, 6, 5, -1 }, { 9, 7, 2, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -395, 1460, 2293, 2, { { 11, 0, 2, 2, -1 }, { 11, 1, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 8, 1430, 2278, 3, { { 1, 8, 6, 2, -1 }, { 1, 8, 3, 1, 2 }, { 4, 9, 3, 1, 2 } } },
+    { -15833, 728, 2185, 3, { { 0, 2, 20, 2, -1 }, { 10, 2, 10, 1, 2 }, { 0, 3, 10, 1, 2 } } },
+    { -4018, 2519, 1729, 2, { { 7, 14, 5, 3, -1 }, { 7, 15, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 17748, 2217, 887, 3, { { 7, 13, 6, 6, -1 }, { 10, 13, 3, 3, 2 }, { 7, 16, 3, 3, 2 } } },
+    { -3196, 2642, 1784, 2, { { 9, 12, 2, 3, -1 }, { 9, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3370, 2212, 1443, 2, { { 16, 11, 1, 6, -1 }, { 16, 13, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4197, 1136, 2187, 2, { { 3, 11, 1, 6, -1 }, { 3, 13, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7779, 2325, 1517, 3, { { 4, 4, 14, 12, -1 }, { 11, 4, 7, 6, 2 }, { 4, 10, 7, 6, 2 } } },
+    { -9308, 3174, 1877, 2, { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2864, 2187, 1637, 2, { { 12, 3, 3, 3, -1 }, { 13, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2630, 2299, 1547, 2, { { 6, 6, 8, 3, -1 }, { 6, 7, 8, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8445, 1194, 2121, 2, { { 12, 3, 3, 3, -1 }, { 13, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1027, 2268, 1516, 3, { { 3, 1, 4, 10, -1 }, { 3, 1, 2, 5, 2 }, { 5, 6, 2, 5, 2 } } },
+    { -6160, 1538, 2326, 2, { { 5, 7, 10, 2, -1 }, { 5, 7, 5, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4712, 2875, 1835, 2, { { 8, 7, 3, 3, -1 }, { 9, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5703, 946, 2176, 2, { { 15, 12, 2, 3, -1 }, { 15, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -787, 2402, 1691, 2, { { 7, 8, 3, 4, -1 }, { 8, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 15, 1529, 2302, 2, { { 13, 4, 1, 12, -1 }, { 13, 10, 1, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 42738, 2176, 1114, 3, { { 4, 5, 12, 12, -1 }, { 4, 5, 6, 6, 2 }, { 10, 11, 6, 6, 2 } } },
+    { 6974, 1929, 2742, 2, { { 7, 14, 7, 3, -1 }, { 7, 15, 7, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4798, 2117, 671, 2, { { 3, 12, 2, 3, -1 }, { 3, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6844, 2211, 1204, 3, { { 3, 2, 14, 2, -1 }, { 10, 2, 7, 1, 2 }, { 3, 3, 7, 1, 2 } } },
+    { -14324, 2903, 1856, 2, { { 0, 1, 3, 10, -1 }, { 1, 1, 1, 10, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 28688, 2133, 1470, 2, { { 9, 0, 6, 5, -1 }, { 11, 0, 2, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 652, 1436, 2229, 2, { { 5, 7, 6, 2, -1 }, { 8, 7, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -3468, 2400, 1649, 2, { { 7, 1, 6, 10, -1 }, { 7, 6, 6, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -11148, 2762, 1811, 2, { { 1, 1, 18, 3, -1 }, { 7, 1, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 20386, 2164, 736, 2, { { 16, 3, 3, 6, -1 }, { 16, 5, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5773, 2423, 1076, 2, { { 6, 3, 7, 6, -1 }, { 6, 6, 7, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2051, 947, 2352, 2, { { 4, 7, 12, 2, -1 }, { 8, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9324, 679, 2305, 2, { { 0, 4, 17, 10, -1 }, { 0, 9, 17, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 87701, 2221, 802, 2, { { 3, 4, 15, 16, -1 }, { 3, 12, 15, 8, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1288, 1400, 2455, 2, { { 7, 15, 6, 4, -1 }, { 7, 17, 6, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 6043, 1524, 2490, 2, { { 15, 2, 4, 9, -1 }, { 15, 2, 2, 9, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1721, 1056, 2284, 2, { { 2, 3, 3, 2, -1 }, { 2, 4, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3577, 1209, 2259, 2, { { 13, 6, 7, 9, -1 }, { 13, 9, 7, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -11607, 3100, 1834, 2, { { 8, 11, 4, 3, -1 }, { 8, 12, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 36560, 2287, 1093, 3, { { 0, 2, 20, 6, -1 }, { 10, 2, 10, 3, 2 }, { 0, 5, 10, 3, 2 } } },
+    { 689, 2305, 1224, 3, { { 3, 2, 6, 10, -1 }, { 3, 2, 3, 5, 2 }, { 6, 7, 3, 5, 2 } } },
+    { -25521, 1135, 2093, 2, { { 13, 10, 3, 4, -1 }, { 13, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 623, 2286, 1278, 2, { { 4, 10, 3, 4, -1 }, { 4, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2409, 1364, 2326, 2, { { 7, 5, 6, 3, -1 }, { 9, 5, 2, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3964, 1225, 2189, 2, { { 7, 6, 6, 8, -1 }, { 7, 10, 6, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -140726, 600, 2209, 2, { { 0, 11, 20, 6, -1 }, { 0, 14, 20, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 789, 1535, 2332, 3, { { 4, 13, 4, 6, -1 }, { 4, 13, 2, 3, 2 }, { 6, 16, 2, 3, 2 } } },
+    { -42515, 1128, 2246, 3, { { 6, 0, 8, 12, -1 }, { 10, 0, 4, 6, 2 }, { 6, 6, 4, 6, 2 } } },
+    { 1318, 1534, 2358, 2, { { 2, 0, 15, 2, -1 }, { 2, 1, 15, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -7786, 3078, 1937, 2, { { 9, 12, 2, 3, -1 }, { 9, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 534, 2214, 1201, 2, { { 3, 12, 1, 2, -1 }, { 3, 13, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1343, 2527, 1750, 2, { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1924, 839, 2133, 2, { { 7, 3, 3, 1, -1 }, { 8, 3, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 28820, 2152, 686, 2, { { 17, 7, 3, 6, -1 }, { 17, 9, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2346, 2158, 1138, 2, { { 7, 2, 3, 2, -1 }, { 8, 2, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9294, 2849, 1971, 2, { { 11, 4, 5, 3, -1 }, { 11, 5, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4378, 1758, 2601, 2, { { 4, 4, 5, 3, -1 }, { 4, 5, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1793, 1200, 2196, 2, { { 19, 3, 1, 2, -1 }, { 19, 4, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 6850, 1841, 3035, 2, { { 5, 5, 4, 3, -1 }, { 5, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -10001, 1290, 2219, 2, { { 17, 7, 3, 6, -1 }, { 17, 9, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 26540, 2098, 537, 2, { { 0, 7, 3, 6, -1 }, { 0, 9, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 38232, 2120, 1061, 2, { { 14, 2, 6, 9, -1 }, { 14, 5, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 21867, 2104, 648, 2, { { 0, 4, 5, 6, -1 }, { 0, 6, 5, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -914, 2283, 1802, 2, { { 10, 5, 6, 2, -1 }, { 12, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -16, 2273, 1519, 2, { { 4, 5, 6, 2, -1 }, { 6, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -884, 1387, 2275, 2, { { 8, 1, 4, 6, -1 }, { 8, 3, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3779, 2195, 1397, 2, { { 0, 2, 3, 6, -1 }, { 0, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7136, 2509, 1780, 2, { { 6, 6, 8, 3, -1 }, { 6, 7, 8, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -49306, 966, 2127, 2, { { 0, 1, 5, 9, -1 }, { 0, 4, 5, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -38749, 3000, 1950, 2, { { 16, 0, 4, 15, -1 }, { 16, 0, 2, 15, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1095, 2220, 1397, 2, { { 1, 10, 3, 2, -1 }, { 1, 11, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -221, 1156, 2275, 2, { { 14, 4, 1, 10, -1 }, { 14, 9, 1, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -84758, 3740, 1924, 2, { { 0, 1, 4, 12, -1 }, { 2, 1, 2, 12, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -384, 2467, 1630, 2, { { 11, 11, 4, 2, -1 }, { 11, 11, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -132, 2299, 1575, 2, { { 5, 11, 4, 2, -1 }, { 7, 11, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -72128, 926, 2171, 2, { { 3, 8, 15, 5, -1 }, { 8, 8, 5, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 13019, 1669, 2387, 2, { { 0, 0, 6, 10, -1 }, { 3, 0, 3, 10, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4947, 1158, 2158, 2, { { 11, 4, 3, 2, -1 }, { 12, 4, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 39989, 2079, 419, 2, { { 8, 12, 3, 8, -1 }, { 8, 16, 3, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2954, 2527, 1786, 2, { { 8, 14, 5, 3, -1 }, { 8, 15, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8525, 1853, 3115, 2, { { 7, 14, 4, 3, -1 }, { 7, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6297, 2146, 762, 2, { { 11, 4, 3, 2, -1 }, { 12, 4, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 20069, 2134, 955, 3, { { 3, 15, 14, 4, -1 }, { 3, 15, 7, 2, 2 }, { 10, 17, 7, 2, 2 } } },
+    { 17245, 2233, 1337, 3, { { 2, 2, 16, 4, -1 }, { 10, 2, 8, 2, 2 }, { 2, 4, 8, 2, 2 } } },
+    { -39172, 2867, 1857, 2, { { 0, 8, 6, 12, -1 }, { 3, 8, 3, 12, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -20686, 1087, 2217, 2, { { 5, 7, 10, 2, -1 }, { 5, 7, 5, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7023, 1835, 2924, 2, { { 9, 7, 2, 5, -1 }, { 10, 7, 1, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 781, 1733, 2241, 3, { { 13, 7, 6, 4, -1 }, { 16, 7, 3, 2, 2 }, { 13, 9, 3, 2, 2 } } },
+    { 1236, 2188, 1282, 2, { { 0, 13, 8, 2, -1 }, { 0, 14, 8, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 36680, 2097, 1405, 3, { { 13, 7, 6, 4, -1 }, { 16, 7, 3, 2, 2 }, { 13, 9, 3, 2, 2 } } },
+    { 596, 1447, 2240, 3, { { 1, 7, 6, 4, -1 }, { 1, 7, 3, 2, 2 }, { 4, 9, 3, 2, 2 } } },
+    { -11892, 1164, 2191, 2, { { 12, 6, 1, 12, -1 }, { 12, 12, 1, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6945, 2820, 1840, 2, { { 9, 5, 2, 6, -1 }, { 10, 5, 1, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -8405, 700, 2140, 2, { { 14, 12, 2, 3, -1 }, { 14, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1490, 2167, 1226, 2, { { 4, 12, 2, 3, -1 }, { 4, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2915, 2662, 1827, 2, { { 8, 12, 4, 3, -1 }, { 8, 13, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1546, 1335, 2207, 3, { { 5, 2, 2, 4, -1 }, { 5, 2, 1, 2, 2 }, { 6, 4, 1, 2, 2 } } },
+    { -24988, 3084, 1967, 2, { { 5, 5, 11, 3, -1 }, { 5, 6, 11, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7274, 2185, 1336, 2, { { 7, 6, 4, 12, -1 }, { 7, 12, 4, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 8683, 1876, 2350, 2, { { 12, 13, 8, 5, -1 }, { 12, 13, 4, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -10947, 1062, 2144, 2, { { 7, 6, 1, 12, -1 }, { 7, 12, 1, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7550, 1335, 2806, 2, { { 1, 2, 6, 3, -1 }, { 4, 2, 3, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2998, 2392, 1039, 3, { { 9, 5, 6, 10, -1 }, { 12, 5, 3, 5, 2 }, { 9, 10, 3, 5, 2 } } },
+    { 719, 2338, 1152, 3, { { 5, 5, 8, 12, -1 }, { 5, 5, 4, 6, 2 }, { 9, 11, 4, 6, 2 } } },
+    { 8345, 1024, 2271, 2, { { 0, 7, 20, 6, -1 }, { 0, 9, 20, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1271, 977, 2226, 2, { { 4, 2, 2, 2, -1 }, { 4, 3, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 8328, 1620, 2548, 2, { { 4, 18, 12, 2, -1 }, { 8, 18, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2583, 2310, 1226, 2, { { 7, 4, 4, 16, -1 }, { 7, 12, 4, 8, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6333, 896, 2217, 2, { { 7, 6, 7, 8, -1 }, { 7, 10, 7, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1362, 963, 2197, 2, { { 6, 3, 3, 1, -1 }, { 7, 3, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 234, 1558, 2347, 2, { { 11, 15, 2, 4, -1 }, { 11, 17, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1537, 1028, 2154, 2, { { 3, 5, 4, 8, -1 }, { 3, 9, 4, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -852, 2455, 1577, 2, { { 7, 1, 6, 12, -1 }, { 7, 7, 6, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1451, 2327, 1490, 2, { { 4, 6, 6, 2, -1 }, { 6, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -29293, 611, 2203, 2, { { 16, 4, 4, 6, -1 }, { 16, 6, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -492, 1512, 2282, 2, { { 3, 3, 5, 2, -1 }, { 3, 4, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5225, 2768, 1857, 2, { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1973, 2199, 1201, 2, { { 2, 16, 4, 2, -1 }, { 2, 17, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -19994, 676, 2183, 3, { { 7, 13, 6, 6, -1 }, { 10, 13, 3, 3, 2 }, { 7, 16, 3, 3, 2 } } },
+    { -4919, 804, 2097, 2, { { 7, 0, 3, 4, -1 }, { 8, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6268, 1913, 2871, 2, { { 8, 15, 4, 3, -1 }, { 8, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -34921, 473, 2091, 2, { { 0, 4, 4, 6, -1 }, { 0, 6, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 95152, 2109, 535, 2, { { 5, 6, 12, 3, -1 }, { 9, 6, 4, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 981, 1477, 2228, 2, { { 7, 6, 6, 14, -1 }, { 9, 6, 2, 14, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 15626, 2001, 3149, 2, { { 9, 7, 3, 3, -1 }, { 10, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 646, 2194, 1327, 2, { { 6, 12, 2, 4, -1 }, { 6, 14, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -53132, 757, 2142, 2, { { 10, 12, 7, 6, -1 }, { 10, 14, 7, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 720, 1573, 2260, 2, { { 1, 0, 15, 2, -1 }, { 1, 1, 15, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 8778, 1757, 2512, 2, { { 14, 0, 6, 6, -1 }, { 14, 0, 3, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1358, 1193, 2163, 2, { { 5, 3, 3, 1, -1 }, { 6, 3, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -43979, 3094, 1989, 2, { { 14, 0, 6, 6, -1 }, { 14, 0, 3, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -24672, 1163, 2153, 2, { { 0, 3, 20, 10, -1 }, { 0, 8, 20, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 42842, 1995, 2571, 2, { { 14, 0, 6, 6, -1 }, { 14, 0, 3, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -26641, 2908, 1874, 2, { { 0, 0, 6, 6, -1 }, { 3, 0, 3, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -434, 1651, 2240, 2, { { 19, 15, 1, 2, -1 }, { 19, 16, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 22884, 1844, 2772, 2, { { 0, 2, 4, 8, -1 }, { 2, 2, 2, 8, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 14800, 2229, 1553, 3, { { 2, 1, 18, 4, -1 }, { 11, 1, 9, 2, 2 }, { 2, 3, 9, 2, 2 } } },
+    { 70, 1721, 2406, 2, { { 8, 12, 1, 2, -1 }, { 8, 13, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -8328, 1553, 2288, 3, { { 5, 2, 10, 6, -1 }, { 10, 2, 5, 3, 2 }, { 5, 5, 5, 3, 2 } } },
+    { -7565, 2971, 1886, 2, { { 9, 7, 2, 4, -1 }, { 10, 7, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2707, 1922, 2417, 2, { { 9, 7, 3, 3, -1 }, { 10, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 140607, 2109, 741, 2, { { 4, 5, 12, 8, -1 }, { 8, 5, 4, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2408, 2212, 1523, 2, { { 15, 15, 4, 3, -1 }, { 15, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2262, 987, 2109, 2, { { 8, 18, 3, 1, -1 }, { 9, 18, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5159, 2693, 1941, 2, { { 9, 13, 4, 3, -1 }, { 9, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1706, 1717, 2582, 2, { { 7, 13, 4, 3, -1 }, { 7, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 350, 2269, 1516, 2, { { 19, 15, 1, 2, -1 }, { 19, 16, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -27995, 701, 2090, 2, { { 0, 15, 8, 4, -1 }, { 0, 17, 8, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -32046, 780, 2117, 2, { { 9, 3, 6, 4, -1 }, { 11, 3, 2, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2990, 1822, 2586, 2, { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -37970, 1020, 2203, 2, { { 3, 14, 14, 6, -1 }, { 3, 16, 14, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2529, 2204, 1501, 2, { { 6, 3, 6, 6, -1 }, { 6, 6, 6, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -810, 2265, 1451, 2, { { 5, 11, 10, 6, -1 }, { 5, 14, 10, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 309, 1693, 2321, 2, { { 3, 10, 3, 4, -1 }, { 4, 10, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6536, 405, 2129, 2, { { 13, 9, 2, 2, -1 }, { 13, 9, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -27551, 373, 2060, 2, { { 5, 3, 6, 4, -1 }, { 7, 3, 2, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5580, 1936, 2549, 2, { { 9, 7, 3, 3, -1 }, { 10, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4313, 884, 2104, 2, { { 2, 12, 2, 3, -1 }, { 2, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3403, 2216, 1524, 2, { { 9, 8, 3, 12, -1 }, { 9, 12, 3, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -17154, 3190, 1919, 3, { { 3, 14, 4, 6, -1 }, { 3, 14, 2, 3, 2 }, { 5, 17, 2, 3, 2 } } },
+    { 337, 2244, 1737, 2, { { 16, 15, 2, 2, -1 }, { 16, 16, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 676, 2183, 1434, 2, { { 2, 15, 2, 2, -1 }, { 2, 16, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -8274, 2836, 1936, 2, { { 8, 12, 4, 3, -1 }, { 8, 13, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 50684, 2071, 310, 2, { { 0, 7, 20, 1, -1 }, { 10, 7, 10, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -788, 1550, 2269, 2, { { 7, 6, 8, 3, -1 }, { 7, 6, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2617, 1262, 2195, 2, { { 5, 7, 8, 2, -1 }, { 9, 7, 4, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2347, 2717, 1904, 2, { { 9, 7, 3, 5, -1 }, { 10, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1886, 2702, 1781, 2, { { 8, 7, 3, 5, -1 }, { 9, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 9213, 2143, 948, 2, { { 11, 1, 3, 5, -1 }, { 12, 1, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3850, 2132, 1220, 2, { { 6, 2, 3, 6, -1 }, { 7, 2, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -37053, 2965, 1991, 2, { { 14, 14, 6, 5, -1 }, { 14, 14, 3, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -726, 1272, 2142, 2, { { 9, 8, 2, 2, -1 }, { 9, 9, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -3560, 1286, 2134, 2, { { 10, 7, 1, 3, -1 }, { 10, 8, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1034, 1858, 2697, 3, { { 6, 6, 2, 2, -1 }, { 6, 6, 1, 1, 2 }, { 7, 7, 1, 1, 2 } } },
+    { -52600, 739, 2129, 3, { { 2, 11, 18, 4, -1 }, { 11, 11, 9, 2, 2 }, { 2, 13, 9, 2, 2 } } },
+    { -2345, 2972, 1905, 3, { { 6, 6, 2, 2, -1 }, { 6, 6, 1, 1, 2 }, { 7, 7, 1, 1, 2 } } },
+    { 779, 1808, 2416, 2, { { 0, 15, 20, 2, -1 }, { 0, 16, 20, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -980, 1434, 2198, 2, { { 4, 14, 2, 3, -1 }, { 4, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 18348, 2012, 3406, 2, { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1594, 1462, 2200, 2, { { 8, 7, 2, 3, -1 }, { 8, 8, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 818, 1783, 2444, 2, { { 9, 10, 2, 3, -1 }, { 9, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -10480, 2524, 1251, 2, { { 5, 4, 10, 4, -1 }, { 5, 6, 10, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1162, 2383, 1293, 3, { { 9, 7, 6, 4, -1 }, { 12, 7, 3, 2, 2 }, { 9, 9, 3, 2, 2 } } },
+    { 1087, 1045, 2332, 2, { { 4, 7, 3, 6, -1 }, { 4, 9, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 715, 1509, 2431, 3, { { 11, 15, 4, 4, -1 }, { 13, 15, 2, 2, 2 }, { 11, 17, 2, 2, 2 } } },
+    { -714, 955, 2242, 2, { { 7, 8, 4, 2, -1 }, { 7, 9, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 273, 1334, 2321, 2, { { 13, 1, 4, 3, -1 }, { 13, 1, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 541, 1534, 2394, 3, { { 5, 15, 4, 4, -1 }, { 5, 15, 2, 2, 2 }, { 7, 17, 2, 2, 2 } } },
+    { 891, 1401, 2262, 2, { { 9, 5, 4, 7, -1 }, { 9, 5, 2, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1951, 1149, 2202, 2, { { 5, 6, 8, 3, -1 }, { 9, 6, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1576, 1056, 2252, 2, { { 9, 9, 2, 2, -1 }, { 9, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2462, 1710, 2586, 2, { { 7, 15, 5, 3, -1 }, { 7, 16, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -303, 2402, 1660, 2, { { 11, 10, 4, 3, -1 }, { 11, 10, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 9375, 2134, 950, 2, { { 6, 9, 8, 10, -1 }, { 6, 14, 8, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -20267, 1128, 2147, 2, { { 10, 11, 6, 2, -1 }, { 10, 11, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -212, 2344, 1506, 2, { { 4, 11, 6, 2, -1 }, { 7, 11, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2221, 1829, 2270, 2, { { 11, 3, 8, 1, -1 }, { 11, 3, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1861, 1152, 2171, 2, { { 6, 3, 3, 2, -1 }, { 7, 3, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4429, 1802, 2374, 2, { { 14, 5, 6, 5, -1 }, { 14, 5, 3, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -15074, 1221, 2168, 2, { { 7, 5, 2, 12, -1 }, { 7, 11, 2, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -16095, 3156, 1945, 2, { { 8, 11, 4, 3, -1 }, { 8, 12, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 16, 1523, 2284, 2, { { 4, 1, 2, 3, -1 }, { 5, 1, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -9573, 1481, 2165, 2, { { 18, 3, 2, 6, -1 }, { 18, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2361, 2197, 1428, 2, { { 0, 3, 2, 6, -1 }, { 0, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5211, 2838, 1916, 2, { { 9, 12, 2, 3, -1 }, { 9, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -13452, 3159, 1909, 2, { { 7, 13, 4, 3, -1 }, { 7, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9821, 1382, 2192, 2, { { 18, 0, 2, 6, -1 }, { 18, 2, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3403, 2181, 1347, 2, { { 0, 0, 2, 6, -1 }, { 0, 2, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -12293, 2801, 1947, 2, { { 8, 14, 6, 3, -1 }, { 8, 15, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 31, 1463, 2196, 2, { { 7, 4, 2, 4, -1 }, { 8, 4, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -23, 2270, 1455, 2, { { 8, 5, 4, 6, -1 }, { 8, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5335, 2077, 515, 2, { { 6, 4, 2, 2, -1 }, { 7, 4, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 28762, 2158, 666, 3, { { 3, 14, 14, 4, -1 }, { 10, 14, 7, 2, 2 }, { 3, 16, 7, 2, 2 } } },
+    { -6726, 2927, 1878, 3, { { 6, 15, 6, 2, -1 }, { 6, 15, 3, 1, 2 }, { 9, 16, 3, 1, 2 } } },
+    { 3511, 2211, 1431, 2, { { 14, 15, 6, 2, -1 }, { 14, 16, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -86650, 999, 2114, 2, { { 2, 12, 12, 8, -1 }, { 2, 16, 12, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1076, 1592, 2363, 2, { { 7, 7, 7, 2, -1 }, { 7, 8, 7, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1710, 1388, 2190, 2, { { 0, 2, 18, 2, -1 }, { 0, 3, 18, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2574, 1885, 2616, 2, { { 9, 6, 2, 5, -1 }, { 9, 6, 1, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1043, 2363, 1688, 2, { { 7, 5, 3, 8, -1 }, { 8, 5, 1, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 16158, 1998, 2904, 2, { { 9, 6, 3, 4, -1 }, { 10, 6, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1236, 2156, 1186, 2, { { 4, 13, 3, 2, -1 }, { 4, 14, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -29048, 614, 2138, 2, { { 9, 4, 6, 3, -1 }, { 11, 4, 2, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -30939, 102, 2048, 2, { { 5, 4, 6, 3, -1 }, { 7, 4, 2, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 474, 2238, 1651, 2, { { 14, 11, 5, 2, -1 }, { 14, 12, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7526, 1749, 2403, 2, { { 1, 2, 6, 9, -1 }, { 3, 2, 2, 9, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -77786, 2816, 2015, 2, { { 14, 6, 6, 13, -1 }, { 14, 6, 3, 13, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -18092, 1381, 2191, 3, { { 3, 6, 14, 8, -1 }, { 3, 6, 7, 4, 2 }, { 10, 10, 7, 4, 2 } } },
+    { 15573, 1895, 2511, 2, { { 16, 0, 4, 11, -1 }, { 16, 0, 2, 11, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 10488, 2190, 1402, 3, { { 3, 4, 12, 12, -1 }, { 3, 4, 6, 6, 2 }, { 9, 10, 6, 6, 2 } } },
+    { 2112, 1902, 2386, 2, { { 11, 4, 5, 3, -1 }, { 11, 5, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1587, 2128, 1170, 2, { { 4, 11, 4, 2, -1 }, { 4, 12, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3291, 1982, 2441, 2, { { 10, 7, 2, 2, -1 }, { 10, 7, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5395, 3654, 1942, 2, { { 8, 7, 2, 2, -1 }, { 9, 7, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4691, 833, 2186, 2, { { 9, 17, 3, 2, -1 }, { 10, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2058, 1873, 2755, 2, { { 5, 6, 3, 3, -1 }, { 5, 7, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5690, 2159, 1166, 2, { { 10, 0, 3, 3, -1 }, { 11, 0, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 520, 1695, 2342, 3, { { 5, 6, 6, 2, -1 }, { 5, 6, 3, 1, 2 }, { 8, 7, 3, 1, 2 } } },
+    { 9828, 2140, 1149, 2, { { 12, 16, 4, 3, -1 }, { 12, 17, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 634, 2145, 1358, 2, { { 3, 12, 3, 2, -1 }, { 3, 13, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 596, 1856, 2571, 2, { { 9, 12, 3, 2, -1 }, { 9, 13, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 25841, 2102, 826, 3, { { 1, 11, 16, 4, -1 }, { 1, 11, 8, 2, 2 }, { 9, 13, 8, 2, 2 } } },
+    { -10790, 3189, 1997, 2, { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2163, 1757, 2409, 2, { { 4, 4, 5, 3, -1 }, { 4, 5, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5297, 1443, 2165, 2, { { 12, 16, 4, 3, -1 }, { 12, 17, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6050, 2802, 1879, 2, { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -480, 1460, 2247, 2, { { 9, 0, 2, 2, -1 }, { 9, 1, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -796, 1380, 2152, 2, { { 8, 9, 4, 2, -1 }, { 8, 10, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1860, 1402, 2234, 2, { { 8, 8, 4, 3, -1 }, { 8, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8977, 2676, 1837, 2, { { 0, 13, 6, 3, -1 }, { 2, 13, 2, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1812, 2174, 1608, 2, { { 16, 14, 3, 2, -1 }, { 16, 15, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -29569, 2809, 1879, 2, { { 1, 18, 18, 2, -1 }, { 7, 18, 6, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1864, 1654, 2199, 2, { { 16, 14, 3, 2, -1 }, { 16, 15, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 348, 2212, 1518, 2, { { 1, 14, 3, 2, -1 }, { 1, 15, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2767, 1911, 2643, 2, { { 7, 14, 6, 3, -1 }, { 7, 15, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2221, 2423, 1665, 2, { { 5, 14, 8, 3, -1 }, { 5, 15, 8, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -15491, 1492, 2169, 2, { { 10, 6, 4, 14, -1 }, { 10, 6, 2, 14, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -17632, 1091, 2107, 2, { { 6, 6, 4, 14, -1 }, { 8, 6, 2, 14, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6645, 2777, 1987, 2, { { 13, 5, 2, 3, -1 }, { 13, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -47, 2299, 1701, 2, { { 7, 16, 6, 1, -1 }, { 9, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1074, 2443, 1870, 2, { { 9, 12, 3, 3, -1 }, { 9, 13, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2429, 1219, 2125, 2, { { 7, 0, 3, 3, -1 }, { 8, 0, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 558027, 2125, 902, 2, { { 4, 0, 16, 18, -1 }, { 4, 9, 16, 9, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -174515, 764, 2073, 2, { { 1, 1, 16, 14, -1 }, { 1, 8, 16, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 118002, 2135, 485, 2, { { 3, 9, 15, 4, -1 }, { 8, 9, 5, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 9757, 1880, 2796, 2, { { 6, 12, 7, 3, -1 }, { 6, 13, 7, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4850, 1262, 2140, 2, { { 14, 15, 2, 3, -1 }, { 14, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -116565, 861, 2081, 3, { { 2, 3, 16, 14, -1 }, { 2, 3, 8, 7, 2 }, { 10, 10, 8, 7, 2 } } },
+    { -11417, 2361, 1962, 3, { { 16, 2, 4, 18, -1 }, { 18, 2, 2, 9, 2 }, { 16, 11, 2, 9, 2 } } },
+    { 6141, 2075, 640, 2, { { 4, 15, 2, 3, -1 }, { 4, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 57519, 2034, 2962, 3, { { 16, 2, 4, 18, -1 }, { 18, 2, 2, 9, 2 }, { 16, 11, 2, 9, 2 } } },
+    { -11741, 899, 2088, 2, { { 1, 1, 8, 3, -1 }, { 1, 2, 8, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4621, 1957, 2773, 2, { { 8, 11, 4, 3, -1 }, { 8, 12, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -66758, 793, 2081, 2, { { 5, 11, 5, 9, -1 }, { 5, 14, 5, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -10285, 2457, 1970, 2, { { 16, 0, 4, 11, -1 }, { 16, 0, 2, 11, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2277, 1367, 2144, 2, { { 7, 0, 6, 1, -1 }, { 9, 0, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -13962, 2710, 2015, 2, { { 16, 3, 3, 7, -1 }, { 17, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2668, 1839, 2491, 2, { { 1, 3, 3, 7, -1 }, { 2, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 12623, 2216, 1349, 2, { { 7, 8, 6, 12, -1 }, { 7, 12, 6, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -21707, 2793, 1882, 2, { { 0, 0, 4, 11, -1 }, { 2, 0, 2, 11, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 28949, 1897, 2362, 2, { { 14, 0, 6, 20, -1 }, { 14, 0, 3, 20, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1297, 2116, 1079, 2, { { 0, 3, 1, 2, -1 }, { 0, 4, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -39499, 1039, 2162, 3, { { 5, 5, 10, 8, -1 }, { 10, 5, 5, 4, 2 }, { 5, 9, 5, 4, 2 } } },
+    { -1893, 1632, 2260, 3, { { 4, 7, 12, 4, -1 }, { 4, 7, 6, 2, 2 }, { 10, 9, 6, 2, 2 } } },
+    { 4645, 1184, 2595, 2, { { 2, 1, 6, 4, -1 }, { 5, 1, 3, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2497, 2544, 1424, 3, { { 9, 7, 6, 4, -1 }, { 12, 7, 3, 2, 2 }, { 9, 9, 3, 2, 2 } } },
+    { 2403, 923, 2286, 2, { { 5, 6, 2, 6, -1 }, { 5, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1043, 1520, 2429, 3, { { 9, 16, 6, 4, -1 }, { 12, 16, 3, 2, 2 }, { 9, 18, 3, 2, 2 } } },
+    { 809, 2315, 1371, 2, { { 9, 4, 2, 12, -1 }, { 9, 10, 2, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1194, 1257, 2256, 2, { { 7, 1, 6, 18, -1 }, { 9, 1, 2, 18, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -172, 2360, 1515, 2, { { 4, 12, 12, 2, -1 }, { 8, 12, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 31, 1083, 2227, 2, { { 8, 8, 6, 2, -1 }, { 8, 9, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 8994, 2069, 736, 2, { { 8, 0, 3, 6, -1 }, { 9, 0, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -273, 2387, 1821, 2, { { 11, 18, 3, 2, -1 }, { 11, 19, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6439, 1275, 2190, 2, { { 1, 1, 17, 4, -1 }, { 1, 3, 17, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -24208, 1343, 2184, 2, { { 11, 8, 4, 12, -1 }, { 11, 8, 2, 12, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -14936, 3024, 1879, 2, { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 20434, 2153, 932, 2, { { 12, 3, 2, 17, -1 }, { 12, 3, 1, 17, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1014, 2257, 1563, 2, { { 4, 7, 6, 1, -1 }, { 6, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3300, 2222, 1042, 2, { { 18, 3, 2, 3, -1 }, { 18, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -189, 2204, 1395, 2, { { 8, 4, 3, 4, -1 }, { 8, 6, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6319, 1243, 2220, 2, { { 4, 5, 12, 10, -1 }, { 4, 10, 12, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 466, 1635, 2318, 2, { { 5, 18, 4, 2, -1 }, { 7, 18, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2371, 2279, 1614, 2, { { 17, 2, 3, 6, -1 }, { 17, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 53617, 1888, 2916, 2, { { 7, 7, 6, 6, -1 }, { 9, 7, 2, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -18650, 949, 2180, 2, { { 17, 2, 3, 6, -1 }, { 17, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5209, 955, 2098, 2, { { 8, 0, 3, 4, -1 }, { 9, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2167, 1908, 2644, 2, { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7803, 2111, 967, 2, { { 0, 12, 6, 3, -1 }, { 0, 13, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3804, 2548, 1834, 2, { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5613, 753, 2090, 2, { { 3, 12, 2, 3, -1 }, { 3, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 152368, 2108, 629, 2, { { 5, 6, 12, 7, -1 }, { 9, 6, 4, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2558, 2189, 1485, 2, { { 0, 2, 3, 6, -1 }, { 0, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3280, 2546, 1985, 2, { { 14, 6, 1, 3, -1 }, { 14, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1881, 1761, 2386, 2, { { 2, 0, 3, 14, -1 }, { 3, 0, 1, 14, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 38015, 2155, 590, 2, { { 12, 14, 5, 6, -1 }, { 12, 16, 5, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5426, 1436, 2166, 2, { { 4, 14, 5, 6, -1 }, { 4, 16, 5, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 686, 1970, 2508, 3, { { 11, 10, 2, 2, -1 }, { 12, 10, 1, 1, 2 }, { 11, 11, 1, 1, 2 } } },
+    { -27767, 467, 2067, 2, { { 5, 0, 3, 14, -1 }, { 6, 0, 1, 14, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3192, 2602, 1964, 2, { { 10, 15, 2, 3, -1 }, { 10, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3879, 2102, 1023, 2, { { 0, 2, 2, 3, -1 }, { 0, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -385, 2221, 1519, 2, { { 5, 11, 12, 6, -1 }, { 5, 14, 12, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -43392, 776, 2081, 2, { { 6, 11, 3, 9, -1 }, { 6, 14, 3, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1104, 2644, 1959, 3, { { 11, 10, 2, 2, -1 }, { 12, 10, 1, 1, 2 }, { 11, 11, 1, 1, 2 } } },
+    { -2270, 2546, 1843, 2, { { 5, 6, 1, 3, -1 }, { 5, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -595, 1521, 2220, 2, { { 4, 9, 13, 3, -1 }, { 4, 10, 13, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 182199, 2058, 498, 2, { { 1, 7, 15, 6, -1 }, { 6, 7, 5, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3046, 1327, 2204, 2, { { 4, 5, 12, 6, -1 }, { 8, 5, 4, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1290, 1706, 2336, 2, { { 8, 10, 4, 3, -1 }, { 8, 11, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -570, 1579, 2272, 2, { { 15, 14, 1, 3, -1 }, { 15, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8734, 903, 2088, 2, { { 1, 11, 5, 3, -1 }, { 1, 12, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -109, 2297, 1763, 2, { { 7, 1, 7, 12, -1 }, { 7, 7, 7, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 32720, 1893, 2860, 3, { { 0, 1, 6, 10, -1 }, { 0, 1, 3, 5, 2 }, { 3, 6, 3, 5, 2 } } },
+    { 8278, 2158, 929, 2, { { 16, 1, 4, 3, -1 }, { 16, 2, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4577, 2605, 1859, 2, { { 5, 5, 2, 3, -1 }, { 5, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8052, 2161, 1123, 2, { { 12, 2, 3, 5, -1 }, { 13, 2, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -26666, 835, 2077, 2, { { 0, 3, 4, 6, -1 }, { 0, 5, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 860, 1879, 2507, 2, { { 8, 12, 4, 2, -1 }, { 8, 13, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3071, 2077, 831, 2, { { 8, 18, 3, 1, -1 }, { 9, 18, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 47, 1971, 2224, 3, { { 11, 10, 2, 2, -1 }, { 12, 10, 1, 1, 2 }, { 11, 11, 1, 1, 2 } } },
+    { 1380, 1895, 2777, 3, { { 7, 10, 2, 2, -1 }, { 7, 10, 1, 1, 2 }, { 8, 11, 1, 1, 2 } } },
+    { 1664, 2206, 1406, 2, { { 11, 11, 4, 4, -1 }, { 11, 13, 4, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -22586, 106, 2049, 2, { { 8, 12, 3, 8, -1 }, { 9, 12, 1, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 15031, 2131, 652, 2, { { 13, 0, 6, 3, -1 }, { 13, 1, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8796, 2983, 1904, 2, { { 8, 8, 3, 4, -1 }, { 9, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 9637, 2278, 1607, 3, { { 5, 7, 10, 10, -1 }, { 10, 7, 5, 5, 2 }, { 5, 12, 5, 5, 2 } } },
+    { -6129, 2787, 1896, 3, { { 3, 18, 8, 2, -1 }, { 3, 18, 4, 1, 2 }, { 7, 19, 4, 1, 2 } } },
+    { -57365, 1049, 2132, 2, { { 10, 2, 6, 8, -1 }, { 12, 2, 2, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 9557, 2126, 1251, 2, { { 4, 2, 6, 8, -1 }, { 6, 2, 2, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -16332, 530, 2117, 2, { { 11, 0, 3, 7, -1 }, { 12, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -126, 2349, 1733, 2, { { 7, 11, 2, 1, -1 }, { 8, 11, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1287, 2167, 1671, 2, { { 15, 14, 1, 3, -1 }, { 15, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1278, 2693, 1874, 3, { { 7, 15, 2, 2, -1 }, { 7, 15, 1, 1, 2 }, { 8, 16, 1, 1, 2 } } },
+    { -3487, 1486, 2128, 2, { { 15, 14, 1, 3, -1 }, { 15, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -13934, 526, 2066, 2, { { 6, 0, 3, 7, -1 }, { 7, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3548, 2577, 1949, 2, { { 18, 1, 2, 7, -1 }, { 18, 1, 1, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -230207, 609, 2075, 2, { { 2, 0, 8, 20, -1 }, { 2, 10, 8, 10, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5150, 1743, 2321, 2, { { 3, 0, 15, 6, -1 }, { 3, 2, 15, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -197, 1640, 2288, 2, { { 4, 3, 12, 2, -1 }, { 4, 4, 12, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5471, 2461, 1971, 2, { { 16, 0, 4, 5, -1 }, { 16, 0, 2, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1165, 1440, 2166, 2, { { 7, 0, 3, 4, -1 }, { 8, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4618, 1901, 2427, 2, { { 16, 0, 4, 5, -1 }, { 16, 0, 2, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 128970, 2058, 283, 2, { { 1, 7, 6, 13, -1 }, { 3, 7, 2, 13, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -12912, 2410, 2021, 2, { { 16, 0, 4, 5, -1 }, { 16, 0, 2, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4349, 1791, 2414, 2, { { 0, 0, 4, 5, -1 }, { 2, 0, 2, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -3723, 1773, 2210, 2, { { 14, 12, 3, 6, -1 }, { 14, 14, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -20158, 784, 2076, 2, { { 3, 12, 3, 6, -1 }, { 3, 14, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1509, 2174, 1738, 2, { { 16, 1, 4, 3, -1 }, { 16, 2, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7104, 2607, 1860, 3, { { 8, 7, 2, 10, -1 }, { 8, 7, 1, 5, 2 }, { 9, 12, 1, 5, 2 } } },
+    { 7353, 2126, 1240, 2, { { 11, 11, 4, 4, -1 }, { 11, 13, 4, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5664, 2091, 1048, 2, { { 0, 1, 4, 3, -1 }, { 0, 2, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 947, 1924, 2401, 2, { { 13, 4, 1, 3, -1 }, { 13, 5, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 12032, 2070, 626, 2, { { 7, 15, 3, 5, -1 }, { 8, 15, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7028, 2666, 2003, 2, { { 9, 7, 3, 5, -1 }, { 10, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2146, 2557, 1849, 2, { { 8, 7, 3, 5, -1 }, { 9, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -10481, 1406, 2212, 2, { { 10, 6, 4, 14, -1 }, { 10, 6, 2, 14, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -37435, 769, 2078, 2, { { 0, 5, 5, 6, -1 }, { 0, 7, 5, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 478, 1559, 2213, 2, { { 9, 5, 6, 4, -1 }, { 9, 5, 3, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -56896, 2803, 1882, 2, { { 0, 0, 18, 10, -1 }, { 6, 0, 6, 10, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6354, 2254, 1843, 2, { { 10, 6, 4, 14, -1 }, { 10, 6, 2, 14, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6794, 1380, 2175, 2, { { 6, 6, 4, 14, -1 }, { 8, 6, 2, 14, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1567, 2657, 1948, 2, { { 13, 4, 1, 3, -1 }, { 13, 5, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 15, 1653, 2233, 2, { { 5, 1, 2, 3, -1 }, { 6, 1, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -7584, 2616, 1976, 3, { { 18, 1, 2, 18, -1 }, { 19, 1, 1, 9, 2 }, { 18, 10, 1, 9, 2 } } },
+    { -4262, 1223, 2112, 2, { { 2, 1, 4, 3, -1 }, { 2, 2, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 31943, 2057, 2933, 3, { { 18, 1, 2, 18, -1 }, { 19, 1, 1, 9, 2 }, { 18, 10, 1, 9, 2 } } },
+    { -8446, 2659, 1892, 3, { { 1, 14, 4, 6, -1 }, { 1, 14, 2, 3, 2 }, { 3, 17, 2, 3, 2 } } },
+    { 41424, 2110, 1004, 2, { { 10, 11, 7, 6, -1 }, { 10, 13, 7, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8864, 1873, 2619, 3, { { 0, 10, 6, 10, -1 }, { 0, 10, 3, 5, 2 }, { 3, 15, 3, 5, 2 } } },
+    { -1226, 1583, 2246, 2, { { 11, 0, 3, 4, -1 }, { 12, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2943, 2101, 1107, 2, { { 5, 10, 5, 6, -1 }, { 5, 13, 5, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 497, 1660, 2207, 2, { { 14, 6, 1, 8, -1 }, { 14, 10, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 12311, 2169, 1523, 3, { { 1, 7, 18, 6, -1 }, { 1, 7, 9, 3, 2 }, { 10, 10, 9, 3, 2 } } },
+    { 3338, 1962, 2824, 2, { { 9, 7, 2, 2, -1 }, { 9, 7, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 737, 2205, 1605, 2, { { 5, 9, 4, 5, -1 }, { 7, 9, 2, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 17889, 1617, 2926, 2, { { 7, 6, 6, 3, -1 }, { 9, 6, 2, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 22902, 1380, 2494, 2, { { 1, 0, 18, 4, -1 }, { 7, 0, 6, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 257, 1434, 2453, 2, { { 7, 15, 2, 4, -1 }, { 7, 17, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 8732, 1338, 2334, 2, { { 1, 0, 19, 9, -1 }, { 1, 3, 19, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 599, 1247, 2266, 2, { { 3, 7, 3, 6, -1 }, { 3, 9, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 706, 1495, 2324, 3, { { 13, 7, 4, 4, -1 }, { 15, 7, 2, 2, 2 }, { 13, 9, 2, 2, 2 } } },
+    { 36, 1357, 2207, 3, { { 3, 7, 4, 4, -1 }, { 3, 7, 2, 2, 2 }, { 5, 9, 2, 2, 2 } } },
+    { -6141, 1105, 2252, 2, { { 9, 6, 10, 8, -1 }, { 9, 10, 10, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 8924, 2158, 1132, 2, { { 3, 8, 14, 12, -1 }, { 3, 14, 14, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -73209, 1192, 2154, 3, { { 6, 5, 10, 12, -1 }, { 11, 5, 5, 6, 2 }, { 6, 11, 5, 6, 2 } } },
+    { -903, 2414, 1669, 2, { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1019, 1443, 2218, 2, { { 9, 5, 6, 5, -1 }, { 9, 5, 3, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -15, 2221, 1435, 2, { { 9, 4, 2, 4, -1 }, { 9, 6, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 50772, 2127, 1397, 2, { { 9, 5, 6, 5, -1 }, { 9, 5, 3, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1390, 1293, 2185, 2, { { 5, 5, 6, 5, -1 }, { 8, 5, 3, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 16, 1823, 2268, 2, { { 11, 2, 6, 1, -1 }, { 13, 2, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2849, 1242, 2150, 2, { { 3, 2, 6, 1, -1 }, { 5, 2, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3064, 1958, 2706, 2, { { 13, 5, 2, 3, -1 }, { 13, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2077, 1305, 2166, 2, { { 0, 10, 1, 4, -1 }, { 0, 12, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4196, 2627, 1946, 2, { { 13, 5, 2, 3, -1 }, { 13, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4560, 617, 2089, 2, { { 8, 18, 3, 2, -1 }, { 9, 18, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1415, 1768, 2409, 2, { { 6, 15, 9, 2, -1 }, { 6, 16, 9, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 19500, 1940, 3723, 2, { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1946, 1455, 2285, 2, { { 18, 4, 2, 4, -1 }, { 18, 6, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2405, 1843, 2696, 2, { { 5, 5, 2, 3, -1 }, { 5, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 314, 2306, 1629, 2, { { 15, 16, 3, 2, -1 }, { 15, 17, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3718, 2204, 1477, 2, { { 0, 0, 3, 9, -1 }, { 0, 3, 3, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 10077, 2153, 736, 2, { { 9, 7, 3, 3, -1 }, { 9, 8, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6583, 931, 2095, 2, { { 8, 7, 3, 3, -1 }, { 8, 8, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3628, 1895, 2707, 2, { { 9, 5, 2, 6, -1 }, { 9, 5, 1, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1375, 2588, 1817, 2, { { 8, 6, 3, 4, -1 }, { 9, 6, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2818, 2220, 1661, 3, { { 7, 6, 8, 12, -1 }, { 11, 6, 4, 6, 2 }, { 7, 12, 4, 6, 2 } } },
+    { 4102, 2195, 1341, 3, { { 5, 6, 8, 12, -1 }, { 5, 6, 4, 6, 2 }, { 9, 12, 4, 6, 2 } } },
+    { -14897, 3192, 2038, 2, { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 752, 2170, 1459, 2, { { 2, 16, 3, 2, -1 }, { 2, 17, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1744, 1916, 2382, 2, { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3532, 2161, 1412, 2, { { 2, 12, 6, 6, -1 }, { 2, 14, 6, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 13421, 1980, 3061, 2, { { 7, 13, 6, 3, -1 }, { 7, 14, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3555, 1848, 2622, 2, { { 6, 14, 6, 3, -1 }, { 6, 15, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4936, 2185, 1456, 2, { { 14, 15, 5, 3, -1 }, { 14, 16, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1554, 1741, 2365, 2, { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7340, 1230, 2168, 2, { { 14, 15, 5, 3, -1 }, { 14, 16, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 16713, 2076, 686, 2, { { 5, 3, 6, 2, -1 }, { 7, 3, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8009, 1964, 2902, 2, { { 8, 15, 4, 3, -1 }, { 8, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7060, 2103, 886, 2, { { 1, 15, 5, 3, -1 }, { 1, 16, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -13483, 794, 2151, 3, { { 8, 13, 4, 6, -1 }, { 10, 13, 2, 3, 2 }, { 8, 16, 2, 3, 2 } } },
+    { -653, 2329, 1719, 2, { { 7, 8, 3, 3, -1 }, { 8, 8, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -552, 1730, 2224, 2, { { 12, 0, 5, 4, -1 }, { 12, 2, 5, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 11613, 2095, 1030, 3, { { 0, 2, 20, 2, -1 }, { 0, 2, 10, 1, 2 }, { 10, 3, 10, 1, 2 } } },
+    { -38512, 2947, 1986, 2, { { 1, 0, 18, 4, -1 }, { 7, 0, 6, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -296, 1573, 2210, 2, { { 4, 3, 6, 1, -1 }, { 6, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2883, 2432, 1872, 2, { { 4, 18, 13, 2, -1 }, { 4, 19, 13, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 10536, 2105, 1148, 2, { { 2, 10, 3, 6, -1 }, { 2, 12, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8546, 2494, 1899, 3, { { 14, 12, 6, 8, -1 }, { 17, 12, 3, 4, 2 }, { 14, 16, 3, 4, 2 } } },
+    { -7218, 1417, 2152, 3, { { 4, 13, 10, 6, -1 }, { 4, 13, 5, 3, 2 }, { 9, 16, 5, 3, 2 } } },
+    { -15, 2332, 1672, 2, { { 14, 12, 1, 2, -1 }, { 14, 13, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1625, 1782, 2378, 2, { { 8, 13, 4, 3, -1 }, { 8, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7114, 602, 2123, 2, { { 14, 12, 2, 2, -1 }, { 14, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 228, 2168, 1416, 2, { { 4, 12, 2, 2, -1 }, { 4, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 327, 1906, 2434, 2, { { 8, 12, 9, 2, -1 }, { 8, 13, 9, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5716, 1906, 2877, 2, { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -271, 2252, 1544, 2, { { 11, 10, 3, 6, -1 }, { 11, 13, 3, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -18290, 1605, 2235, 2, { { 5, 6, 9, 12, -1 }, { 5, 12, 9, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -47546, 668, 2111, 2, { { 11, 10, 3, 6, -1 }, { 11, 13, 3, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2012, 2108, 1144, 2, { { 6, 10, 3, 6, -1 }, { 6, 13, 3, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6310, 2670, 1948, 2, { { 5, 4, 11, 3, -1 }, { 5, 5, 11, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4270, 2259, 1676, 2, { { 7, 1, 5, 10, -1 }, { 7, 6, 5, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 418, 1296, 2165, 2, { { 2, 8, 18, 2, -1 }, { 2, 9, 18, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6860, 2807, 1906, 2, { { 7, 17, 5, 3, -1 }, { 7, 18, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3654, 2246, 1844, 2, { { 5, 9, 12, 1, -1 }, { 9, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -14362, 2620, 1873, 3, { { 0, 14, 6, 6, -1 }, { 0, 14, 3, 3, 2 }, { 3, 17, 3, 3, 2 } } },
+    { -18190, 1127, 2122, 2, { { 5, 9, 12, 1, -1 }, { 9, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4287, 1362, 2128, 2, { { 3, 9, 12, 1, -1 }, { 7, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9929, 2434, 1987, 2, { { 14, 10, 6, 7, -1 }, { 14, 10, 3, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1791, 1707, 2261, 2, { { 1, 0, 16, 2, -1 }, { 1, 1, 16, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 9941, 2226, 1724, 2, { { 10, 9, 10, 9, -1 }, { 10, 12, 10, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4969, 2624, 1868, 2, { { 0, 1, 10, 2, -1 }, { 5, 1, 5, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 6896, 2136, 925, 2, { { 17, 3, 2, 3, -1 }, { 17, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2274, 1291, 2112, 2, { { 1, 3, 2, 3, -1 }, { 1, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 15372, 1995, 2740, 2, { { 9, 7, 3, 6, -1 }, { 10, 7, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 181, 1462, 2151, 2, { { 6, 5, 4, 3, -1 }, { 8, 5, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -22863, 3615, 2034, 2, { { 7, 5, 6, 6, -1 }, { 9, 5, 2, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -99338, 592, 2073, 3, { { 3, 4, 12, 12, -1 }, { 3, 4, 6, 6, 2 }, { 9, 10, 6, 6, 2 } } },
+    { 5854, 2210, 1736, 2, { { 9, 2, 6, 15, -1 }, { 11, 2, 2, 15, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2047, 1708, 2252, 2, { { 2, 2, 6, 17, -1 }, { 4, 2, 2, 17, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 12740, 1924, 2320, 2, { { 14, 10, 6, 7, -1 }, { 14, 10, 3, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -7882, 2567, 1828, 2, { { 0, 10, 6, 7, -1 }, { 3, 10, 3, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -75149, 1269, 2139, 2, { { 9, 2, 6, 15, -1 }, { 11, 2, 2, 15, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -92581, 332, 2051, 2, { { 5, 2, 6, 15, -1 }, { 7, 2, 2, 15, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 32572, 2112, 525, 2, { { 17, 9, 3, 6, -1 }, { 17, 11, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 48887, 1925, 3016, 2, { { 6, 7, 6, 6, -1 }, { 8, 7, 2, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -12782, 1606, 2261, 3, { { 1, 10, 18, 6, -1 }, { 10, 10, 9, 3, 2 }, { 1, 13, 9, 3, 2 } } },
+    { 13648, 2155, 1509, 2, { { 0, 9, 10, 9, -1 }, { 0, 12, 10, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3665, 2597, 1932, 2, { { 8, 15, 4, 3, -1 }, { 8, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -46, 2184, 1547, 2, { { 5, 12, 3, 4, -1 }, { 5, 14, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -114992, 723, 2129, 2, { { 3, 3, 16, 12, -1 }, { 3, 9, 16, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -947, 2181, 1572, 3, { { 1, 1, 12, 12, -1 }, { 1, 1, 6, 6, 2 }, { 7, 7, 6, 6, 2 } } },
+    { 746, 1904, 2357, 3, { { 10, 4, 2, 4, -1 }, { 11, 4, 1, 2, 2 }, { 10, 6, 1, 2, 2 } } },
+    { -3277, 1326, 2116, 3, { { 0, 9, 10, 2, -1 }, { 0, 9, 5, 1, 2 }, { 5, 10, 5, 1, 2 } } },
+    { 2532, 1961, 2646, 2, { { 9, 11, 3, 3, -1 }, { 9, 12, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 465, 1806, 2462, 2, { { 3, 12, 9, 2, -1 }, { 3, 13, 9, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -237, 1654, 2250, 2, { { 9, 9, 2, 2, -1 }, { 9, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -49180, 2703, 1533, 2, { { 3, 4, 13, 6, -1 }, { 3, 6, 13, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1528, 2369, 1408, 3, { { 9, 7, 6, 4, -1 }, { 12, 7, 3, 2, 2 }, { 9, 9, 3, 2, 2 } } },
+    { 5830, 1484, 2420, 2, { { 1, 0, 6, 8, -1 }, { 4, 0, 3, 8, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 767, 2253, 1177, 2, { { 9, 5, 2, 12, -1 }, { 9, 11, 2, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1396, 1095, 2225, 2, { { 4, 4, 3, 10, -1 }, { 4, 9, 3, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 255, 1579, 2352, 2, { { 6, 17, 8, 3, -1 }, { 6, 18, 8, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3199, 2254, 1418, 2, { { 0, 5, 10, 6, -1 }, { 0, 7, 10, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -720, 1348, 2224, 2, { { 13, 2, 3, 2, -1 }, { 13, 3, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1538, 1470, 2192, 2, { { 7, 5, 4, 5, -1 }, { 9, 5, 2, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 336, 1760, 2335, 2, { { 12, 14, 3, 6, -1 }, { 12, 16, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 777, 2164, 1379, 2, { { 1, 11, 8, 2, -1 }, { 1, 12, 8, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4019, 1868, 2563, 2, { { 7, 13, 6, 3, -1 }, { 7, 14, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -16207, 963, 2101, 2, { { 0, 5, 3, 6, -1 }, { 0, 7, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2810, 2183, 1702, 2, { { 13, 2, 3, 2, -1 }, { 13, 3, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2967, 1750, 2378, 3, { { 4, 14, 4, 6, -1 }, { 4, 14, 2, 3, 2 }, { 6, 17, 2, 3, 2 } } },
+    { -4136, 1193, 2131, 2, { { 13, 2, 3, 2, -1 }, { 13, 3, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2850, 2174, 1469, 2, { { 8, 2, 4, 12, -1 }, { 8, 6, 4, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6195, 1927, 2434, 3, { { 14, 0, 6, 8, -1 }, { 17, 0, 3, 4, 2 }, { 14, 4, 3, 4, 2 } } },
+    { -4429, 877, 2084, 2, { { 7, 17, 3, 2, -1 }, { 8, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4270, 1952, 2802, 2, { { 8, 12, 4, 2, -1 }, { 8, 13, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 10643, 2196, 1535, 3, { { 6, 0, 8, 12, -1 }, { 6, 0, 4, 6, 2 }, { 10, 6, 4, 6, 2 } } },
+    { -198, 2343, 1579, 3, { { 14, 0, 2, 10, -1 }, { 15, 0, 1, 5, 2 }, { 14, 5, 1, 5, 2 } } },
+    { -5124, 1513, 2188, 3, { { 5, 3, 8, 6, -1 }, { 5, 3, 4, 3, 2 }, { 9, 6, 4, 3, 2 } } },
+    { 27429, 2033, 2482, 3, { { 14, 0, 6, 10, -1 }, { 17, 0, 3, 5, 2 }, { 14, 5, 3, 5, 2 } } },
+    { 509, 1818, 2463, 2, { { 9, 14, 1, 2, -1 }, { 9, 15, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 11816, 2148, 754, 2, { { 15, 10, 4, 3, -1 }, { 15, 11, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2948, 2482, 1806, 2, { { 8, 14, 2, 3, -1 }, { 8, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5884, 1594, 2289, 3, { { 3, 13, 14, 4, -1 }, { 10, 13, 7, 2, 2 }, { 3, 15, 7, 2, 2 } } },
+    { 8984, 2076, 845, 2, { { 1, 10, 4, 3, -1 }, { 1, 11, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -400, 2409, 1717, 2, { { 9, 11, 6, 1, -1 }, { 11, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -185, 2267, 1640, 2, { { 5, 11, 6, 1, -1 }, { 7, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6828, 1356, 2230, 2, { { 3, 5, 16, 15, -1 }, { 3, 10, 16, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -69, 2226, 1616, 2, { { 6, 12, 4, 2, -1 }, { 8, 12, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7334, 2294, 1717, 3, { { 4, 4, 12, 10, -1 }, { 10, 4, 6, 5, 2 }, { 4, 9, 6, 5, 2 } } },
+    { -4902, 2738, 1886, 2, { { 8, 6, 3, 4, -1 }, { 9, 6, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 12153, 2194, 1199, 3, { { 8, 12, 4, 8, -1 }, { 10, 12, 2, 4, 2 }, { 8, 16, 2, 4, 2 } } },
+    { 13640, 1917, 2993, 2, { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1154, 1613, 2218, 2, { { 12, 2, 3, 2, -1 }, { 13, 2, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 634, 1738, 2295, 2, { { 8, 15, 3, 2, -1 }, { 8, 16, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -15199, 1487, 2168, 2, { { 6, 0, 9, 14, -1 }, { 9, 0, 3, 14, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5563, 2810, 1893, 2, { { 9, 6, 2, 3, -1 }, { 10, 6, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -858, 1616, 2220, 2, { { 10, 8, 2, 3, -1 }, { 10, 9, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -20004, 804, 2064, 2, { { 0, 9, 4, 6, -1 }, { 0, 11, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 373, 1674, 2299, 2, { { 6, 0, 8, 2, -1 }, { 6, 1, 8, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2064, 1839, 2427, 2, { { 6, 14, 7, 3, -1 }, { 6, 15, 7, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7255, 2186, 1527, 2, { { 8, 10, 8, 9, -1 }, { 8, 13, 8, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3132, 2094, 1219, 2, { { 5, 2, 3, 2, -1 }, { 6, 2, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6529, 2270, 1976, 3, { { 14, 1, 6, 8, -1 }, { 17, 1, 3, 4, 2 }, { 14, 5, 3, 4, 2 } } },
+    { 14002, 1879, 2628, 3, { { 0, 1, 6, 8, -1 }, { 0, 1, 3, 4, 2 }, { 3, 5, 3, 4, 2 } } },
+    { 35133, 2209, 1405, 3, { { 1, 2, 18, 6, -1 }, { 10, 2, 9, 3, 2 }, { 1, 5, 9, 3, 2 } } },
+    { -2652, 698, 2053, 2, { { 9, 3, 2, 1, -1 }, { 10, 3, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1342, 2173, 1924, 3, { { 13, 2, 4, 6, -1 }, { 15, 2, 2, 3, 2 }, { 13, 5, 2, 3, 2 } } },
+    { 7412, 1891, 2636, 2, { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1016, 1980, 2476, 2, { { 13, 5, 1, 3, -1 }, { 13, 6, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4157, 2125, 1324, 2, { { 2, 16, 5, 3, -1 }, { 2, 17, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -23129, 1671, 2130, 3, { { 13, 2, 4, 6, -1 }, { 15, 2, 2, 3, 2 }, { 13, 5, 2, 3, 2 } } },
+    { -702, 2184, 1563, 3, { { 3, 2, 4, 6, -1 }, { 3, 2, 2, 3, 2 }, { 5, 5, 2, 3, 2 } } },
+    { -703, 2316, 1921, 2, { { 13, 5, 1, 2, -1 }, { 13, 6, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 779, 1857, 2575, 2, { { 5, 5, 2, 2, -1 }, { 5, 6, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2331, 2192, 1353, 2, { { 13, 9, 2, 2, -1 }, { 13, 9, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5676, 456, 2050, 2, { { 5, 9, 2, 2, -1 }, { 6, 9, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -15, 2306, 1772, 2, { { 13, 17, 3, 2, -1 }, { 13, 18, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 245, 1706, 2231, 3, { { 6, 16, 4, 4, -1 }, { 6, 16, 2, 2, 2 }, { 8, 18, 2, 2, 2 } } },
+    { 4498, 1991, 2777, 2, { { 9, 16, 2, 3, -1 }, { 9, 17, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6197, 2155, 1480, 2, { { 0, 13, 9, 6, -1 }, { 0, 15, 9, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 13527, 2179, 1331, 2, { { 9, 14, 2, 6, -1 }, { 9, 17, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4927, 1892, 2730, 2, { { 9, 15, 2, 3, -1 }, { 9, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 10947, 2255, 1591, 2, { { 1, 10, 18, 6, -1 }, { 1, 12, 18, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3192, 1924, 2991, 2, { { 8, 11, 4, 2, -1 }, { 8, 12, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -646, 1569, 2238, 2, { { 7, 9, 6, 2, -1 }, { 7, 10, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -3591, 1051, 2085, 2, { { 8, 8, 2, 3, -1 }, { 8, 9, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9808, 2650, 2024, 2, { { 17, 5, 3, 4, -1 }, { 18, 5, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 54881, 1944, 3227, 2, { { 1, 19, 18, 1, -1 }, { 7, 19, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3750, 2174, 1126, 2, { { 9, 0, 3, 2, -1 }, { 10, 0, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 750, 2217, 1656, 2, { { 1, 8, 1, 6, -1 }, { 1, 10, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -11028, 2523, 1972, 2, { { 12, 17, 8, 3, -1 }, { 12, 17, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 8111, 1923, 2879, 2, { { 0, 5, 3, 4, -1 }, { 1, 5, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4533, 1167, 2173, 2, { { 9, 7, 2, 3, -1 }, { 9, 8, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2677, 2891, 1921, 3, { { 7, 11, 2, 2, -1 }, { 7, 11, 1, 1, 2 }, { 8, 12, 1, 1, 2 } } },
+    { 108, 1599, 2283, 2, { { 11, 3, 2, 5, -1 }, { 11, 3, 1, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7, 1509, 2156, 2, { { 7, 3, 2, 5, -1 }, { 8, 3, 1, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1752, 1577, 2207, 2, { { 15, 13, 2, 3, -1 }, { 15, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5165, 1937, 3050, 2, { { 5, 6, 2, 3, -1 }, { 5, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4604, 1970, 2290, 2, { { 4, 19, 15, 1, -1 }, { 9, 19, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -18658, 2828, 1916, 2, { { 1, 19, 15, 1, -1 }, { 6, 19, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2146, 2200, 1355, 2, { { 15, 13, 2, 3, -1 }, { 15, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 31343, 2105, 1355, 2, { { 5, 0, 4, 15, -1 }, { 7, 0, 2, 15, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1625, 1909, 2490, 2, { { 9, 6, 2, 5, -1 }, { 9, 6, 1, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1568, 1804, 2402, 2, { { 9, 5, 2, 7, -1 }, { 10, 5, 1, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1005, 2227, 1724, 2, { { 16, 11, 3, 3, -1 }, { 16, 12, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 521, 2200, 1639, 2, { { 1, 11, 3, 3, -1 }, { 1, 12, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2861, 2318, 1745, 2, { { 6, 6, 8, 3, -1 }, { 6, 7, 8, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2415, 2114, 1373, 2, { { 0, 15, 6, 2, -1 }, { 0, 16, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 263734, 1995, 2928, 2, { { 1, 0, 18, 6, -1 }, { 7, 0, 6, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4858, 1117, 2082, 2, { { 6, 0, 3, 4, -1 }, { 7, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -42399, 2806, 2057, 3, { { 14, 10, 4, 10, -1 }, { 16, 10, 2, 5, 2 }, { 14, 15, 2, 5, 2 } } },
+    { 16, 1755, 2262, 2, { { 3, 2, 3, 2, -1 }, { 4, 2, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -252, 1731, 2208, 2, { { 11, 2, 2, 2, -1 }, { 11, 3, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 24807, 1943, 3074, 3, { { 2, 10, 4, 10, -1 }, { 2, 10, 2, 5, 2 }, { 4, 15, 2, 5, 2 } } },
+    { -8541, 1739, 2269, 3, { { 0, 13, 20, 6, -1 }, { 10, 13, 10, 3, 2 }, { 0, 16, 10, 3, 2 } } },
+    { -3879, 2438, 1855, 2, { { 0, 5, 2, 15, -1 }, { 1, 5, 1, 15, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -7101, 1695, 2242, 3, { { 1, 7, 18, 4, -1 }, { 10, 7, 9, 2, 2 }, { 1, 9, 9, 2, 2 } } },
+    { 4474, 1837, 2375, 2, { { 0, 0, 2, 17, -1 }, { 1, 0, 1, 17, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1866, 2304, 1816, 3, { { 2, 6, 16, 6, -1 }, { 10, 6, 8, 3, 2 }, { 2, 9, 8, 3, 2 } } },
+    { 1759, 1900, 2607, 2, { { 8, 14, 1, 3, -1 }, { 8, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1230, 1861, 2423, 2, { { 8, 15, 4, 2, -1 }, { 8, 16, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 912, 2185, 1592, 3, { { 5, 2, 8, 2, -1 }, { 5, 2, 4, 1, 2 }, { 9, 3, 4, 1, 2 } } },
+    { 801, 2211, 1534, 2, { { 6, 11, 8, 6, -1 }, { 6, 14, 8, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 164, 1769, 2300, 2, { { 9, 13, 2, 2, -1 }, { 9, 14, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -22556, 732, 2124, 2, { { 18, 4, 2, 6, -1 }, { 18, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 137, 1779, 2328, 2, { { 9, 12, 2, 2, -1 }, { 9, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 23060, 2114, 975, 2, { { 18, 4, 2, 6, -1 }, { 18, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -840, 2452, 1829, 2, { { 9, 13, 1, 3, -1 }, { 9, 14, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8676, 1683, 2151, 2, { { 18, 4, 2, 6, -1 }, { 18, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3862, 2119, 1392, 2, { { 0, 4, 2, 6, -1 }, { 0, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8339, 2822, 1985, 2, { { 9, 12, 3, 3, -1 }, { 9, 13, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1613, 2121, 1415, 2, { { 3, 13, 2, 3, -1 }, { 3, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -14726, 687, 2125, 2, { { 13, 13, 4, 3, -1 }, { 13, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1501, 1789, 2317, 2, { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -35667, 3196, 2031, 2, { { 5, 2, 10, 6, -1 }, { 5, 4, 10, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -12612, 649, 2061, 2, { { 3, 13, 4, 3, -1 }, { 3, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 139635, 2115, 1129, 2, { { 3, 7, 15, 5, -1 }, { 8, 7, 5, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1596, 1527, 2136, 2, { { 3, 7, 12, 2, -1 }, { 7, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -985, 2391, 1848, 2, { { 10, 3, 3, 9, -1 }, { 11, 3, 1, 9, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 29066, 1937, 3003, 2, { { 8, 6, 4, 6, -1 }, { 10, 6, 2, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3254, 2172, 1680, 2, { { 9, 7, 4, 3, -1 }, { 9, 8, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 81643, 2047, 521, 2, { { 0, 9, 4, 9, -1 }, { 2, 9, 2, 9, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -16625, 208, 2116, 2, { { 9, 13, 3, 5, -1 }, { 10, 13, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5214, 2785, 1919, 2, { { 7, 7, 6, 3, -1 }, { 9, 7, 2, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1024, 2462, 1962, 2, { { 9, 7, 3, 5, -1 }, { 10, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2584, 1390, 2138, 2, { { 5, 7, 8, 2, -1 }, { 9, 7, 4, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -7124, 1788, 2146, 2, { { 5, 9, 12, 2, -1 }, { 9, 9, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 34192, 2070, 993, 2, { { 5, 6, 10, 3, -1 }, { 10, 6, 5, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -614, 2349, 1949, 2, { { 10, 12, 3, 1, -1 }, { 11, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -31072, 1594, 2156, 2, { { 0, 1, 11, 15, -1 }, { 0, 6, 11, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 48812, 1342, 2556, 2, { { 1, 0, 18, 6, -1 }, { 7, 0, 6, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8340, 1743, 2844, 2, { { 7, 7, 6, 1, -1 }, { 9, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 715, 1520, 2417, 3, { { 5, 16, 6, 4, -1 }, { 5, 16, 3, 2, 2 }, { 8, 18, 3, 2, 2 } } },
+    { -203, 836, 2171, 2, { { 6, 5, 9, 8, -1 }, { 6, 9, 9, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -280, 2218, 1271, 2, { { 5, 10, 2, 6, -1 }, { 5, 13, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2917, 2162, 1420, 3, { { 7, 6, 8, 10, -1 }, { 11, 6, 4, 5, 2 }, { 7, 11, 4, 5, 2 } } },
+    { -491, 2174, 1349, 3, { { 5, 6, 8, 10, -1 }, { 5, 6, 4, 5, 2 }, { 9, 11, 4, 5, 2 } } },
+    { -32, 2365, 1578, 2, { { 9, 5, 2, 2, -1 }, { 9, 6, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 818, 1768, 2519, 2, { { 5, 12, 8, 2, -1 }, { 5, 13, 8, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4462, 1202, 2181, 2, { { 10, 2, 8, 2, -1 }, { 10, 3, 8, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -259, 2240, 1574, 3, { { 4, 0, 2, 10, -1 }, { 4, 0, 1, 5, 2 }, { 5, 5, 1, 5, 2 } } },
+    { -154, 1754, 2357, 2, { { 9, 10, 2, 2, -1 }, { 9, 11, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1244, 1535, 2241, 2, { { 2, 8, 15, 3, -1 }, { 2, 9, 15, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2510, 1859, 2503, 2, { { 8, 13, 4, 3, -1 }, { 8, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1614, 1217, 2126, 2, { { 7, 2, 3, 2, -1 }, { 8, 2, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7546, 2744, 1936, 2, { { 7, 13, 6, 3, -1 }, { 7, 14, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -435, 1386, 2155, 2, { { 9, 9, 2, 2, -1 }, { 9, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4651, 2211, 1606, 2, { { 17, 2, 3, 6, -1 }, { 17, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2790, 1836, 2507, 2, { { 1, 5, 3, 4, -1 }, { 2, 5, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1603, 1520, 2187, 2, { { 14, 8, 4, 6, -1 }, { 14, 10, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4970, 2470, 1825, 2, { { 1, 4, 3, 8, -1 }, { 2, 4, 1, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -15549, 1163, 2188, 2, { { 8, 13, 4, 6, -1 }, { 8, 16, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 968, 2134, 1377, 2, { { 3, 14, 2, 2, -1 }, { 3, 15, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 87587, 2097, 332, 2, { { 14, 8, 4, 6, -1 }, { 14, 10, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -793, 1359, 2126, 2, { { 2, 8, 4, 6, -1 }, { 2, 10, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 10318, 2149, 956, 2, { { 10, 14, 1, 6, -1 }, { 10, 17, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1673, 2355, 1759, 2, { { 7, 5, 3, 6, -1 }, { 8, 5, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 36, 1779, 2279, 3, { { 11, 2, 2, 6, -1 }, { 12, 2, 1, 3, 2 }, { 11, 5, 1, 3, 2 } } },
+    { 31314, 1876, 2695, 2, { { 6, 6, 6, 5, -1 }, { 8, 6, 2, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 11876, 2160, 1505, 2, { { 17, 1, 3, 6, -1 }, { 17, 3, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9210, 2908, 1901, 2, { { 8, 7, 3, 5, -1 }, { 9, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4576, 2162, 1108, 2, { { 9, 18, 3, 2, -1 }, { 10, 18, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4384, 2078, 1003, 2, { { 8, 18, 3, 2, -1 }, { 9, 18, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -479, 1754, 2273, 2, { { 12, 3, 5, 2, -1 }, { 12, 4, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -3894, 2261, 1681, 2, { { 7, 1, 5, 12, -1 }, { 7, 7, 5, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -26533, 2813, 1995, 2, { { 1, 0, 18, 4, -1 }, { 7, 0, 6, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -361, 1527, 2166, 2, { { 4, 2, 2, 2, -1 }, { 4, 3, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -880, 2482, 1891, 3, { { 11, 14, 4, 2, -1 }, { 13, 14, 2, 1, 2 }, { 11, 15, 2, 1, 2 } } },
+    { 18119, 2068, 745, 2, { { 0, 2, 3, 6, -1 }, { 0, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6668, 668, 2143, 2, { { 9, 7, 2, 3, -1 }, { 9, 8, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1080, 1828, 2530, 2, { { 5, 5, 1, 3, -1 }, { 5, 6, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1061, 2242, 1762, 2, { { 10, 10, 6, 1, -1 }, { 10, 10, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -10810, 478, 2048, 2, { { 4, 10, 6, 1, -1 }, { 7, 10, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5734, 1954, 2752, 2, { { 9, 17, 3, 3, -1 }, { 9, 18, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -962, 1422, 2121, 2, { { 4, 14, 1, 3, -1 }, { 4, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2508, 1960, 2546, 2, { { 12, 5, 3, 3, -1 }, { 12, 6, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7924, 2382, 1806, 2, { { 4, 5, 12, 3, -1 }, { 4, 6, 12, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -808, 1588, 2239, 2, { { 9, 8, 2, 3, -1 }, { 9, 9, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9136, 680, 2046, 2, { { 4, 9, 3, 3, -1 }, { 5, 9, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -10807, 1677, 2160, 2, { { 6, 0, 9, 17, -1 }, { 9, 0, 3, 17, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2196, 2542, 1873, 2, { { 9, 12, 1, 3, -1 }, { 9, 13, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7141, 2281, 1702, 2, { { 9, 5, 2, 15, -1 }, { 9, 10, 2, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1127, 2310, 1783, 2, { { 8, 14, 2, 3, -1 }, { 8, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2260, 1977, 2765, 2, { { 10, 14, 1, 3, -1 }, { 10, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 33284, 2068, 771, 2, { { 7, 1, 6, 5, -1 }, { 9, 1, 2, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -82190, 971, 2155, 2, { { 0, 0, 20, 2, -1 }, { 0, 0, 10, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 6020, 2068, 1137, 2, { { 2, 13, 5, 3, -1 }, { 2, 14, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3042, 2555, 1922, 2, { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2771, 1357, 2118, 2, { { 2, 5, 9, 15, -1 }, { 2, 10, 9, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -114816, 975, 2123, 3, { { 5, 0, 12, 10, -1 }, { 11, 0, 6, 5, 2 }, { 5, 5, 6, 5, 2 } } },
+    { 78, 1667, 2196, 2, { { 5, 1, 2, 3, -1 }, { 6, 1, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -531, 2256, 1792, 2, { { 10, 7, 6, 1, -1 }, { 12, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -861, 2263, 1724, 3, { { 3, 1, 2, 10, -1 }, { 3, 1, 1, 5, 2 }, { 4, 6, 1, 5, 2 } } },
+    { -63, 2235, 1945, 2, { { 13, 7, 2, 1, -1 }, { 13, 7, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7137, 2113, 1403, 2, { { 4, 13, 4, 6, -1 }, { 4, 15, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1804, 2053, 2593, 2, { { 13, 7, 2, 1, -1 }, { 13, 7, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -136, 2269, 1731, 2, { { 5, 7, 2, 1, -1 }, { 6, 7, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5035, 1813, 2224, 3, { { 2, 12, 18, 4, -1 }, { 11, 12, 9, 2, 2 }, { 2, 14, 9, 2, 2 } } },
+    { -2663, 2927, 1924, 3, { { 5, 7, 2, 2, -1 }, { 5, 7, 1, 1, 2 }, { 6, 8, 1, 1, 2 } } },
+    { -1497, 1667, 2212, 2, { { 16, 3, 4, 2, -1 }, { 16, 4, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -26364, 3230, 1945, 3, { { 0, 2, 2, 18, -1 }, { 0, 2, 1, 9, 2 }, { 1, 11, 1, 9, 2 } } },
+    { -4079, 1760, 2284, 3, { { 1, 2, 18, 4, -1 }, { 10, 2, 9, 2, 2 }, { 1, 4, 9, 2, 2 } } },
+    { 4608, 1922, 2877, 2, { { 9, 14, 1, 3, -1 }, { 9, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 25877, 2147, 1562, 3, { { 2, 12, 18, 4, -1 }, { 11, 12, 9, 2, 2 }, { 2, 14, 9, 2, 2 } } },
+    { 39896, 2053, 691, 3, { { 0, 12, 18, 4, -1 }, { 0, 12, 9, 2, 2 }, { 9, 14, 9, 2, 2 } } },
+    { 8328, 1978, 2609, 2, { { 11, 4, 5, 3, -1 }, { 11, 5, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1584, 2419, 1838, 2, { { 6, 4, 7, 3, -1 }, { 6, 5, 7, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6732, 2147, 1225, 2, { { 13, 17, 3, 3, -1 }, { 13, 18, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3125, 1246, 2080, 2, { { 8, 1, 3, 4, -1 }, { 9, 1, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -782, 1691, 2153, 2, { { 11, 4, 2, 4, -1 }, { 11, 4, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -10980, 2379, 1841, 2, { { 0, 17, 9, 3, -1 }, { 3, 17, 3, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 9790, 2149, 1089, 3, { { 11, 0, 2, 8, -1 }, { 12, 0, 1, 4, 2 }, { 11, 4, 1, 4, 2 } } },
+    { 29294, 1915, 2903, 3, { { 0, 8, 6, 12, -1 }, { 0, 8, 3, 6, 2 }, { 3, 14, 3, 6, 2 } } },
+    { 7789, 2216, 1539, 2, { { 10, 7, 4, 12, -1 }, { 10, 13, 4, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -24730, 1540, 2146, 2, { { 5, 3, 8, 14, -1 }, { 5, 10, 8, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1201, 1773, 2377, 2, { { 14, 10, 6, 1, -1 }, { 14, 10, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -456, 2163, 1586, 2, { { 0, 4, 10, 4, -1 }, { 0, 6, 10, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 11166, 2008, 2327, 2, { { 10, 0, 5, 8, -1 }, { 10, 4, 5, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -413, 2282, 1769, 3, { { 8, 1, 4, 8, -1 }, { 8, 1, 2, 4, 2 }, { 10, 5, 2, 4, 2 } } },
+    { -139, 2318, 1779, 2, { { 9, 11, 6, 1, -1 }, { 11, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2110, 2481, 1859, 2, { { 8, 9, 3, 4, -1 }, { 9, 9, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2606, 2208, 1695, 2, { { 18, 4, 2, 6, -1 }, { 18, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1912, 1784, 2342, 2, { { 8, 8, 3, 4, -1 }, { 9, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -17466, 1233, 2137, 2, { { 7, 1, 13, 3, -1 }, { 7, 2, 13, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 843, 2171, 1564, 2, { { 7, 13, 6, 1, -1 }, { 9, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3583, 2182, 1737, 2, { { 12, 11, 3, 6, -1 }, { 12, 13, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -380, 2249, 1715, 2, { { 5, 11, 6, 1, -1 }, { 7, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -121950, 590, 2141, 3, { { 1, 4, 18, 10, -1 }, { 10, 4, 9, 5, 2 }, { 1, 9, 9, 5, 2 } } },
+    { -15409, 3173, 1932, 2, { { 8, 6, 4, 9, -1 }, { 8, 9, 4, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2304, 2194, 1358, 2, { { 8, 6, 4, 3, -1 }, { 8, 7, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -492, 2362, 1826, 2, { { 8, 7, 3, 3, -1 }, { 9, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6831, 2136, 1494, 2, { { 14, 15, 4, 3, -1 }, { 14, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 22335, 2046, 642, 2, { { 5, 10, 3, 10, -1 }, { 6, 10, 1, 10, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3343, 1942, 2575, 2, { { 8, 15, 4, 3, -1 }, { 8, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 944, 2191, 1615, 2, { { 0, 8, 1, 6, -1 }, { 0, 10, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5429, 2755, 2053, 2, { { 10, 15, 1, 3, -1 }, { 10, 16, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4589, 1272, 2101, 2, { { 2, 15, 4, 3, -1 }, { 2, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2758, 2001, 2357, 3, { { 18, 3, 2, 8, -1 }, { 19, 3, 1, 4, 2 }, { 18, 7, 1, 4, 2 } } },
+    { -2145, 2468, 1867, 3, { { 0, 3, 2, 8, -1 }, { 0, 3, 1, 4, 2 }, { 1, 7, 1, 4, 2 } } },
+    { 72858, 2147, 895, 3, { { 3, 7, 14, 10, -1 }, { 10, 7, 7, 5, 2 }, { 3, 12, 7, 5, 2 } } },
+    { 25217, 2053, 856, 2, { { 0, 7, 19, 3, -1 }, { 0, 8, 19, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3261, 1993, 2912, 2, { { 12, 6, 3, 3, -1 }, { 12, 7, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1311, 1396, 2112, 2, { { 0, 6, 1, 3, -1 }, { 0, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1078, 2284, 1818, 2, { { 12, 6, 3, 3, -1 }, { 12, 7, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9321, 2622, 1893, 2, { { 5, 6, 3, 3, -1 }, { 5, 7, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -641, 1543, 2232, 2, { { 8, 2, 4, 2, -1 }, { 8, 3, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6049, 1359, 2103, 2, { { 6, 3, 4, 12, -1 }, { 8, 3, 2, 12, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1941, 2009, 2624, 2, { { 13, 6, 2, 3, -1 }, { 13, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -104647, 629, 2054, 2, { { 0, 10, 20, 4, -1 }, { 0, 12, 20, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -368347, 241, 2119, 2, { { 2, 0, 17, 14, -1 }, { 2, 7, 17, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -47442, 2851, 1916, 3, { { 0, 0, 6, 10, -1 }, { 0, 0, 3, 5, 2 }, { 3, 5, 3, 5, 2 } } },
+    { 74954, 2117, 425, 2, { { 14, 6, 6, 4, -1 }, { 14, 6, 3, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2296, 1750, 2266, 2, { { 0, 6, 6, 4, -1 }, { 3, 6, 3, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -621, 1900, 2161, 2, { { 13, 2, 7, 2, -1 }, { 13, 3, 7, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1760, 2172, 1611, 2, { { 0, 2, 7, 2, -1 }, { 0, 3, 7, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2324, 2306, 1948, 3, { { 6, 11, 14, 2, -1 }, { 13, 11, 7, 1, 2 }, { 6, 12, 7, 1, 2 } } },
+    { 121, 1764, 2267, 3, { { 8, 5, 2, 2, -1 }, { 8, 5, 1, 1, 2 }, { 9, 6, 1, 1, 2 } } },
+    { -7552, 592, 2127, 2, { { 13, 9, 2, 3, -1 }, { 13, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 934, 1796, 2291, 2, { { 1, 1, 3, 12, -1 }, { 2, 1, 1, 12, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 206, 2187, 1928, 2, { { 17, 4, 1, 3, -1 }, { 17, 5, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 545, 2136, 1561, 2, { { 2, 4, 1, 3, -1 }, { 2, 5, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 992, 1954, 2511, 2, { { 14, 5, 1, 3, -1 }, { 14, 6, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 96, 1739, 2224, 2, { { 7, 16, 2, 3, -1 }, { 7, 17, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2289, 2235, 1717, 3, { { 8, 13, 4, 6, -1 }, { 10, 13, 2, 3, 2 }, { 8, 16, 2, 3, 2 } } },
+    { -902, 2361, 1832, 2, { { 5, 5, 1, 3, -1 }, { 5, 6, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -13879, 2610, 1923, 2, { { 16, 0, 4, 20, -1 }, { 16, 0, 2, 20, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 455, 2178, 1616, 3, { { 5, 1, 2, 6, -1 }, { 5, 1, 1, 3, 2 }, { 6, 4, 1, 3, 2 } } },
+    { -26054, 2685, 1587, 2, { { 5, 4, 10, 4, -1 }, { 5, 6, 10, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 6433, 1535, 2447, 2, { { 15, 2, 4, 12, -1 }, { 15, 2, 2, 12, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 6763, 2222, 1044, 2, { { 7, 6, 4, 12, -1 }, { 7, 12, 4, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 666, 1009, 2207, 2, { { 14, 5, 1, 8, -1 }, { 14, 9, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1471, 2291, 1445, 3, { { 1, 4, 14, 10, -1 }, { 1, 4, 7, 5, 2 }, { 8, 9, 7, 5, 2 } } },
+    { 315, 1621, 2362, 3, { { 11, 6, 6, 14, -1 }, { 14, 6, 3, 7, 2 }, { 11, 13, 3, 7, 2 } } },
+    { 105, 1515, 2267, 3, { { 3, 6, 6, 14, -1 }, { 3, 6, 3, 7, 2 }, { 6, 13, 3, 7, 2 } } },
+    { -5331, 1520, 2272, 2, { { 4, 9, 15, 2, -1 }, { 9, 9, 5, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -20486, 3069, 1876, 2, { { 7, 14, 6, 3, -1 }, { 7, 15, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8, 2314, 1599, 3, { { 6, 3, 14, 4, -1 }, { 13, 3, 7, 2, 2 }, { 6, 5, 7, 2, 2 } } },
+    { -3783, 1385, 2158, 2, { { 1, 9, 15, 2, -1 }, { 6, 9, 5, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2170, 2261, 1521, 2, { { 6, 11, 8, 9, -1 }, { 6, 14, 8, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -487, 2297, 1685, 2, { { 7, 4, 3, 8, -1 }, { 8, 4, 1, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 792, 1458, 2183, 2, { { 14, 6, 2, 6, -1 }, { 14, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1031, 2218, 1541, 3, { { 5, 7, 6, 4, -1 }, { 5, 7, 3, 2, 2 }, { 8, 9, 3, 2, 2 } } },
+    { -20909, 2600, 1927, 2, { { 1, 1, 18, 19, -1 }, { 7, 1, 6, 19, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3951, 1603, 2279, 2, { { 1, 2, 6, 5, -1 }, { 4, 2, 3, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -9912, 1046, 2136, 2, { { 12, 17, 6, 2, -1 }, { 12, 18, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3100, 2120, 1255, 2, { { 2, 17, 6, 2, -1 }, { 2, 18, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 9550, 2207, 1182, 2, { { 17, 3, 3, 6, -1 }, { 17, 5, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1910, 1776, 2397, 2, { { 8, 17, 3, 3, -1 }, { 8, 18, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 15402, 2166, 1176, 2, { { 10, 13, 2, 6, -1 }, { 10, 16, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -15087, 2875, 1904, 2, { { 7, 13, 6, 3, -1 }, { 7, 14, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -19909, 1223, 2149, 2, { { 17, 3, 3, 6, -1 }, { 17, 5, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1209, 1771, 2430, 2, { { 8, 13, 2, 3, -1 }, { 8, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 11465, 2165, 1282, 2, { { 9, 3, 6, 2, -1 }, { 11, 3, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -15658, 1089, 2082, 2, { { 0, 3, 3, 6, -1 }, { 0, 5, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -314, 2238, 1532, 2, { { 8, 5, 4, 6, -1 }, { 8, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4370, 1927, 3046, 2, { { 5, 5, 3, 2, -1 }, { 5, 6, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6701, 848, 2163, 2, { { 10, 1, 3, 4, -1 }, { 11, 1, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4722, 2123, 1427, 2, { { 1, 2, 5, 9, -1 }, { 1, 5, 5, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9651, 2787, 2020, 2, { { 13, 6, 2, 3, -1 }, { 13, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 85278, 2072, 923, 2, { { 0, 6, 14, 3, -1 }, { 7, 6, 7, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -158118, 1214, 2156, 2, { { 2, 11, 18, 8, -1 }, { 2, 15, 18, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3479, 1907, 2897, 2, { { 5, 6, 2, 3, -1 }, { 5, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 812, 1958, 2322, 3, { { 10, 6, 4, 2, -1 }, { 12, 6, 2, 1, 2 }, { 10, 7, 2, 1, 2 } } },
+    { 715, 1756, 2344, 3, { { 6, 6, 4, 2, -1 }, { 6, 6, 2, 1, 2 }, { 8, 7, 2, 1, 2 } } },
+    { 5628, 2171, 1276, 2, { { 10, 1, 3, 4, -1 }, { 11, 1, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 102, 1505, 2158, 2, { { 7, 1, 2, 7, -1 }, { 8, 1, 1, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -131429, 963, 2149, 2, { { 4, 2, 15, 14, -1 }, { 4, 9, 15, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5507, 2915, 1923, 2, { { 8, 7, 3, 2, -1 }, { 9, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8215, 1828, 2216, 3, { { 2, 3, 18, 4, -1 }, { 11, 3, 9, 2, 2 }, { 2, 5, 9, 2, 2 } } },
+    { -1186, 2435, 1809, 2, { { 9, 7, 2, 2, -1 }, { 10, 7, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1846, 2193, 1628, 2, { { 13, 9, 2, 3, -1 }, { 13, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -855, 1540, 2156, 2, { { 5, 2, 6, 2, -1 }, { 7, 2, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4057, 2585, 1946, 2, { { 9, 5, 2, 7, -1 }, { 9, 5, 1, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1595, 2142, 1377, 2, { { 5, 9, 2, 3, -1 }, { 6, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 572383, 2116, 480, 2, { { 6, 0, 14, 18, -1 }, { 6, 9, 14, 9, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 16410, 2040, 571, 2, { { 2, 16, 6, 3, -1 }, { 2, 17, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -12302, 2920, 2016, 2, { { 9, 7, 3, 6, -1 }, { 10, 7, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6477, 937, 2068, 2, { { 7, 8, 4, 3, -1 }, { 7, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2355, 1897, 2478, 2, { { 7, 12, 6, 3, -1 }, { 7, 13, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5444, 2649, 1885, 2, { { 9, 12, 2, 3, -1 }, { 9, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -24985, 607, 2141, 2, { { 7, 12, 6, 2, -1 }, { 9, 12, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1078, 2103, 1383, 2, { { 5, 11, 4, 6, -1 }, { 5, 14, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -10568, 1123, 2172, 2, { { 11, 12, 7, 2, -1 }, { 11, 13, 7, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2744, 2184, 1627, 3, { { 6, 10, 8, 6, -1 }, { 6, 10, 4, 3, 2 }, { 10, 13, 4, 3, 2 } } },
+    { 570, 2198, 1664, 2, { { 11, 10, 3, 4, -1 }, { 11, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5611, 1906, 2822, 2, { { 9, 16, 2, 3, -1 }, { 9, 17, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1602, 2232, 1485, 2, { { 13, 3, 1, 9, -1 }, { 13, 6, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -84541, 678, 2048, 2, { { 1, 13, 14, 6, -1 }, { 1, 15, 14, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 23270, 2102, 820, 2, { { 13, 6, 1, 6, -1 }, { 13, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7665, 1892, 2608, 2, { { 0, 4, 3, 8, -1 }, { 1, 4, 1, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6718, 2423, 1994, 2, { { 18, 0, 2, 18, -1 }, { 18, 0, 1, 18, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -801, 1593, 2177, 2, { { 2, 3, 6, 2, -1 }, { 2, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 805, 1704, 2296, 2, { { 9, 0, 8, 6, -1 }, { 9, 2, 8, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 645, 1265, 2097, 2, { { 6, 6, 1, 6, -1 }, { 6, 9, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5254, 1627, 2133, 2, { { 14, 8, 6, 3, -1 }, { 14, 9, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9113, 2563, 1888, 2, { { 0, 0, 2, 18, -1 }, { 1, 0, 1, 18, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -17188, 854, 2147, 3, { { 1, 18, 18, 2, -1 }, { 10, 18, 9, 1, 2 }, { 1, 19, 9, 1, 2 } } },
+    { 430, 2139, 1548, 2, { { 3, 15, 2, 2, -1 }, { 3, 16, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2647, 2377, 1889, 2, { { 8, 14, 5, 3, -1 }, { 8, 15, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 534, 1803, 2395, 2, { { 8, 14, 2, 3, -1 }, { 8, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2061, 2180, 1714, 2, { { 12, 3, 3, 3, -1 }, { 13, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 590, 1533, 2144, 2, { { 7, 5, 6, 2, -1 }, { 9, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -712, 1897, 2194, 2, { { 15, 5, 5, 2, -1 }, { 15, 6, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7640, 2066, 974, 2, { { 0, 5, 5, 2, -1 }, { 0, 6, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -18308, 2986, 2069, 2, { { 17, 14, 1, 6, -1 }, { 17, 17, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -26657, 2731, 1916, 2, { { 2, 9, 9, 3, -1 }, { 5, 9, 3, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1641, 1799, 2181, 2, { { 12, 3, 3, 3, -1 }, { 13, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 12000, 1780, 2327, 2, { { 0, 0, 4, 18, -1 }, { 2, 0, 2, 18, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -706, 1834, 2170, 2, { { 17, 6, 1, 3, -1 }, { 17, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 9772, 1942, 3057, 2, { { 2, 14, 1, 6, -1 }, { 2, 17, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 140, 2198, 1946, 2, { { 19, 8, 1, 2, -1 }, { 19, 9, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -8264, 718, 2054, 2, { { 5, 3, 3, 3, -1 }, { 6, 3, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6080, 2978, 2005, 2, { { 9, 16, 2, 3, -1 }, { 9, 17, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -408, 1640, 2189, 2, { { 2, 6, 1, 3, -1 }, { 2, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2023, 2296, 1968, 3, { { 12, 4, 8, 2, -1 }, { 16, 4, 4, 1, 2 }, { 12, 5, 4, 1, 2 } } },
+    { 8830, 1947, 3123, 3, { { 0, 4, 8, 2, -1 }, { 0, 4, 4, 1, 2 }, { 4, 5, 4, 1, 2 } } },
+    { 8562, 2209, 1717, 2, { { 2, 16, 18, 4, -1 }, { 2, 18, 18, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 506, 1737, 2212, 2, { { 7, 15, 2, 4, -1 }, { 7, 17, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2851, 1739, 2222, 2, { { 4, 0, 14, 3, -1 }, { 4, 1, 14, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -13115, 2415, 1864, 2, { { 0, 0, 4, 20, -1 }, { 2, 0, 2, 20, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -25466, 1084, 2125, 3, { { 12, 4, 4, 8, -1 }, { 14, 4, 2, 4, 2 }, { 12, 8, 2, 4, 2 } } },
+    { -3112, 3010, 1945, 3, { { 6, 7, 2, 2, -1 }, { 6, 7, 1, 1, 2 }, { 7, 8, 1, 1, 2 } } },
+    { -13138, 1129, 2121, 2, { { 10, 6, 2, 3, -1 }, { 10, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1059, 1438, 2107, 2, { { 8, 7, 3, 2, -1 }, { 8, 8, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2239, 2309, 1912, 2, { { 8, 2, 6, 12, -1 }, { 8, 8, 6, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 20515, 1890, 2514, 2, { { 4, 0, 11, 12, -1 }, { 4, 4, 11, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -101865, 1228, 2127, 2, { { 14, 9, 6, 11, -1 }, { 16, 9, 2, 11, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4720, 2080, 1248, 2, { { 0, 14, 4, 3, -1 }, { 0, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6680, 1991, 2821, 2, { { 9, 10, 2, 3, -1 }, { 9, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9513, 685, 2055, 2, { { 5, 11, 3, 2, -1 }, { 5, 12, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5614, 1103, 2147, 2, { { 9, 15, 3, 3, -1 }, { 10, 15, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -11464, 2943, 1940, 2, { { 8, 8, 3, 4, -1 }, { 9, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8636, 2140, 979, 2, { { 9, 15, 3, 3, -1 }, { 10, 15, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1053, 2343, 1816, 2, { { 7, 7, 3, 2, -1 }, { 8, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4284, 2242, 1699, 3, { { 2, 10, 16, 4, -1 }, { 10, 10, 8, 2, 2 }, { 2, 12, 8, 2, 2 } } },
+    { 162376, 2037, 250, 2, { { 2, 3, 4, 17, -1 }, { 4, 3, 2, 17, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 219, 1929, 2222, 2, { { 15, 13, 2, 7, -1 }, { 15, 13, 1, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 349, 1675, 2171, 2, { { 2, 2, 6, 1, -1 }, { 5, 2, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -11339, 2500, 2031, 2, { { 5, 2, 12, 4, -1 }, { 9, 2, 4, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 47874, 2077, 1174, 3, { { 6, 0, 8, 12, -1 }, { 6, 0, 4, 6, 2 }, { 10, 6, 4, 6, 2 } } },
+    { 1318, 1985, 2588, 3, { { 13, 7, 2, 2, -1 }, { 14, 7, 1, 1, 2 }, { 13, 8, 1, 1, 2 } } },
+    { -125987, 248, 2040, 2, { { 0, 12, 20, 6, -1 }, { 0, 14, 20, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -110, 2197, 1928, 2, { { 14, 7, 2, 3, -1 }, { 14, 7, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -217089, 244, 2039, 2, { { 0, 8, 9, 12, -1 }, { 3, 8, 3, 12, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 135, 1930, 2203, 2, { { 3, 0, 16, 2, -1 }, { 3, 0, 8, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 407, 1787, 2267, 2, { { 6, 15, 3, 3, -1 }, { 6, 16, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3066, 2380, 1976, 2, { { 8, 15, 6, 3, -1 }, { 8, 16, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 880, 2176, 1654, 2, { { 0, 10, 1, 6, -1 }, { 0, 12, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1999, 1544, 2155, 2, { { 10, 9, 4, 3, -1 }, { 10, 10, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 9386, 1952, 3147, 2, { { 9, 15, 2, 3, -1 }, { 9, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 13719, 2156, 1254, 2, { { 5, 7, 10, 1, -1 }, { 5, 7, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -221872, 2760, 1923, 2, { { 4, 0, 12, 19, -1 }, { 10, 0, 6, 19, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3302, 2312, 1797, 3, { { 0, 6, 20, 6, -1 }, { 10, 6, 10, 3, 2 }, { 0, 9, 10, 3, 2 } } },
+    { 417, 1854, 2415, 3, { { 3, 6, 2, 2, -1 }, { 3, 6, 1, 1, 2 }, { 4, 7, 1, 1, 2 } } },
+    { -1449, 2487, 2024, 3, { { 15, 6, 2, 2, -1 }, { 16, 6, 1, 1, 2 }, { 15, 7, 1, 1, 2 } } },
+    { -609, 2457, 1847, 3, { { 3, 6, 2, 2, -1 }, { 3, 6, 1, 1, 2 }, { 4, 7, 1, 1, 2 } } },
+    { -2507, 1723, 2140, 2, { { 14, 4, 1, 12, -1 }, { 14, 10, 1, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 28594, 2133, 1460, 3, { { 2, 5, 16, 10, -1 }, { 2, 5, 8, 5, 2 }, { 10, 10, 8, 5, 2 } } },
+    { -3949, 1288, 2138, 2, { { 9, 17, 3, 2, -1 }, { 10, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1563, 1385, 2099, 2, { { 1, 4, 2, 2, -1 }, { 1, 5, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -18275, 2388, 2015, 2, { { 5, 0, 15, 5, -1 }, { 10, 0, 5, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -16020, 2524, 1891, 2, { { 0, 0, 15, 5, -1 }, { 5, 0, 5, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 33550, 2116, 702, 2, { { 11, 2, 2, 17, -1 }, { 11, 2, 1, 17, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4012, 1396, 2102, 2, { { 7, 2, 2, 17, -1 }, { 8, 2, 1, 17, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -8932, 2501, 2047, 2, { { 15, 11, 2, 9, -1 }, { 15, 11, 1, 9, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 950, 1772, 2287, 2, { { 3, 11, 2, 9, -1 }, { 4, 11, 1, 9, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 10847, 1989, 2233, 2, { { 5, 16, 14, 4, -1 }, { 5, 16, 7, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 8282, 1365, 2436, 2, { { 1, 4, 18, 1, -1 }, { 7, 4, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1696, 1430, 2285, 3, { { 13, 7, 6, 4, -1 }, { 16, 7, 3, 2, 2 }, { 13, 9, 3, 2, 2 } } },
+    { -581, 2270, 1348, 2, { { 9, 8, 2, 12, -1 }, { 9, 12, 2, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1618, 1480, 2272, 2, { { 12, 1, 6, 6, -1 }, { 12, 3, 6, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1083, 1446, 2284, 3, { { 5, 2, 6, 6, -1 }, { 5, 2, 3, 3, 2 }, { 8, 5, 3, 3, 2 } } },
+    { 815, 1604, 2312, 3, { { 9, 16, 6, 4, -1 }, { 12, 16, 3, 2, 2 }, { 9, 18, 3, 2, 2 } } },
+    { 150159, 1912, 2877, 2, { { 1, 2, 18, 3, -1 }, { 7, 2, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7745, 1259, 2166, 2, { { 7, 4, 9, 10, -1 }, { 7, 9, 9, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -660, 2303, 1654, 2, { { 5, 9, 4, 4, -1 }, { 7, 9, 2, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 827, 2158, 1457, 2, { { 11, 10, 3, 6, -1 }, { 11, 13, 3, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -12822, 2731, 1895, 2, { { 7, 11, 5, 3, -1 }, { 7, 12, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3714, 2262, 1585, 3, { { 7, 11, 6, 6, -1 }, { 10, 11, 3, 3, 2 }, { 7, 14, 3, 3, 2 } } },
+    { -1110, 1486, 2179, 2, { { 0, 0, 10, 9, -1 }, { 0, 3, 10, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 16, 1897, 2197, 2, { { 13, 14, 1, 6, -1 }, { 13, 16, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5509, 2102, 1338, 2, { { 0, 2, 3, 6, -1 }, { 0, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8634, 2742, 1955, 2, { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 23, 1660, 2236, 2, { { 6, 14, 1, 6, -1 }, { 6, 16, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4000, 2644, 1963, 2, { { 9, 15, 2, 3, -1 }, { 9, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1165, 2159, 1446, 2, { { 6, 4, 3, 3, -1 }, { 7, 4, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6051, 1558, 2193, 2, { { 9, 0, 11, 3, -1 }, { 9, 1, 11, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3162, 2187, 1592, 2, { { 0, 6, 20, 3, -1 }, { 0, 7, 20, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -896, 1460, 2160, 2, { { 10, 1, 1, 2, -1 }, { 10, 2, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 11587, 1914, 2806, 2, { { 9, 6, 2, 6, -1 }, { 10, 6, 1, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 44675, 2110, 288, 2, { { 5, 8, 12, 1, -1 }, { 9, 8, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3228, 1246, 2111, 2, { { 3, 8, 12, 1, -1 }, { 7, 8, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5748, 2634, 2006, 2, { { 9, 7, 3, 5, -1 }, { 10, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3343, 2174, 1567, 2, { { 3, 9, 6, 2, -1 }, { 6, 9, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 377, 1905, 2221, 2, { { 12, 9, 3, 3, -1 }, { 12, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4268, 1167, 2080, 2, { { 7, 0, 6, 1, -1 }, { 9, 0, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -15303, 1217, 2101, 2, { { 12, 9, 3, 3, -1 }, { 12, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -125, 2306, 1779, 2, { { 7, 10, 2, 1, -1 }, { 8, 10, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -727, 1804, 2195, 2, { { 6, 4, 9, 13, -1 }, { 9, 4, 3, 13, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 16, 1401, 2115, 2, { { 6, 8, 4, 2, -1 }, { 6, 9, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 9468, 1900, 2504, 2, { { 16, 2, 4, 6, -1 }, { 16, 2, 2, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -8456, 1155, 2079, 2, { { 0, 17, 6, 3, -1 }, { 0, 18, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 27328, 2134, 1101, 2, { { 10, 10, 3, 10, -1 }, { 10, 15, 3, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 18156, 1910, 2760, 2, { { 8, 7, 3, 5, -1 }, { 9, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 23768, 2134, 906, 2, { { 10, 4, 4, 3, -1 }, { 10, 4, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2303, 2483, 1859, 2, { { 8, 4, 3, 8, -1 }, { 9, 4, 1, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9991, 1899, 2149, 2, { { 6, 6, 9, 13, -1 }, { 9, 6, 3, 13, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8488, 2167, 1603, 3, { { 6, 0, 8, 12, -1 }, { 6, 0, 4, 6, 2 }, { 10, 6, 4, 6, 2 } } },
+    { -76417, 3175, 2044, 2, { { 14, 2, 6, 8, -1 }, { 16, 2, 2, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7236, 995, 2068, 2, { { 6, 0, 3, 6, -1 }, { 7, 0, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -11858, 2349, 1983, 2, { { 14, 2, 6, 8, -1 }, { 16, 2, 2, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 62509, 2060, 1034, 2, { { 0, 5, 6, 6, -1 }, { 0, 8, 6, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -3002, 2488, 2006, 3, { { 9, 12, 6, 2, -1 }, { 12, 12, 3, 1, 2 }, { 9, 13, 3, 1, 2 } } },
+    { 4696, 2054, 909, 2, { { 8, 17, 3, 2, -1 }, { 9, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1836, 2709, 2021, 3, { { 11, 6, 2, 2, -1 }, { 12, 6, 1, 1, 2 }, { 11, 7, 1, 1, 2 } } },
+    { 42114, 2122, 1532, 2, { { 1, 9, 18, 2, -1 }, { 7, 9, 6, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 365, 1933, 2383, 3, { { 11, 6, 2, 2, -1 }, { 12, 6, 1, 1, 2 }, { 11, 7, 1, 1, 2 } } },
+    { 2784, 1559, 2139, 2, { { 3, 4, 12, 8, -1 }, { 7, 4, 4, 8, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9197, 1206, 2143, 2, { { 13, 11, 5, 3, -1 }, { 13, 12, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5780, 3009, 1934, 2, { { 9, 10, 2, 3, -1 }, { 9, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 720, 2233, 1738, 2, { { 14, 7, 2, 3, -1 }, { 14, 7, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 587, 1802, 2294, 2, { { 5, 4, 1, 3, -1 }, { 5, 5, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2532, 1942, 2514, 2, { { 13, 4, 2, 3, -1 }, { 13, 5, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1644, 2476, 1850, 2, { { 5, 4, 2, 3, -1 }, { 5, 5, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3862, 1005, 2169, 2, { { 9, 8, 2, 3, -1 }, { 9, 9, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -308, 1529, 2151, 2, { { 8, 9, 2, 2, -1 }, { 8, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 449, 2252, 1665, 2, { { 15, 14, 1, 4, -1 }, { 15, 16, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5119, 877, 2048, 2, { { 3, 12, 2, 2, -1 }, { 3, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 286, 1905, 2381, 3, { { 12, 15, 2, 2, -1 }, { 13, 15, 1, 1, 2 }, { 12, 16, 1, 1, 2 } } },
+    { 220, 1797, 2283, 2, { { 9, 13, 2, 2, -1 }, { 9, 14, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 50857, 2148, 1316, 2, { { 4, 11, 14, 9, -1 }, { 4, 14, 14, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4736, 2481, 1862, 2, { { 7, 13, 4, 3, -1 }, { 7, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -12889, 836, 2110, 2, { { 15, 14, 1, 4, -1 }, { 15, 16, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 509, 2145, 1532, 2, { { 4, 14, 1, 4, -1 }, { 4, 16, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 32040, 2032, 2432, 2, { { 14, 0, 6, 13, -1 }, { 16, 0, 2, 13, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -158, 2192, 1698, 3, { { 4, 1, 2, 12, -1 }, { 4, 1, 1, 6, 2 }, { 5, 7, 1, 6, 2 } } },
+    { 2615, 1922, 2259, 3, { { 11, 14, 6, 6, -1 }, { 14, 14, 3, 3, 2 }, { 11, 17, 3, 3, 2 } } },
+    { -12984, 2782, 1918, 3, { { 3, 14, 6, 6, -1 }, { 3, 14, 3, 3, 2 }, { 6, 17, 3, 3, 2 } } },
+    { -5383, 1478, 2142, 2, { { 14, 17, 3, 2, -1 }, { 14, 18, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 544, 2171, 1488, 2, { { 3, 17, 3, 2, -1 }, { 3, 18, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 157920, 2112, 906, 2, { { 14, 0, 6, 13, -1 }, { 16, 0, 2, 13, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8089, 1807, 2366, 2, { { 0, 0, 6, 13, -1 }, { 2, 0, 2, 13, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 9903, 2213, 1539, 2, { { 10, 10, 7, 6, -1 }, { 10, 12, 7, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 262, 1789, 2297, 3, { { 6, 15, 2, 2, -1 }, { 6, 15, 1, 1, 2 }, { 7, 16, 1, 1, 2 } } },
+    { -3468, 1739, 2260, 3, { { 6, 11, 8, 6, -1 }, { 10, 11, 4, 3, 2 }, { 6, 14, 4, 3, 2 } } },
+    { 776, 1842, 2417, 3, { { 7, 6, 2, 2, -1 }, { 7, 6, 1, 1, 2 }, { 8, 7, 1, 1, 2 } } },
+    { 46234, 2168, 1293, 3, { { 2, 2, 16, 6, -1 }, { 10, 2, 8, 3, 2 }, { 2, 5, 8, 3, 2 } } },
+    { 3527, 1836, 2396, 2, { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4169, 1868, 2246, 2, { { 11, 7, 3, 10, -1 }, { 11, 12, 3, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2906, 2188, 1553, 2, { { 6, 7, 3, 10, -1 }, { 6, 12, 3, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -253, 2321, 1875, 2, { { 10, 7, 3, 2, -1 }, { 11, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 518, 1811, 2306, 2, { { 8, 12, 4, 2, -1 }, { 8, 13, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -408, 1757, 2208, 2, { { 10, 1, 1, 3, -1 }, { 10, 2, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -52480, 2826, 1927, 3, { { 1, 2, 4, 18, -1 }, { 1, 2, 2, 9, 2 }, { 3, 11, 2, 9, 2 } } },
+    { -38415, 908, 2127, 2, { { 12, 4, 4, 12, -1 }, { 12, 10, 4, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2545, 2104, 1433, 2, { { 0, 0, 1, 6, -1 }, { 0, 2, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2051, 1977, 2625, 2, { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1834, 1607, 2160, 2, { { 8, 7, 4, 3, -1 }, { 8, 8, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 14633, 2080, 3447, 2, { { 10, 7, 3, 2, -1 }, { 11, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -230, 2261, 1767, 2, { { 7, 7, 3, 2, -1 }, { 8, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1587, 1612, 2205, 2, { { 9, 4, 6, 1, -1 }, { 11, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4574, 3019, 1940, 2, { { 8, 7, 2, 3, -1 }, { 9, 7, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 68326, 2113, 1344, 3, { { 12, 7, 8, 6, -1 }, { 16, 7, 4, 3, 2 }, { 12, 10, 4, 3, 2 } } },
+    { -2471, 1504, 2119, 3, { { 0, 7, 8, 6, -1 }, { 0, 7, 4, 3, 2 }, { 4, 10, 4, 3, 2 } } },
+    { 15882, 2061, 2739, 3, { { 18, 2, 2, 10, -1 }, { 19, 2, 1, 5, 2 }, { 18, 7, 1, 5, 2 } } },
+    { -23961, 2772, 1929, 2, { { 0, 2, 6, 4, -1 }, { 3, 2, 3, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5124, 2154, 1663, 2, { { 9, 4, 6, 1, -1 }, { 11, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1848, 1924, 2740, 3, { { 7, 15, 2, 2, -1 }, { 7, 15, 1, 1, 2 }, { 8, 16, 1, 1, 2 } } },
+    { -1357, 1770, 2189, 2, { { 11, 13, 1, 6, -1 }, { 11, 16, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 11461, 2047, 671, 2, { { 8, 13, 1, 6, -1 }, { 8, 16, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 31, 1754, 2307, 2, { { 14, 3, 2, 1, -1 }, { 14, 3, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6908, 2774, 1925, 2, { { 8, 15, 2, 3, -1 }, { 8, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3411, 2176, 1858, 2, { { 12, 15, 7, 4, -1 }, { 12, 17, 7, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4240, 2318, 1808, 2, { { 4, 14, 12, 3, -1 }, { 4, 15, 12, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1313, 1529, 2194, 2, { { 10, 3, 3, 2, -1 }, { 11, 3, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 202, 2126, 1531, 2, { { 4, 12, 2, 2, -1 }, { 4, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -40464, 1211, 2125, 2, { { 10, 11, 4, 6, -1 }, { 10, 14, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 162, 1781, 2257, 3, { { 7, 13, 2, 2, -1 }, { 7, 13, 1, 1, 2 }, { 8, 14, 1, 1, 2 } } },
+    { -35404, 1323, 2128, 3, { { 4, 11, 14, 4, -1 }, { 11, 11, 7, 2, 2 }, { 4, 13, 7, 2, 2 } } },
+    { -8667, 2448, 1865, 2, { { 1, 18, 18, 2, -1 }, { 7, 18, 6, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 15, 1944, 2252, 3, { { 11, 18, 2, 2, -1 }, { 12, 18, 1, 1, 2 }, { 11, 19, 1, 1, 2 } } },
+    { 16, 1771, 2245, 3, { { 7, 18, 2, 2, -1 }, { 7, 18, 1, 1, 2 }, { 8, 19, 1, 1, 2 } } },
+    { -19652, 647, 2121, 2, { { 12, 18, 8, 2, -1 }, { 12, 19, 8, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1843, 1850, 2365, 2, { { 7, 14, 6, 2, -1 }, { 7, 15, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -3292, 1700, 2237, 3, { { 8, 12, 4, 8, -1 }, { 10, 12, 2, 4, 2 }, { 8, 16, 2, 4, 2 } } },
+    { 70, 1654, 2168, 2, { { 4, 9, 3, 3, -1 }, { 4, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7103, 1953, 2508, 2, { { 7, 10, 6, 2, -1 }, { 9, 10, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7746, 1469, 2125, 2, { { 5, 0, 4, 15, -1 }, { 7, 0, 2, 15, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 14723, 1930, 2284, 2, { { 8, 6, 12, 14, -1 }, { 12, 6, 4, 14, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5794, 1090, 2064, 2, { { 5, 16, 3, 3, -1 }, { 5, 17, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 405634, 2107, 1035, 2, { { 8, 1, 12, 19, -1 }, { 12, 1, 4, 19, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 120, 1755, 2221, 2, { { 3, 0, 3, 2, -1 }, { 3, 1, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -19365, 1592, 2135, 2, { { 10, 12, 4, 5, -1 }, { 10, 12, 2, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -481, 2217, 1735, 2, { { 6, 12, 4, 5, -1 }, { 8, 12, 2, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1314, 2007, 2713, 3, { { 11, 11, 2, 2, -1 }, { 12, 11, 1, 1, 2 }, { 11, 12, 1, 1, 2 } } },
+    { 1563, 2165, 1655, 2, { { 0, 2, 3, 6, -1 }, { 0, 4, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -791, 2471, 1964, 3, { { 11, 11, 2, 2, -1 }, { 12, 11, 1, 1, 2 }, { 11, 12, 1, 1, 2 } } },
+    { -7285, 1673, 2201, 2, { { 7, 6, 4, 10, -1 }, { 7, 11, 4, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 295, 1985, 2359, 3, { { 11, 11, 2, 2, -1 }, { 12, 11, 1, 1, 2 }, { 11, 12, 1, 1, 2 } } },
+    { 1007, 2115, 1456, 2, { { 2, 13, 5, 2, -1 }, { 2, 14, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -282, 2326, 1938, 3, { { 11, 11, 2, 2, -1 }, { 12, 11, 1, 1, 2 }, { 11, 12, 1, 1, 2 } } },
+    { 2265, 1938, 2896, 3, { { 7, 11, 2, 2, -1 }, { 7, 11, 1, 1, 2 }, { 8, 12, 1, 1, 2 } } },
+    { 5897, 2146, 1139, 2, { { 14, 13, 3, 3, -1 }, { 14, 14, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5268, 1162, 2074, 2, { { 3, 13, 3, 3, -1 }, { 3, 14, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -10235, 3031, 2021, 2, { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4353, 2097, 1396, 2, { { 8, 7, 3, 3, -1 }, { 8, 8, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6550, 2017, 2695, 2, { { 13, 5, 3, 3, -1 }, { 13, 6, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7403, 997, 2061, 2, { { 0, 9, 5, 3, -1 }, { 0, 10, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2159, 2417, 1923, 2, { { 13, 5, 3, 3, -1 }, { 13, 6, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2532, 1494, 2125, 3, { { 9, 12, 2, 8, -1 }, { 9, 12, 1, 4, 2 }, { 10, 16, 1, 4, 2 } } },
+    { -1554, 2472, 2023, 3, { { 11, 7, 2, 2, -1 }, { 12, 7, 1, 1, 2 }, { 11, 8, 1, 1, 2 } } },
+    { -6608, 2383, 1868, 2, { { 0, 16, 6, 4, -1 }, { 3, 16, 3, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3645, 2137, 1427, 2, { { 10, 6, 2, 3, -1 }, { 10, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -23332, 967, 2061, 2, { { 9, 5, 2, 6, -1 }, { 9, 7, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -32100, 2662, 2013, 2, { { 12, 15, 8, 4, -1 }, { 12, 15, 4, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 13692, 1808, 2328, 2, { { 0, 14, 8, 6, -1 }, { 4, 14, 4, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -630, 1786, 2185, 2, { { 9, 0, 3, 2, -1 }, { 10, 0, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -435, 2254, 1772, 2, { { 4, 15, 4, 2, -1 }, { 6, 15, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -14445, 1665, 2131, 2, { { 12, 7, 3, 13, -1 }, { 13, 7, 1, 13, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -33865, 194, 2039, 2, { { 5, 7, 3, 13, -1 }, { 6, 7, 1, 13, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 56159, 2000, 2731, 2, { { 9, 6, 3, 9, -1 }, { 9, 9, 3, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8587, 2212, 1737, 2, { { 4, 4, 7, 12, -1 }, { 4, 10, 7, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 221, 1967, 2279, 3, { { 12, 12, 2, 2, -1 }, { 13, 12, 1, 1, 2 }, { 12, 13, 1, 1, 2 } } },
+    { -2557, 3026, 1955, 3, { { 6, 12, 2, 2, -1 }, { 6, 12, 1, 1, 2 }, { 7, 13, 1, 1, 2 } } },
+    { 3443, 2166, 1299, 3, { { 8, 9, 4, 2, -1 }, { 10, 9, 2, 1, 2 }, { 8, 10, 2, 1, 2 } } },
+    { 2488, 1946, 2892, 3, { { 3, 6, 2, 2, -1 }, { 3, 6, 1, 1, 2 }, { 4, 7, 1, 1, 2 } } },
+    { -1525, 1561, 2183, 2, { { 16, 6, 3, 2, -1 }, { 16, 7, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 58464, 1646, 2788, 2, { { 0, 7, 19, 4, -1 }, { 0, 9, 19, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2593, 1373, 2444, 2, { { 10, 2, 10, 1, -1 }, { 10, 2, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -367, 2276, 1426, 2, { { 9, 4, 2, 12, -1 }, { 9, 10, 2, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 568, 1745, 2332, 2, { { 12, 18, 4, 1, -1 }, { 12, 18, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 809, 1431, 2226, 3, { { 1, 7, 6, 4, -1 }, { 1, 7, 3, 2, 2 }, { 4, 9, 3, 2, 2 } } },
+    { -1678, 1650, 2246, 2, { { 12, 0, 6, 13, -1 }, { 14, 0, 2, 13, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -124, 1559, 2222, 2, { { 2, 0, 6, 13, -1 }, { 4, 0, 2, 13, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 345, 1073, 2224, 2, { { 10, 5, 8, 8, -1 }, { 10, 9, 8, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 310, 1556, 2212, 2, { { 8, 3, 2, 5, -1 }, { 9, 3, 1, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 95, 1816, 2228, 2, { { 8, 4, 9, 1, -1 }, { 11, 4, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 16, 1524, 2216, 2, { { 3, 4, 9, 1, -1 }, { 6, 4, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 146125, 2263, 1835, 2, { { 1, 0, 18, 10, -1 }, { 7, 0, 6, 10, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1726, 1747, 2364, 2, { { 7, 17, 5, 3, -1 }, { 7, 18, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 524, 1786, 2329, 2, { { 7, 11, 6, 1, -1 }, { 9, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1150, 1389, 2132, 2, { { 2, 2, 3, 2, -1 }, { 2, 3, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 702, 1867, 2450, 2, { { 8, 12, 4, 2, -1 }, { 8, 13, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 907, 2103, 1206, 2, { { 6, 10, 3, 6, -1 }, { 6, 13, 3, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -285, 1600, 2202, 2, { { 11, 4, 2, 4, -1 }, { 11, 4, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 32, 1507, 2140, 2, { { 7, 4, 2, 4, -1 }, { 8, 4, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -8937, 2987, 2004, 2, { { 9, 6, 2, 4, -1 }, { 9, 6, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1752, 1780, 2333, 2, { { 6, 13, 8, 3, -1 }, { 6, 14, 8, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7490, 1061, 2140, 2, { { 9, 15, 3, 4, -1 }, { 10, 15, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -17112, 2835, 1905, 2, { { 9, 2, 2, 17, -1 }, { 10, 2, 1, 17, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5037, 2192, 1346, 2, { { 7, 0, 6, 1, -1 }, { 9, 0, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7909, 836, 2062, 2, { { 8, 15, 3, 4, -1 }, { 9, 15, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -15061, 2787, 2003, 2, { { 7, 13, 7, 3, -1 }, { 7, 14, 7, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 934, 2175, 1596, 2, { { 8, 16, 3, 3, -1 }, { 9, 16, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4620, 2352, 1791, 2, { { 6, 2, 8, 10, -1 }, { 6, 7, 8, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -198, 1160, 2088, 2, { { 2, 5, 8, 8, -1 }, { 2, 9, 8, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -3982, 1381, 2149, 2, { { 14, 16, 2, 2, -1 }, { 14, 17, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 153, 2174, 1602, 2, { { 4, 16, 2, 2, -1 }, { 4, 17, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -52, 2237, 1615, 2, { { 10, 11, 4, 6, -1 }, { 10, 14, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -35214, 884, 2068, 2, { { 6, 11, 4, 6, -1 }, { 6, 14, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -3706, 2648, 1996, 2, { { 10, 14, 1, 3, -1 }, { 10, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5258, 1891, 2559, 2, { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 19731, 2138, 819, 3, { { 10, 0, 4, 6, -1 }, { 12, 0, 2, 3, 2 }, { 10, 3, 2, 3, 2 } } },
+    { -1409, 1644, 2172, 2, { { 0, 3, 20, 2, -1 }, { 0, 4, 20, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1841, 1964, 2316, 3, { { 12, 0, 8, 2, -1 }, { 16, 0, 4, 1, 2 }, { 12, 1, 4, 1, 2 } } },
+    { -100283, 833, 2051, 2, { { 2, 12, 10, 8, -1 }, { 2, 16, 10, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -23322, 3143, 2067, 3, { { 17, 7, 2, 10, -1 }, { 18, 7, 1, 5, 2 }, { 17, 12, 1, 5, 2 } } },
+    { -16332, 3068, 1948, 3, { { 1, 7, 2, 10, -1 }, { 1, 7, 1, 5, 2 }, { 2, 12, 1, 5, 2 } } },
+    { 5620, 2198, 1640, 2, { { 15, 10, 3, 6, -1 }, { 15, 12, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -22821, 303, 2033, 2, { { 4, 4, 6, 2, -1 }, { 6, 4, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -173661, 1171, 2137, 2, { { 0, 5, 20, 6, -1 }, { 0, 7, 20, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 173, 1717, 2204, 3, { { 0, 0, 8, 2, -1 }, { 0, 0, 4, 1, 2 }, { 4, 1, 4, 1, 2 } } },
+    { -9340, 2569, 1998, 2, { { 1, 0, 18, 4, -1 }, { 7, 0, 6, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 905, 2114, 1504, 2, { { 1, 13, 6, 2, -1 }, { 1, 14, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1442, 2410, 1876, 2, { { 10, 8, 3, 4, -1 }, { 11, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1477, 1458, 2105, 2, { { 6, 1, 6, 1, -1 }, { 8, 1, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4125, 2455, 1910, 2, { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -33520, 1370, 2107, 2, { { 1, 6, 18, 2, -1 }, { 10, 6, 9, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -16, 2287, 1808, 2, { { 15, 11, 1, 2, -1 }, { 15, 12, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 545, 1894, 2527, 2, { { 6, 5, 1, 2, -1 }, { 6, 6, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -3588, 2686, 2038, 2, { { 13, 4, 1, 3, -1 }, { 13, 5, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 186, 2158, 1598, 2, { { 2, 15, 1, 2, -1 }, { 2, 16, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1648, 1898, 2372, 2, { { 12, 4, 4, 3, -1 }, { 12, 5, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9337, 1102, 2070, 2, { { 0, 0, 7, 3, -1 }, { 0, 1, 7, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 427, 2235, 1774, 2, { { 9, 12, 6, 2, -1 }, { 9, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7089, 1904, 2740, 2, { { 5, 4, 2, 3, -1 }, { 5, 5, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3051, 2175, 1384, 2, { { 18, 4, 2, 3, -1 }, { 18, 5, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1456, 1669, 2191, 2, { { 3, 0, 8, 6, -1 }, { 3, 2, 8, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -80493, 816, 2141, 3, { { 0, 2, 20, 6, -1 }, { 10, 2, 10, 3, 2 }, { 0, 5, 10, 3, 2 } } },
+    { -238, 2228, 1742, 2, { { 4, 7, 2, 4, -1 }, { 5, 7, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6616, 1745, 2203, 2, { { 3, 10, 15, 2, -1 }, { 8, 10, 5, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -115420, 2828, 1934, 2, { { 3, 0, 12, 11, -1 }, { 9, 0, 6, 11, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 300, 1853, 2273, 2, { { 13, 0, 2, 6, -1 }, { 13, 0, 1, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 31, 2200, 1735, 2, { { 0, 19, 2, 1, -1 }, { 1, 19, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -26095, 2631, 2035, 3, { { 16, 10, 4, 10, -1 }, { 18, 10, 2, 5, 2 }, { 16, 15, 2, 5, 2 } } },
+    { 34759, 2043, 661, 2, { { 4, 8, 10, 3, -1 }, { 4, 9, 10, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 823, 2218, 1730, 2, { { 14, 12, 3, 3, -1 }, { 14, 13, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4937, 1874, 2469, 3, { { 0, 10, 4, 10, -1 }, { 0, 10, 2, 5, 2 }, { 2, 15, 2, 5, 2 } } },
+    { 2532, 2175, 1811, 2, { { 18, 3, 2, 6, -1 }, { 18, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2047, 1927, 2729, 2, { { 6, 6, 1, 3, -1 }, { 6, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1367, 1805, 2264, 2, { { 7, 7, 7, 2, -1 }, { 7, 8, 7, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4691, 2101, 1352, 2, { { 0, 3, 2, 6, -1 }, { 0, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2795, 1284, 2120, 2, { { 11, 1, 3, 1, -1 }, { 12, 1, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 143, 1687, 2174, 2, { { 5, 0, 2, 6, -1 }, { 6, 0, 1, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -17958, 2530, 1981, 2, { { 1, 1, 18, 14, -1 }, { 7, 1, 6, 14, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -279, 1497, 2118, 2, { { 4, 6, 8, 3, -1 }, { 8, 6, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -24046, 1430, 2115, 2, { { 9, 12, 6, 2, -1 }, { 9, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2445, 2116, 1519, 2, { { 5, 12, 6, 2, -1 }, { 8, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 17748, 2054, 3299, 2, { { 10, 7, 3, 5, -1 }, { 11, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9422, 2650, 1908, 2, { { 7, 7, 3, 5, -1 }, { 8, 7, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -12452, 1330, 2154, 2, { { 13, 0, 3, 10, -1 }, { 14, 0, 1, 10, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 203, 2127, 1573, 2, { { 4, 11, 3, 2, -1 }, { 4, 12, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 6157, 2014, 2534, 2, { { 17, 3, 3, 6, -1 }, { 18, 3, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -260454, 752, 2043, 2, { { 1, 8, 18, 10, -1 }, { 1, 13, 18, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 12851, 2141, 1488, 2, { { 13, 0, 3, 10, -1 }, { 14, 0, 1, 10, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 881, 1839, 2365, 2, { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2664, 1968, 2400, 2, { { 16, 3, 3, 7, -1 }, { 17, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -15542, 1033, 2058, 2, { { 4, 0, 3, 10, -1 }, { 5, 0, 1, 10, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6079, 2456, 1988, 2, { { 16, 3, 3, 7, -1 }, { 17, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 762, 2111, 1504, 2, { { 0, 9, 1, 2, -1 }, { 0, 10, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -18070, 2712, 2046, 2, { { 18, 1, 2, 10, -1 }, { 18, 1, 1, 10, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 8244, 1898, 2562, 2, { { 0, 1, 2, 10, -1 }, { 1, 1, 1, 10, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4964, 1481, 2163, 2, { { 10, 16, 3, 4, -1 }, { 11, 16, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 871, 1820, 2274, 2, { { 2, 8, 3, 3, -1 }, { 3, 8, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8032, 2115, 1070, 3, { { 11, 0, 2, 6, -1 }, { 12, 0, 1, 3, 2 }, { 11, 3, 1, 3, 2 } } },
+    { -4304, 1143, 2056, 3, { { 7, 0, 2, 6, -1 }, { 7, 0, 1, 3, 2 }, { 8, 3, 1, 3, 2 } } },
+    { 5087, 2035, 2319, 2, { { 16, 3, 3, 7, -1 }, { 17, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1047, 1821, 2274, 2, { { 1, 3, 3, 7, -1 }, { 2, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -283363, 120, 2110, 2, { { 14, 1, 6, 16, -1 }, { 16, 1, 2, 16, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -13727, 2334, 1822, 2, { { 0, 1, 6, 16, -1 }, { 2, 1, 2, 16, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9893, 1764, 2248, 3, { { 2, 0, 16, 8, -1 }, { 10, 0, 8, 4, 2 }, { 2, 4, 8, 4, 2 } } },
+    { -1623, 1507, 2100, 2, { { 6, 8, 5, 3, -1 }, { 6, 9, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5636, 1982, 2499, 2, { { 9, 7, 3, 3, -1 }, { 10, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1655, 2181, 1687, 2, { { 8, 8, 4, 3, -1 }, { 8, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3865, 1971, 2561, 2, { { 9, 6, 2, 4, -1 }, { 9, 6, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 9845, 2130, 1487, 2, { { 0, 7, 15, 1, -1 }, { 5, 7, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 13414, 2032, 2760, 2, { { 8, 2, 7, 9, -1 }, { 8, 5, 7, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3530, 1663, 2164, 3, { { 1, 7, 16, 4, -1 }, { 1, 7, 8, 2, 2 }, { 9, 9, 8, 2, 2 } } },
+    { 417, 1915, 2417, 2, { { 6, 12, 8, 2, -1 }, { 6, 13, 8, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1559, 1851, 2491, 2, { { 8, 11, 3, 3, -1 }, { 8, 12, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -92995, 1150, 2122, 3, { { 4, 5, 14, 10, -1 }, { 11, 5, 7, 5, 2 }, { 4, 10, 7, 5, 2 } } },
+    { -78, 2169, 1674, 2, { { 4, 12, 3, 2, -1 }, { 4, 13, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -16, 2237, 1859, 2, { { 9, 11, 6, 1, -1 }, { 11, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6204, 2183, 1717, 2, { { 4, 9, 7, 6, -1 }, { 4, 11, 7, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1168, 1848, 2337, 2, { { 7, 10, 6, 3, -1 }, { 7, 11, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 94, 1875, 2416, 2, { { 9, 11, 2, 2, -1 }, { 9, 12, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2655, 2171, 1375, 2, { { 0, 5, 20, 6, -1 }, { 0, 7, 20, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 13030, 2031, 552, 2, { { 6, 4, 6, 1, -1 }, { 8, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 29712, 2096, 3, 2, { { 9, 11, 6, 1, -1 }, { 11, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6938, 1940, 2872, 2, { { 5, 11, 6, 1, -1 }, { 7, 11, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8438, 2137, 1345, 2, { { 10, 16, 3, 4, -1 }, { 11, 16, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1174, 2380, 1869, 2, { { 8, 7, 3, 3, -1 }, { 9, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 13923, 2211, 1681, 2, { { 2, 12, 16, 8, -1 }, { 2, 16, 16, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 512, 1741, 2216, 2, { { 0, 15, 15, 2, -1 }, { 0, 16, 15, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 11789, 2159, 1408, 2, { { 15, 4, 5, 6, -1 }, { 15, 6, 5, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -943, 2307, 1825, 2, { { 9, 5, 2, 4, -1 }, { 10, 5, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 6992, 2176, 1787, 2, { { 8, 10, 9, 6, -1 }, { 8, 12, 9, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 30353, 1926, 2693, 2, { { 2, 19, 15, 1, -1 }, { 7, 19, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -24537, 0, 2104, 2, { { 10, 16, 3, 4, -1 }, { 11, 16, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -93446, 97, 2024, 2, { { 0, 15, 20, 4, -1 }, { 0, 17, 20, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -14737, 1281, 2096, 2, { { 10, 16, 3, 4, -1 }, { 11, 16, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8519, 2052, 1032, 2, { { 7, 16, 3, 4, -1 }, { 8, 16, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5239, 2616, 2018, 2, { { 9, 16, 3, 3, -1 }, { 9, 17, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3277, 2104, 1508, 2, { { 8, 11, 4, 6, -1 }, { 8, 14, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7096, 2257, 1787, 2, { { 9, 6, 2, 12, -1 }, { 9, 10, 2, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2486, 2524, 1879, 2, { { 8, 17, 4, 3, -1 }, { 8, 18, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5612, 2534, 2015, 3, { { 9, 18, 8, 2, -1 }, { 13, 18, 4, 1, 2 }, { 9, 19, 4, 1, 2 } } },
+    { -16745, 566, 2041, 2, { { 1, 18, 8, 2, -1 }, { 1, 19, 8, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4999, 1920, 2249, 2, { { 13, 5, 6, 15, -1 }, { 15, 5, 2, 15, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2592, 970, 2050, 2, { { 9, 8, 2, 2, -1 }, { 9, 9, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -745, 2399, 1934, 2, { { 9, 5, 2, 3, -1 }, { 9, 5, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -148033, 356, 2032, 2, { { 1, 5, 6, 15, -1 }, { 3, 5, 2, 15, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 111692, 2105, 713, 3, { { 4, 1, 14, 8, -1 }, { 11, 1, 7, 4, 2 }, { 4, 5, 7, 4, 2 } } },
+    { -55307, 3012, 1955, 3, { { 2, 4, 4, 16, -1 }, { 2, 4, 2, 8, 2 }, { 4, 12, 2, 8, 2 } } },
+    { -4974, 1591, 2168, 2, { { 12, 4, 3, 12, -1 }, { 12, 10, 3, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1045, 2140, 1640, 3, { { 4, 5, 10, 12, -1 }, { 4, 5, 5, 6, 2 }, { 9, 11, 5, 6, 2 } } },
+    { 8418, 2031, 2954, 2, { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 902, 1821, 2269, 2, { { 5, 4, 2, 3, -1 }, { 5, 5, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 977, 2211, 1705, 3, { { 12, 2, 4, 10, -1 }, { 14, 2, 2, 5, 2 }, { 12, 7, 2, 5, 2 } } },
+    { -2630, 2398, 1869, 2, { { 6, 4, 7, 3, -1 }, { 6, 5, 7, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2242, 1887, 2163, 3, { { 2, 0, 18, 2, -1 }, { 11, 0, 9, 1, 2 }, { 2, 1, 9, 1, 2 } } },
+    { -2259, 1553, 2153, 3, { { 0, 0, 18, 2, -1 }, { 0, 0, 9, 1, 2 }, { 9, 1, 9, 1, 2 } } },
+    { -7992, 2457, 2028, 3, { { 13, 13, 4, 6, -1 }, { 15, 13, 2, 3, 2 }, { 13, 16, 2, 3, 2 } } },
+    { 2313, 1837, 2289, 3, { { 3, 13, 4, 6, -1 }, { 3, 13, 2, 3, 2 }, { 5, 16, 2, 3, 2 } } },
+    { 1320, 2233, 1812, 2, { { 10, 12, 2, 6, -1 }, { 10, 15, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5340, 1687, 2156, 3, { { 5, 9, 10, 10, -1 }, { 5, 9, 5, 5, 2 }, { 10, 14, 5, 5, 2 } } },
+    { -2631, 2371, 2047, 3, { { 11, 4, 4, 2, -1 }, { 13, 4, 2, 1, 2 }, { 11, 5, 2, 1, 2 } } },
+    { -81084, 3440, 1971, 2, { { 7, 12, 6, 8, -1 }, { 10, 12, 3, 8, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -43501, 987, 2120, 3, { { 12, 2, 4, 10, -1 }, { 14, 2, 2, 5, 2 }, { 12, 7, 2, 5, 2 } } },
+    { 109, 1784, 2219, 2, { { 8, 11, 2, 1, -1 }, { 9, 11, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1390, 2234, 2005, 2, { { 10, 5, 1, 12, -1 }, { 10, 9, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8451, 2364, 1875, 2, { { 0, 11, 6, 9, -1 }, { 3, 11, 3, 9, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 19984, 2118, 1393, 3, { { 12, 2, 4, 10, -1 }, { 14, 2, 2, 5, 2 }, { 12, 7, 2, 5, 2 } } },
+    { -36761, 902, 2048, 3, { { 4, 2, 4, 10, -1 }, { 4, 2, 2, 5, 2 }, { 6, 7, 2, 5, 2 } } },
+    { 6008, 2066, 2702, 3, { { 11, 4, 4, 2, -1 }, { 13, 4, 2, 1, 2 }, { 11, 5, 2, 1, 2 } } },
+    { -12214, 896, 2047, 2, { { 0, 14, 6, 3, -1 }, { 0, 15, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1525, 2051, 2254, 3, { { 11, 4, 4, 2, -1 }, { 13, 4, 2, 1, 2 }, { 11, 5, 2, 1, 2 } } },
+    { -262, 1692, 2147, 2, { { 6, 1, 3, 2, -1 }, { 7, 1, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -869, 2217, 2038, 3, { { 11, 4, 4, 2, -1 }, { 13, 4, 2, 1, 2 }, { 11, 5, 2, 1, 2 } } },
+    { 1139, 1886, 2408, 3, { { 5, 4, 4, 2, -1 }, { 5, 4, 2, 1, 2 }, { 7, 5, 2, 1, 2 } } },
+    { 210, 2162, 1927, 3, { { 13, 0, 2, 12, -1 }, { 14, 0, 1, 6, 2 }, { 13, 6, 1, 6, 2 } } },
+    { 3063, 2101, 1538, 2, { { 6, 0, 3, 10, -1 }, { 7, 0, 1, 10, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 26621, 1975, 2372, 2, { { 3, 0, 17, 8, -1 }, { 3, 4, 17, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -3352, 2150, 1623, 2, { { 0, 4, 20, 4, -1 }, { 0, 6, 20, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 6085, 1433, 2442, 2, { { 0, 3, 8, 2, -1 }, { 4, 3, 4, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -9438, 2792, 1834, 2, { { 8, 11, 4, 3, -1 }, { 8, 12, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1211, 2288, 1466, 3, { { 5, 7, 6, 4, -1 }, { 5, 7, 3, 2, 2 }, { 8, 9, 3, 2, 2 } } },
+    { -1161, 2198, 1249, 2, { { 8, 3, 4, 9, -1 }, { 8, 6, 4, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 108, 1491, 2189, 2, { { 8, 15, 1, 4, -1 }, { 8, 17, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5346, 1171, 2255, 2, { { 4, 5, 12, 7, -1 }, { 8, 5, 4, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 866, 2145, 1424, 3, { { 4, 2, 4, 10, -1 }, { 4, 2, 2, 5, 2 }, { 6, 7, 2, 5, 2 } } },
+    { 10463, 1946, 2548, 2, { { 3, 0, 17, 2, -1 }, { 3, 1, 17, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -39219, 1369, 2162, 2, { { 2, 2, 16, 15, -1 }, { 2, 7, 16, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5091, 2127, 1516, 2, { { 15, 2, 5, 2, -1 }, { 15, 3, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1957, 1200, 2086, 2, { { 9, 3, 2, 2, -1 }, { 10, 3, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 17709, 1510, 2225, 2, { { 4, 5, 16, 15, -1 }, { 4, 10, 16, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6121, 1488, 2139, 2, { { 7, 13, 5, 6, -1 }, { 7, 16, 5, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1543, 2405, 1925, 2, { { 10, 7, 3, 2, -1 }, { 11, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1208, 1309, 2106, 2, { { 8, 3, 3, 1, -1 }, { 9, 3, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4463, 2581, 1972, 2, { { 9, 16, 3, 3, -1 }, { 9, 17, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7065, 810, 2059, 2, { { 0, 2, 5, 2, -1 }, { 0, 3, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 11936, 2029, 2813, 2, { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5431, 2115, 1372, 2, { { 1, 7, 12, 1, -1 }, { 5, 7, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -123143, 948, 2144, 2, { { 7, 5, 6, 14, -1 }, { 7, 12, 6, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 30098, 1910, 2754, 3, { { 0, 0, 8, 10, -1 }, { 0, 0, 4, 5, 2 }, { 4, 5, 4, 5, 2 } } },
+    { 5057, 2138, 1116, 2, { { 9, 1, 3, 2, -1 }, { 10, 1, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2810, 2080, 1191, 2, { { 8, 1, 3, 2, -1 }, { 9, 1, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8441, 2001, 2619, 2, { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5039, 2129, 1498, 2, { { 7, 4, 6, 16, -1 }, { 7, 12, 6, 8, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2351, 2520, 1951, 2, { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -14426, 1080, 2061, 2, { { 2, 3, 2, 6, -1 }, { 2, 5, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -108405, 937, 2123, 2, { { 14, 2, 6, 9, -1 }, { 14, 5, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9902, 2848, 1923, 2, { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 842, 2233, 1748, 2, { { 9, 17, 3, 2, -1 }, { 10, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4398, 2495, 1873, 2, { { 5, 5, 2, 3, -1 }, { 5, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 11474, 2147, 1345, 2, { { 13, 11, 3, 6, -1 }, { 13, 13, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -607, 2207, 1712, 2, { { 3, 14, 2, 6, -1 }, { 3, 17, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2190, 1758, 2172, 2, { { 14, 3, 6, 2, -1 }, { 14, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3396, 1553, 2138, 2, { { 0, 8, 16, 2, -1 }, { 0, 9, 16, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5146, 2145, 1690, 2, { { 14, 3, 6, 2, -1 }, { 14, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -33846, 798, 2046, 2, { { 0, 0, 5, 6, -1 }, { 0, 2, 5, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -9407, 2462, 2019, 2, { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 16065, 2052, 836, 2, { { 4, 11, 3, 6, -1 }, { 4, 13, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2187, 1992, 2344, 2, { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5307, 2048, 738, 2, { { 9, 5, 1, 3, -1 }, { 9, 6, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3898, 2265, 2006, 2, { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -12762, 1712, 2205, 2, { { 6, 6, 8, 12, -1 }, { 6, 12, 8, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4849, 2047, 2360, 2, { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -221, 2184, 1678, 2, { { 5, 12, 9, 2, -1 }, { 8, 12, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -15353, 2358, 2069, 2, { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3481, 1875, 2471, 2, { { 4, 5, 4, 3, -1 }, { 4, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3905, 1794, 2218, 2, { { 6, 6, 9, 2, -1 }, { 9, 6, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 870, 2115, 1516, 2, { { 4, 11, 1, 3, -1 }, { 4, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -11963, 2487, 1992, 2, { { 14, 12, 6, 6, -1 }, { 14, 12, 3, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4752, 1349, 2084, 2, { { 7, 0, 3, 7, -1 }, { 8, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5377, 1978, 2508, 2, { { 9, 8, 3, 3, -1 }, { 10, 8, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 10337, 1909, 2685, 2, { { 8, 8, 3, 3, -1 }, { 9, 8, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 38783, 2132, 692, 2, { { 5, 10, 11, 3, -1 }, { 5, 11, 11, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4875, 2117, 1526, 2, { { 5, 7, 10, 1, -1 }, { 10, 7, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4474, 2624, 2043, 2, { { 9, 7, 3, 2, -1 }, { 10, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -503, 2416, 1829, 2, { { 8, 7, 3, 2, -1 }, { 9, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3862, 2229, 1422, 2, { { 11, 9, 4, 2, -1 }, { 11, 9, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -10549, 878, 2050, 2, { { 5, 9, 4, 2, -1 }, { 7, 9, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -318, 2206, 1880, 2, { { 14, 10, 2, 4, -1 }, { 14, 12, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1525, 2356, 1842, 2, { { 7, 7, 3, 2, -1 }, { 8, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1732, 2221, 1736, 2, { { 14, 17, 6, 3, -1 }, { 14, 18, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8228, 1670, 2154, 3, { { 4, 5, 12, 12, -1 }, { 4, 5, 6, 6, 2 }, { 10, 11, 6, 6, 2 } } },
+    { -5375, 1732, 2244, 3, { { 6, 9, 8, 8, -1 }, { 10, 9, 4, 4, 2 }, { 6, 13, 4, 4, 2 } } },
+    { -38683, 2702, 1915, 2, { { 0, 4, 15, 4, -1 }, { 5, 4, 5, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 252, 1741, 2283, 2, { { 13, 2, 4, 1, -1 }, { 13, 2, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -16, 2154, 1669, 2, { { 4, 12, 2, 2, -1 }, { 4, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2318, 1914, 2411, 2, { { 8, 13, 4, 3, -1 }, { 8, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1213, 2339, 1838, 2, { { 9, 13, 2, 3, -1 }, { 9, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5242, 2156, 1187, 2, { { 13, 11, 2, 3, -1 }, { 13, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1537, 1594, 2129, 3, { { 7, 12, 4, 4, -1 }, { 7, 12, 2, 2, 2 }, { 9, 14, 2, 2, 2 } } },
+    { -1256, 2374, 2018, 3, { { 10, 11, 2, 2, -1 }, { 11, 11, 1, 1, 2 }, { 10, 12, 1, 1, 2 } } },
+    { -4714, 974, 2053, 2, { { 8, 17, 3, 2, -1 }, { 9, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 157, 1997, 2301, 3, { { 10, 11, 2, 2, -1 }, { 11, 11, 1, 1, 2 }, { 10, 12, 1, 1, 2 } } },
+    { 2767, 2117, 1542, 2, { { 0, 17, 6, 3, -1 }, { 0, 18, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -308, 2231, 1997, 3, { { 10, 11, 2, 2, -1 }, { 11, 11, 1, 1, 2 }, { 10, 12, 1, 1, 2 } } },
+    { 1490, 1920, 2741, 3, { { 8, 11, 2, 2, -1 }, { 8, 11, 1, 1, 2 }, { 9, 12, 1, 1, 2 } } },
+    { 83286, 2127, 1119, 2, { { 12, 5, 8, 4, -1 }, { 12, 5, 4, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 83821, 2036, 730, 2, { { 0, 5, 8, 4, -1 }, { 4, 5, 4, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 11628, 2116, 1315, 2, { { 13, 2, 4, 1, -1 }, { 13, 2, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 174, 1662, 2174, 2, { { 3, 2, 4, 1, -1 }, { 5, 2, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5595, 1411, 2113, 3, { { 10, 0, 4, 2, -1 }, { 12, 0, 2, 1, 2 }, { 10, 1, 2, 1, 2 } } },
+    { 1184, 1882, 2489, 2, { { 7, 12, 3, 1, -1 }, { 8, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -23036, 688, 2142, 3, { { 8, 11, 4, 8, -1 }, { 10, 11, 2, 4, 2 }, { 8, 15, 2, 4, 2 } } },
+    { -228, 1582, 2136, 2, { { 9, 9, 2, 2, -1 }, { 9, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 212, 2260, 1787, 2, { { 3, 18, 15, 2, -1 }, { 3, 19, 15, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -22789, 3277, 1962, 3, { { 2, 6, 2, 12, -1 }, { 2, 6, 1, 6, 2 }, { 3, 12, 1, 6, 2 } } },
+    { -885, 1674, 2202, 2, { { 9, 8, 2, 3, -1 }, { 9, 9, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -460, 2241, 1788, 2, { { 7, 10, 3, 2, -1 }, { 8, 10, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1583, 2043, 2393, 2, { { 11, 11, 3, 1, -1 }, { 12, 11, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3727, 2766, 1934, 2, { { 6, 11, 3, 1, -1 }, { 7, 11, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 505, 2218, 1785, 3, { { 9, 2, 4, 2, -1 }, { 11, 2, 2, 1, 2 }, { 9, 3, 2, 1, 2 } } },
+    { -6319, 925, 2045, 2, { { 4, 12, 2, 3, -1 }, { 4, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -12235, 2563, 2018, 2, { { 2, 1, 18, 3, -1 }, { 8, 1, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3011, 1617, 2149, 2, { { 5, 1, 4, 14, -1 }, { 7, 1, 2, 14, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 17879, 1947, 2373, 2, { { 8, 16, 12, 3, -1 }, { 8, 16, 6, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -14001, 2474, 1861, 2, { { 1, 17, 18, 3, -1 }, { 7, 17, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -412, 1744, 2271, 2, { { 9, 14, 2, 6, -1 }, { 9, 17, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3196, 2144, 1548, 2, { { 9, 12, 1, 8, -1 }, { 9, 16, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -4570, 2610, 1982, 2, { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5941, 2201, 1705, 2, { { 9, 6, 2, 12, -1 }, { 9, 10, 2, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 64, 1900, 2176, 2, { { 12, 9, 3, 3, -1 }, { 12, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 38523, 1920, 2649, 2, { { 0, 1, 4, 8, -1 }, { 2, 1, 2, 8, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 9073, 2132, 896, 3, { { 9, 1, 6, 2, -1 }, { 12, 1, 3, 1, 2 }, { 9, 2, 3, 1, 2 } } },
+    { -161180, 668, 2031, 2, { { 1, 3, 12, 14, -1 }, { 1, 10, 12, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -436, 2365, 1924, 3, { { 8, 12, 4, 2, -1 }, { 10, 12, 2, 1, 2 }, { 8, 13, 2, 1, 2 } } },
+    { -1325, 1629, 2137, 3, { { 1, 9, 10, 2, -1 }, { 1, 9, 5, 1, 2 }, { 6, 10, 5, 1, 2 } } },
+    { -3720, 2477, 1969, 2, { { 8, 15, 4, 3, -1 }, { 8, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 31, 1637, 2141, 2, { { 6, 8, 8, 3, -1 }, { 6, 9, 8, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1375, 1930, 2362, 2, { { 9, 15, 5, 3, -1 }, { 9, 16, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1402, 1683, 2152, 2, { { 8, 7, 4, 3, -1 }, { 8, 8, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 21891, 2131, 720, 2, { { 7, 7, 6, 2, -1 }, { 7, 8, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -7917, 2690, 1923, 3, { { 5, 7, 8, 2, -1 }, { 5, 7, 4, 1, 2 }, { 9, 8, 4, 1, 2 } } },
+    { 25364, 2101, 1380, 2, { { 12, 9, 3, 3, -1 }, { 12, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3078, 2695, 1923, 2, { { 4, 7, 4, 2, -1 }, { 4, 8, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 60354, 2108, 1137, 2, { { 14, 2, 6, 9, -1 }, { 14, 5, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1189, 1571, 2127, 2, { { 4, 9, 3, 3, -1 }, { 5, 9, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 17634, 2083, 2530, 2, { { 12, 9, 3, 3, -1 }, { 12, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5299, 2105, 1509, 2, { { 0, 2, 6, 9, -1 }, { 0, 5, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4810, 2453, 1980, 2, { { 17, 3, 3, 6, -1 }, { 18, 3, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1770, 1847, 2344, 2, { { 0, 3, 3, 6, -1 }, { 1, 3, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1736, 1432, 2148, 2, { { 17, 14, 1, 2, -1 }, { 17, 15, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -20315, 459, 2035, 2, { { 4, 9, 4, 3, -1 }, { 6, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 10878, 2109, 1800, 2, { { 12, 9, 3, 3, -1 }, { 12, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 157, 1673, 2159, 2, { { 5, 9, 3, 3, -1 }, { 5, 10, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -45070, 2619, 2056, 3, { { 9, 5, 6, 8, -1 }, { 12, 5, 3, 4, 2 }, { 9, 9, 3, 4, 2 } } },
+    { 8710, 1928, 2744, 3, { { 5, 5, 6, 8, -1 }, { 5, 5, 3, 4, 2 }, { 8, 9, 3, 4, 2 } } },
+    { -4329, 1860, 2181, 2, { { 16, 1, 4, 6, -1 }, { 16, 4, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1824, 1775, 2228, 2, { { 1, 0, 6, 20, -1 }, { 3, 0, 2, 20, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 123, 1876, 2271, 2, { { 12, 11, 3, 2, -1 }, { 13, 11, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 195, 1771, 2223, 2, { { 5, 11, 3, 2, -1 }, { 6, 11, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5829, 2153, 1454, 2, { { 9, 4, 6, 1, -1 }, { 11, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8373, 2475, 1897, 2, { { 0, 0, 8, 3, -1 }, { 4, 0, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 635, 1883, 2266, 2, { { 15, 0, 2, 5, -1 }, { 15, 0, 1, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -241, 1692, 2180, 2, { { 4, 1, 3, 2, -1 }, { 5, 1, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 459, 1656, 2216, 2, { { 7, 0, 6, 15, -1 }, { 9, 0, 2, 15, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 309, 1841, 2306, 2, { { 6, 11, 3, 1, -1 }, { 7, 11, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 10814, 2121, 1108, 2, { { 12, 0, 3, 4, -1 }, { 13, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8099, 814, 2040, 2, { { 5, 4, 6, 1, -1 }, { 7, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4907, 2722, 2055, 2, { { 12, 7, 3, 2, -1 }, { 12, 8, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5322, 1597, 2124, 2, { { 0, 1, 4, 6, -1 }, { 0, 4, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2357, 1967, 2318, 2, { { 12, 7, 3, 2, -1 }, { 12, 8, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 874, 2134, 1621, 2, { { 2, 16, 3, 3, -1 }, { 2, 17, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -43285, 2521, 2051, 3, { { 13, 8, 6, 10, -1 }, { 16, 8, 3, 5, 2 }, { 13, 13, 3, 5, 2 } } },
+    { -534, 1629, 2142, 2, { { 0, 9, 5, 2, -1 }, { 0, 10, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1318, 2039, 2433, 3, { { 12, 11, 2, 2, -1 }, { 13, 11, 1, 1, 2 }, { 12, 12, 1, 1, 2 } } },
+    { 8394, 2042, 669, 2, { { 3, 15, 3, 3, -1 }, { 3, 16, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1246, 2419, 2024, 2, { { 12, 7, 3, 2, -1 }, { 12, 8, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 650, 1720, 2183, 2, { { 5, 7, 3, 2, -1 }, { 5, 8, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7008, 2219, 2009, 2, { { 9, 5, 9, 9, -1 }, { 9, 8, 9, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3886, 1526, 2105, 2, { { 5, 0, 3, 7, -1 }, { 6, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -41670, 2654, 2069, 2, { { 5, 2, 12, 5, -1 }, { 9, 2, 4, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1477, 1918, 2612, 3, { { 6, 11, 2, 2, -1 }, { 6, 11, 1, 1, 2 }, { 7, 12, 1, 1, 2 } } },
+    { 412, 2236, 1700, 2, { { 15, 15, 3, 2, -1 }, { 15, 16, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1990, 1511, 2109, 2, { { 2, 15, 3, 2, -1 }, { 2, 16, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -14649, 2478, 1971, 3, { { 14, 12, 6, 8, -1 }, { 17, 12, 3, 4, 2 }, { 14, 16, 3, 4, 2 } } },
+    { -105915, 826, 2045, 2, { { 2, 8, 15, 6, -1 }, { 7, 8, 5, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -18190, 2340, 2007, 2, { { 2, 2, 18, 17, -1 }, { 8, 2, 6, 17, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 164, 1727, 2209, 2, { { 5, 1, 4, 1, -1 }, { 7, 1, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 140917, 2104, 1543, 2, { { 5, 2, 12, 5, -1 }, { 9, 2, 4, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -25776, 2878, 1945, 2, { { 3, 2, 12, 5, -1 }, { 7, 2, 4, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4043, 1768, 2223, 3, { { 4, 9, 12, 4, -1 }, { 10, 9, 6, 2, 2 }, { 4, 11, 6, 2, 2 } } },
+    { -2429, 2434, 1892, 3, { { 5, 15, 6, 2, -1 }, { 5, 15, 3, 1, 2 }, { 8, 16, 3, 1, 2 } } },
+    { -5087, 2536, 2001, 2, { { 10, 14, 2, 3, -1 }, { 10, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2590, 2153, 1645, 3, { { 0, 13, 20, 2, -1 }, { 0, 13, 10, 1, 2 }, { 10, 14, 10, 1, 2 } } },
+    { 47707, 2145, 1100, 3, { { 4, 9, 12, 8, -1 }, { 10, 9, 6, 4, 2 }, { 4, 13, 6, 4, 2 } } },
+    { -21307, 873, 2040, 2, { { 8, 13, 3, 6, -1 }, { 8, 16, 3, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 283, 1972, 2270, 2, { { 10, 12, 2, 2, -1 }, { 10, 13, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1912, 2655, 1929, 3, { { 9, 12, 2, 2, -1 }, { 9, 12, 1, 1, 2 }, { 10, 13, 1, 1, 2 } } },
+    { -6608, 1877, 2173, 3, { { 4, 11, 14, 4, -1 }, { 11, 11, 7, 2, 2 }, { 4, 13, 7, 2, 2 } } },
+    { -253, 2143, 1660, 2, { { 8, 5, 4, 2, -1 }, { 8, 6, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1083, 2276, 1962, 2, { { 10, 10, 6, 3, -1 }, { 12, 10, 2, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 189, 2142, 1643, 2, { { 2, 14, 1, 2, -1 }, { 2, 15, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -64391, 2580, 2052, 3, { { 13, 8, 6, 12, -1 }, { 16, 8, 3, 6, 2 }, { 13, 14, 3, 6, 2 } } },
+    { -72922, 2961, 1955, 3, { { 1, 8, 6, 12, -1 }, { 1, 8, 3, 6, 2 }, { 4, 14, 3, 6, 2 } } },
+    { -73969, 930, 2123, 2, { { 10, 0, 6, 10, -1 }, { 12, 0, 2, 10, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2561, 2145, 1679, 3, { { 5, 11, 8, 4, -1 }, { 5, 11, 4, 2, 2 }, { 9, 13, 4, 2, 2 } } },
+    { 1625, 1955, 2240, 3, { { 10, 16, 8, 4, -1 }, { 14, 16, 4, 2, 2 }, { 10, 18, 4, 2, 2 } } },
+    { -25076, 2927, 1959, 2, { { 7, 7, 6, 6, -1 }, { 9, 7, 2, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -13059, 1079, 2147, 2, { { 10, 2, 4, 10, -1 }, { 10, 2, 2, 10, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -218, 1484, 2095, 2, { { 6, 1, 4, 9, -1 }, { 8, 1, 2, 9, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 31, 1928, 2225, 2, { { 12, 19, 2, 1, -1 }, { 12, 19, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 12345, 1581, 2630, 2, { { 1, 2, 4, 9, -1 }, { 3, 2, 2, 9, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 28351, 1796, 2766, 2, { { 7, 5, 6, 4, -1 }, { 9, 5, 2, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -38, 2248, 1402, 2, { { 9, 4, 2, 4, -1 }, { 9, 6, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2097, 1323, 2212, 2, { { 14, 5, 2, 8, -1 }, { 14, 9, 2, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4748, 2086, 1202, 2, { { 7, 6, 5, 12, -1 }, { 7, 12, 5, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 502, 1711, 2189, 2, { { 14, 6, 2, 6, -1 }, { 14, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1229, 1188, 2102, 2, { { 4, 6, 2, 6, -1 }, { 4, 9, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 999, 1753, 2278, 3, { { 8, 15, 10, 4, -1 }, { 13, 15, 5, 2, 2 }, { 8, 17, 5, 2, 2 } } },
+    { 16, 1657, 2214, 2, { { 6, 18, 2, 2, -1 }, { 7, 18, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -638, 1750, 2254, 2, { { 11, 3, 6, 2, -1 }, { 11, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3484, 1623, 2199, 2, { { 2, 0, 16, 6, -1 }, { 2, 2, 16, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1157, 1936, 2145, 2, { { 11, 3, 6, 2, -1 }, { 11, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1505, 2295, 1730, 2, { { 4, 11, 10, 3, -1 }, { 4, 12, 10, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2178, 2141, 1939, 2, { { 11, 3, 6, 2, -1 }, { 11, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -172, 1638, 2225, 2, { { 3, 3, 6, 2, -1 }, { 3, 4, 6, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 9259, 1916, 2469, 2, { { 16, 0, 4, 7, -1 }, { 16, 0, 2, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -11065, 1431, 2136, 2, { { 0, 14, 9, 6, -1 }, { 0, 16, 9, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2384, 2534, 1945, 2, { { 9, 16, 3, 3, -1 }, { 9, 17, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -889, 2165, 1574, 2, { { 4, 6, 6, 2, -1 }, { 6, 6, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1267, 2196, 1412, 2, { { 15, 11, 1, 3, -1 }, { 15, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2780, 1867, 2537, 2, { { 5, 5, 2, 3, -1 }, { 5, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1155, 1507, 2182, 2, { { 10, 9, 2, 2, -1 }, { 10, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 520, 1622, 2161, 2, { { 3, 1, 4, 3, -1 }, { 5, 1, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -46034, 2876, 2045, 2, { { 16, 0, 4, 7, -1 }, { 16, 0, 2, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 36375, 2068, 1133, 2, { { 0, 0, 20, 1, -1 }, { 10, 0, 10, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2878, 1095, 2161, 2, { { 15, 11, 1, 3, -1 }, { 15, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3493, 1876, 2458, 2, { { 0, 4, 3, 4, -1 }, { 1, 4, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -21018, 1299, 2145, 2, { { 16, 3, 3, 6, -1 }, { 16, 5, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1415, 2157, 1652, 2, { { 1, 3, 3, 6, -1 }, { 1, 5, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3114, 2184, 1873, 3, { { 6, 2, 12, 6, -1 }, { 12, 2, 6, 3, 2 }, { 6, 5, 6, 3, 2 } } },
+    { 6610, 1881, 2472, 2, { { 8, 10, 4, 3, -1 }, { 8, 11, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -13565, 1818, 2201, 3, { { 4, 2, 14, 6, -1 }, { 11, 2, 7, 3, 2 }, { 4, 5, 7, 3, 2 } } },
+    { 4210, 1917, 2637, 2, { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2768, 1519, 2177, 2, { { 15, 13, 2, 3, -1 }, { 15, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 14595, 1935, 2921, 2, { { 8, 12, 4, 3, -1 }, { 8, 13, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -473, 1840, 2200, 2, { { 15, 11, 1, 3, -1 }, { 15, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 266, 1805, 2259, 2, { { 7, 13, 5, 2, -1 }, { 7, 14, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2381, 1918, 2444, 2, { { 7, 12, 6, 3, -1 }, { 7, 13, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2529, 2081, 1236, 2, { { 5, 11, 4, 4, -1 }, { 5, 13, 4, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -38, 2294, 1831, 2, { { 11, 4, 3, 3, -1 }, { 12, 4, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7854, 904, 2044, 2, { { 6, 4, 3, 3, -1 }, { 7, 4, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -18364, 2675, 2055, 2, { { 16, 5, 3, 6, -1 }, { 17, 5, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 149754, 2035, 607, 2, { { 3, 6, 12, 7, -1 }, { 7, 6, 4, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5803, 2007, 2439, 2, { { 16, 5, 3, 6, -1 }, { 17, 5, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1010, 1609, 2128, 2, { { 3, 13, 2, 3, -1 }, { 3, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2136, 2299, 2001, 2, { { 16, 5, 3, 6, -1 }, { 17, 5, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1742, 1832, 2285, 2, { { 1, 5, 3, 6, -1 }, { 2, 5, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3270, 1573, 2211, 2, { { 1, 9, 18, 1, -1 }, { 7, 9, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6711, 2394, 1857, 2, { { 0, 9, 8, 7, -1 }, { 4, 9, 4, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 328, 2228, 1735, 2, { { 12, 11, 8, 2, -1 }, { 12, 12, 8, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -19107, 528, 2031, 2, { { 0, 11, 8, 2, -1 }, { 0, 12, 8, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 9224, 2028, 2930, 2, { { 9, 13, 2, 3, -1 }, { 9, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4445, 1617, 2128, 3, { { 4, 10, 12, 4, -1 }, { 4, 10, 6, 2, 2 }, { 10, 12, 6, 2, 2 } } },
+    { 10180, 2006, 2484, 2, { { 9, 3, 3, 7, -1 }, { 10, 3, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -4187, 1329, 2073, 2, { { 7, 2, 3, 5, -1 }, { 8, 2, 1, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -17600, 648, 2131, 3, { { 9, 12, 4, 6, -1 }, { 11, 12, 2, 3, 2 }, { 9, 15, 2, 3, 2 } } },
+    { 19160, 1917, 2714, 2, { { 8, 7, 3, 6, -1 }, { 9, 7, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5964, 2135, 1439, 2, { { 15, 4, 4, 2, -1 }, { 15, 5, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1126, 2363, 1855, 2, { { 8, 7, 3, 3, -1 }, { 9, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3890, 1846, 2176, 2, { { 14, 2, 6, 4, -1 }, { 14, 4, 6, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -221, 2237, 1775, 2, { { 7, 16, 6, 1, -1 }, { 9, 16, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1119, 2200, 1671, 2, { { 15, 13, 2, 3, -1 }, { 15, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3769, 1831, 2312, 2, { { 8, 7, 3, 10, -1 }, { 9, 7, 1, 10, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5429, 1843, 2163, 2, { { 11, 10, 2, 6, -1 }, { 11, 12, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -266, 2259, 1805, 2, { { 6, 10, 4, 1, -1 }, { 8, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 6661, 2128, 1010, 2, { { 10, 9, 2, 2, -1 }, { 10, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -464, 1569, 2105, 2, { { 8, 9, 2, 2, -1 }, { 8, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 781, 2003, 2447, 3, { { 12, 7, 2, 2, -1 }, { 13, 7, 1, 1, 2 }, { 12, 8, 1, 1, 2 } } },
+    { -3682, 3037, 1953, 3, { { 5, 7, 2, 2, -1 }, { 5, 7, 1, 1, 2 }, { 6, 8, 1, 1, 2 } } },
+    { -13150, 1495, 2152, 2, { { 13, 0, 3, 14, -1 }, { 14, 0, 1, 14, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 9954, 2089, 1487, 2, { { 4, 0, 3, 14, -1 }, { 5, 0, 1, 14, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 13591, 2143, 1775, 2, { { 13, 4, 3, 14, -1 }, { 14, 4, 1, 14, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4950, 1904, 2593, 2, { { 9, 14, 2, 3, -1 }, { 9, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2424, 2429, 1856, 2, { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2964, 1585, 2153, 2, { { 4, 2, 3, 16, -1 }, { 5, 2, 1, 16, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1501, 2262, 1869, 2, { { 7, 2, 8, 10, -1 }, { 7, 7, 8, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2032, 1862, 2350, 2, { { 6, 14, 7, 3, -1 }, { 6, 15, 7, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 276, 2190, 1873, 3, { { 9, 2, 10, 12, -1 }, { 14, 2, 5, 6, 2 }, { 9, 8, 5, 6, 2 } } },
+    { 821, 1625, 2138, 2, { { 6, 7, 8, 2, -1 }, { 6, 8, 8, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -20500, 1159, 2148, 2, { { 8, 13, 4, 6, -1 }, { 8, 16, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 460, 1880, 2416, 2, { { 6, 6, 1, 3, -1 }, { 6, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 22494, 2143, 1170, 2, { { 16, 2, 4, 6, -1 }, { 16, 4, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 618, 1801, 2255, 3, { { 6, 6, 4, 2, -1 }, { 6, 6, 2, 1, 2 }, { 8, 7, 2, 1, 2 } } },
+    { -27428, 1284, 2125, 2, { { 16, 2, 4, 6, -1 }, { 16, 4, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -14638, 1316, 2065, 2, { { 0, 2, 4, 6, -1 }, { 0, 4, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6679, 2616, 1986, 2, { { 9, 6, 2, 6, -1 }, { 9, 6, 1, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -8977, 1130, 2061, 2, { { 3, 4, 6, 10, -1 }, { 3, 9, 6, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1013, 1919, 2390, 2, { { 9, 5, 2, 6, -1 }, { 9, 5, 1, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 803, 2120, 1596, 2, { { 3, 13, 2, 3, -1 }, { 3, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8581, 848, 2133, 2, { { 13, 13, 3, 2, -1 }, { 13, 14, 3, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -9854, 2513, 1901, 3, { { 2, 16, 10, 4, -1 }, { 2, 16, 5, 2, 2 }, { 7, 18, 5, 2, 2 } } },
+    { 5036, 2234, 1800, 3, { { 5, 6, 10, 6, -1 }, { 10, 6, 5, 3, 2 }, { 5, 9, 5, 3, 2 } } },
+    { -3741, 2599, 1917, 2, { { 7, 14, 1, 3, -1 }, { 7, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4271, 2168, 1645, 2, { { 14, 16, 6, 3, -1 }, { 14, 17, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1318, 1799, 2233, 2, { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3048, 2416, 1992, 2, { { 7, 4, 10, 3, -1 }, { 7, 5, 10, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2560, 1667, 2149, 2, { { 0, 4, 5, 4, -1 }, { 0, 6, 5, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 26037, 2123, 1508, 2, { { 13, 11, 3, 9, -1 }, { 13, 14, 3, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -51227, 536, 2032, 2, { { 4, 11, 3, 9, -1 }, { 4, 14, 3, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1689, 2630, 1996, 2, { { 9, 7, 2, 1, -1 }, { 9, 7, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -101722, 196, 2028, 2, { { 5, 0, 6, 17, -1 }, { 7, 0, 2, 17, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1175, 1891, 2193, 2, { { 10, 3, 6, 3, -1 }, { 10, 3, 3, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1370, 2565, 1900, 2, { { 2, 2, 15, 4, -1 }, { 7, 2, 5, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 480, 2205, 1903, 3, { { 8, 2, 8, 2, -1 }, { 12, 2, 4, 1, 2 }, { 8, 3, 4, 1, 2 } } },
+    { -662, 1558, 2101, 2, { { 8, 1, 3, 6, -1 }, { 8, 3, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 152, 1865, 2320, 2, { { 9, 17, 2, 2, -1 }, { 9, 18, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -17275, 2702, 1932, 2, { { 0, 0, 2, 14, -1 }, { 1, 0, 1, 14, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 14019, 2128, 1244, 2, { { 12, 0, 7, 3, -1 }, { 12, 1, 7, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 108, 2142, 1682, 2, { { 1, 14, 1, 2, -1 }, { 1, 15, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5800, 2602, 2032, 3, { { 14, 12, 2, 8, -1 }, { 15, 12, 1, 4, 2 }, { 14, 16, 1, 4, 2 } } },
+    { -2746, 1567, 2106, 2, { { 1, 0, 7, 3, -1 }, { 1, 1, 7, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5330, 2028, 2548, 3, { { 14, 12, 2, 8, -1 }, { 15, 12, 1, 4, 2 }, { 14, 16, 1, 4, 2 } } },
+    { 83695, 2028, 542, 3, { { 6, 0, 8, 12, -1 }, { 6, 0, 4, 6, 2 }, { 10, 6, 4, 6, 2 } } },
+    { -104047, 3090, 2051, 2, { { 6, 1, 8, 9, -1 }, { 6, 4, 8, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -683, 1515, 2101, 2, { { 5, 2, 2, 2, -1 }, { 5, 3, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -19920, 2740, 2016, 3, { { 13, 14, 6, 6, -1 }, { 16, 14, 3, 3, 2 }, { 13, 17, 3, 3, 2 } } },
+    { 18190, 2041, 762, 3, { { 0, 17, 20, 2, -1 }, { 0, 17, 10, 1, 2 }, { 10, 18, 10, 1, 2 } } },
+    { 578, 1874, 2262, 3, { { 10, 3, 2, 6, -1 }, { 11, 3, 1, 3, 2 }, { 10, 6, 1, 3, 2 } } },
+    { 2103, 2102, 1580, 2, { { 5, 12, 6, 2, -1 }, { 8, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -8146, 1787, 2226, 2, { { 10, 7, 6, 13, -1 }, { 10, 7, 3, 13, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 53350, 1918, 2802, 2, { { 5, 15, 10, 5, -1 }, { 10, 15, 5, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2401, 1773, 2173, 2, { { 10, 4, 4, 10, -1 }, { 10, 4, 2, 10, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -165, 2200, 1793, 2, { { 5, 7, 2, 1, -1 }, { 6, 7, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 110302, 2104, 276, 2, { { 10, 3, 6, 7, -1 }, { 10, 3, 3, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2852, 1684, 2153, 2, { { 4, 3, 6, 7, -1 }, { 7, 3, 3, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 50686, 2214, 1818, 2, { { 1, 7, 18, 5, -1 }, { 7, 7, 6, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1004, 1784, 2212, 2, { { 3, 17, 4, 3, -1 }, { 5, 17, 2, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -26604, 2456, 2061, 3, { { 8, 14, 12, 6, -1 }, { 14, 14, 6, 3, 2 }, { 8, 17, 6, 3, 2 } } },
+    { 55006, 2028, 573, 3, { { 0, 13, 20, 4, -1 }, { 0, 13, 10, 2, 2 }, { 10, 15, 10, 2, 2 } } },
+    { -12966, 2620, 2033, 3, { { 4, 5, 14, 2, -1 }, { 11, 5, 7, 1, 2 }, { 4, 6, 7, 1, 2 } } },
+    { -152984, 410, 2026, 3, { { 1, 2, 10, 12, -1 }, { 1, 2, 5, 6, 2 }, { 6, 8, 5, 6, 2 } } },
+    { -16681, 1357, 2133, 2, { { 6, 1, 14, 3, -1 }, { 6, 2, 14, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 414, 1805, 2223, 2, { { 8, 16, 2, 3, -1 }, { 8, 17, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5500, 1147, 2126, 2, { { 9, 17, 3, 2, -1 }, { 10, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5287, 2862, 1946, 3, { { 5, 15, 4, 2, -1 }, { 5, 15, 2, 1, 2 }, { 7, 16, 2, 1, 2 } } },
+    { 3126, 2041, 2584, 2, { { 10, 15, 1, 3, -1 }, { 10, 16, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7642, 1222, 2059, 3, { { 8, 16, 4, 4, -1 }, { 8, 16, 2, 2, 2 }, { 10, 18, 2, 2, 2 } } },
+    { 1583, 2174, 1570, 2, { { 6, 11, 8, 6, -1 }, { 6, 14, 8, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -9787, 835, 2036, 2, { { 2, 13, 5, 2, -1 }, { 2, 14, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 30060, 2059, 2838, 3, { { 13, 14, 6, 6, -1 }, { 16, 14, 3, 3, 2 }, { 13, 17, 3, 3, 2 } } },
+    { 178464, 2032, 605, 2, { { 1, 9, 18, 4, -1 }, { 7, 9, 6, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3420, 2295, 1977, 3, { { 13, 14, 6, 6, -1 }, { 16, 14, 3, 3, 2 }, { 13, 17, 3, 3, 2 } } },
+    { 585, 2132, 1691, 2, { { 0, 2, 1, 6, -1 }, { 0, 4, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 380196, 2139, 1544, 2, { { 5, 0, 15, 20, -1 }, { 5, 10, 15, 10, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -12179, 2467, 1900, 3, { { 1, 14, 6, 6, -1 }, { 1, 14, 3, 3, 2 }, { 4, 17, 3, 3, 2 } } },
+    { -4278, 1667, 2186, 3, { { 8, 14, 4, 6, -1 }, { 10, 14, 2, 3, 2 }, { 8, 17, 2, 3, 2 } } },
+    { 600, 1885, 2417, 2, { { 7, 11, 2, 1, -1 }, { 8, 11, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 708, 2211, 1780, 2, { { 9, 17, 3, 2, -1 }, { 10, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 664, 2131, 1659, 2, { { 8, 17, 3, 2, -1 }, { 9, 17, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1304, 1902, 2272, 3, { { 12, 14, 4, 6, -1 }, { 14, 14, 2, 3, 2 }, { 12, 17, 2, 3, 2 } } },
+    { -4966, 2539, 1914, 3, { { 4, 14, 4, 6, -1 }, { 4, 14, 2, 3, 2 }, { 6, 17, 2, 3, 2 } } },
+    { -6780, 2801, 2056, 3, { { 13, 14, 2, 6, -1 }, { 14, 14, 1, 3, 2 }, { 13, 17, 1, 3, 2 } } },
+    { 367, 1780, 2197, 3, { { 5, 14, 2, 6, -1 }, { 5, 14, 1, 3, 2 }, { 6, 17, 1, 3, 2 } } },
+    { 165, 1950, 2348, 2, { { 7, 0, 6, 12, -1 }, { 7, 4, 6, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 10462, 2085, 1489, 2, { { 0, 7, 12, 2, -1 }, { 4, 7, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -435, 2281, 1882, 2, { { 10, 3, 3, 13, -1 }, { 11, 3, 1, 13, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -376, 2194, 1777, 2, { { 7, 3, 3, 13, -1 }, { 8, 3, 1, 13, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 424, 1819, 2227, 2, { { 10, 8, 6, 3, -1 }, { 10, 9, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -862, 1656, 2120, 2, { { 3, 11, 3, 2, -1 }, { 4, 11, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6236, 2018, 2308, 3, { { 13, 12, 6, 8, -1 }, { 16, 12, 3, 4, 2 }, { 13, 16, 3, 4, 2 } } },
+    { -22810, 3279, 1966, 2, { { 7, 6, 6, 5, -1 }, { 9, 6, 2, 5, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -15247, 1616, 2123, 2, { { 17, 11, 2, 7, -1 }, { 17, 11, 1, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -42479, 87, 2022, 2, { { 3, 13, 8, 2, -1 }, { 7, 13, 4, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -613, 1644, 2177, 2, { { 6, 9, 8, 3, -1 }, { 6, 10, 8, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5783, 1902, 2415, 2, { { 4, 3, 4, 3, -1 }, { 4, 4, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6357, 2663, 2055, 2, { { 11, 3, 4, 3, -1 }, { 11, 4, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 99128, 2156, 1690, 2, { { 1, 4, 17, 12, -1 }, { 1, 8, 17, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4961, 1999, 2414, 2, { { 11, 3, 4, 3, -1 }, { 11, 4, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -551, 1605, 2126, 2, { { 4, 8, 6, 3, -1 }, { 4, 9, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2670, 2391, 2042, 2, { { 12, 3, 5, 3, -1 }, { 12, 4, 5, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -27342, 517, 2030, 2, { { 1, 11, 2, 7, -1 }, { 2, 11, 1, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5744, 2344, 2052, 3, { { 15, 12, 2, 8, -1 }, { 16, 12, 1, 4, 2 }, { 15, 16, 1, 4, 2 } } },
+    { 5383, 2160, 1731, 2, { { 4, 8, 11, 3, -1 }, { 4, 9, 11, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 503, 1823, 2384, 3, { { 9, 13, 6, 2, -1 }, { 12, 13, 3, 1, 2 }, { 9, 14, 3, 1, 2 } } },
+    { -2214, 2358, 1848, 2, { { 6, 13, 4, 3, -1 }, { 6, 14, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -13820, 772, 2114, 2, { { 9, 12, 3, 3, -1 }, { 10, 12, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5030, 2699, 1940, 2, { { 5, 3, 3, 3, -1 }, { 5, 4, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7076, 2154, 1375, 2, { { 9, 4, 2, 3, -1 }, { 9, 5, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1533, 2194, 1747, 2, { { 0, 2, 16, 3, -1 }, { 0, 3, 16, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4996, 2062, 2370, 3, { { 15, 12, 2, 8, -1 }, { 16, 12, 1, 4, 2 }, { 15, 16, 1, 4, 2 } } },
+    { 7137, 1948, 2735, 3, { { 3, 12, 2, 8, -1 }, { 3, 12, 1, 4, 2 }, { 4, 16, 1, 4, 2 } } },
+    { 3839, 2199, 1766, 2, { { 14, 13, 3, 6, -1 }, { 14, 15, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 22492, 2035, 774, 2, { { 3, 13, 3, 6, -1 }, { 3, 15, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4370, 2020, 2382, 3, { { 6, 5, 10, 2, -1 }, { 11, 5, 5, 1, 2 }, { 6, 6, 5, 1, 2 } } },
+    { 9067, 2132, 1693, 2, { { 2, 14, 14, 6, -1 }, { 2, 17, 14, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -379, 2246, 1966, 2, { { 10, 14, 1, 3, -1 }, { 10, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1133, 1921, 2475, 3, { { 4, 16, 2, 2, -1 }, { 4, 16, 1, 1, 2 }, { 5, 17, 1, 1, 2 } } },
+    { 6052, 2118, 1251, 2, { { 10, 6, 2, 3, -1 }, { 10, 7, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1648, 2138, 1712, 3, { { 0, 17, 20, 2, -1 }, { 0, 17, 10, 1, 2 }, { 10, 18, 10, 1, 2 } } },
+    { -2025, 2400, 1971, 2, { { 13, 6, 1, 3, -1 }, { 13, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8276, 717, 2036, 2, { { 8, 13, 3, 2, -1 }, { 9, 13, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2330, 1779, 2135, 2, { { 12, 2, 3, 3, -1 }, { 13, 2, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1994, 1952, 2823, 3, { { 3, 18, 2, 2, -1 }, { 3, 18, 1, 1, 2 }, { 4, 19, 1, 1, 2 } } },
+    { 2892, 2155, 1777, 2, { { 9, 16, 3, 4, -1 }, { 10, 16, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5430, 1968, 3213, 2, { { 6, 6, 1, 3, -1 }, { 6, 7, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -947, 1688, 2193, 2, { { 13, 1, 5, 2, -1 }, { 13, 2, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5431, 1942, 2632, 3, { { 7, 14, 6, 2, -1 }, { 7, 14, 3, 1, 2 }, { 10, 15, 3, 1, 2 } } },
+    { -10605, 1011, 2120, 2, { { 11, 3, 3, 4, -1 }, { 12, 3, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -19521, 2358, 1896, 2, { { 1, 13, 12, 6, -1 }, { 5, 13, 4, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6210, 2117, 1317, 2, { { 14, 11, 5, 2, -1 }, { 14, 12, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6600, 1586, 2106, 3, { { 2, 15, 14, 4, -1 }, { 2, 15, 7, 2, 2 }, { 9, 17, 7, 2, 2 } } },
+    { 6853, 1988, 2585, 3, { { 3, 7, 14, 2, -1 }, { 10, 7, 7, 1, 2 }, { 3, 8, 7, 1, 2 } } },
+    { 1141, 2096, 1525, 2, { { 1, 11, 4, 2, -1 }, { 1, 12, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -23637, 2332, 2002, 2, { { 14, 0, 6, 14, -1 }, { 16, 0, 2, 14, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3153, 1047, 2050, 2, { { 4, 11, 1, 3, -1 }, { 4, 12, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7837, 1971, 2325, 2, { { 14, 0, 6, 14, -1 }, { 16, 0, 2, 14, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 27433, 2036, 728, 2, { { 1, 10, 3, 7, -1 }, { 2, 10, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 989, 2023, 2249, 2, { { 8, 12, 9, 2, -1 }, { 8, 13, 9, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 34984, 2051, 1143, 2, { { 0, 6, 20, 1, -1 }, { 10, 6, 10, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -15853, 2892, 2037, 2, { { 8, 4, 4, 4, -1 }, { 8, 4, 2, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1034, 2101, 1547, 2, { { 0, 0, 2, 2, -1 }, { 0, 1, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -99773, 2650, 1645, 2, { { 5, 3, 10, 9, -1 }, { 5, 6, 10, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6575, 1638, 2354, 2, { { 15, 2, 4, 10, -1 }, { 15, 2, 2, 10, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 315, 1458, 2269, 2, { { 8, 2, 2, 7, -1 }, { 9, 2, 1, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1233, 1743, 2205, 2, { { 7, 4, 12, 1, -1 }, { 11, 4, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 46, 1509, 2290, 2, { { 3, 4, 9, 1, -1 }, { 6, 4, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -31, 2233, 1647, 2, { { 15, 10, 1, 4, -1 }, { 15, 12, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3153, 2146, 1359, 2, { { 4, 10, 6, 4, -1 }, { 7, 10, 3, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -11025, 1770, 2174, 2, { { 15, 9, 1, 6, -1 }, { 15, 12, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 8753, 1845, 2643, 2, { { 7, 17, 6, 3, -1 }, { 7, 18, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3302, 1767, 2200, 3, { { 14, 3, 2, 16, -1 }, { 15, 3, 1, 8, 2 }, { 14, 11, 1, 8, 2 } } },
+    { -15, 2182, 1564, 2, { { 4, 9, 1, 6, -1 }, { 4, 12, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -449, 1763, 2204, 2, { { 12, 1, 5, 2, -1 }, { 12, 2, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 158, 1735, 2271, 3, { { 6, 18, 4, 2, -1 }, { 6, 18, 2, 1, 2 }, { 8, 19, 2, 1, 2 } } },
+    { 75036, 2172, 1097, 3, { { 2, 4, 16, 10, -1 }, { 10, 4, 8, 5, 2 }, { 2, 9, 8, 5, 2 } } },
+    { 882, 1457, 2132, 2, { { 6, 5, 1, 10, -1 }, { 6, 10, 1, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 66046, 2140, 1172, 2, { { 4, 8, 15, 2, -1 }, { 9, 8, 5, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3544, 1484, 2131, 2, { { 1, 8, 15, 2, -1 }, { 6, 8, 5, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -124, 2242, 1622, 2, { { 9, 5, 3, 6, -1 }, { 9, 7, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -572, 1532, 2136, 2, { { 5, 7, 8, 2, -1 }, { 9, 7, 4, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1935, 2414, 1878, 2, { { 9, 11, 2, 3, -1 }, { 9, 12, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -460, 1673, 2206, 2, { { 1, 0, 16, 3, -1 }, { 1, 1, 16, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2517, 1547, 2168, 2, { { 11, 2, 7, 2, -1 }, { 11, 3, 7, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -103595, 1214, 2077, 2, { { 5, 1, 10, 18, -1 }, { 5, 7, 10, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3334, 1998, 2755, 2, { { 17, 4, 3, 2, -1 }, { 18, 4, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 340, 1789, 2278, 2, { { 8, 13, 1, 3, -1 }, { 8, 14, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -34128, 1281, 2174, 2, { { 3, 14, 14, 6, -1 }, { 3, 16, 14, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -8133, 2687, 1900, 2, { { 0, 2, 3, 4, -1 }, { 1, 2, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 16806, 2119, 1287, 2, { { 12, 1, 5, 2, -1 }, { 12, 2, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7, 1673, 2186, 2, { { 3, 1, 5, 2, -1 }, { 3, 2, 5, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 7699, 2034, 2705, 2, { { 10, 13, 2, 3, -1 }, { 10, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1779, 2420, 1843, 2, { { 8, 13, 2, 3, -1 }, { 8, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2529, 2177, 1474, 2, { { 14, 12, 2, 3, -1 }, { 14, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -5799, 956, 2047, 2, { { 7, 2, 2, 3, -1 }, { 7, 3, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2776, 2409, 1919, 3, { { 5, 6, 10, 4, -1 }, { 10, 6, 5, 2, 2 }, { 5, 8, 5, 2, 2 } } },
+    { 11844, 2041, 772, 2, { { 9, 13, 1, 6, -1 }, { 9, 16, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -702, 2405, 1966, 3, { { 10, 12, 2, 2, -1 }, { 11, 12, 1, 1, 2 }, { 10, 13, 1, 1, 2 } } },
+    { 1511, 2102, 1434, 2, { { 4, 12, 2, 3, -1 }, { 4, 13, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2583, 2187, 1687, 2, { { 14, 4, 6, 6, -1 }, { 14, 6, 6, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 347, 1767, 2211, 2, { { 8, 17, 2, 3, -1 }, { 8, 18, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -35187, 1096, 2121, 2, { { 16, 4, 4, 6, -1 }, { 16, 6, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 19440, 2037, 949, 2, { { 0, 4, 4, 6, -1 }, { 0, 6, 4, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -311, 2265, 1902, 2, { { 14, 6, 2, 3, -1 }, { 14, 6, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -478, 2306, 1831, 2, { { 4, 9, 8, 1, -1 }, { 8, 9, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -10652, 2747, 2018, 2, { { 8, 12, 4, 3, -1 }, { 8, 13, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -24, 2146, 1603, 2, { { 5, 12, 10, 6, -1 }, { 5, 14, 10, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 76, 1966, 2254, 2, { { 11, 12, 1, 2, -1 }, { 11, 13, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -7263, 2839, 1924, 2, { { 8, 15, 4, 2, -1 }, { 8, 16, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -8074, 1679, 2245, 3, { { 6, 9, 8, 8, -1 }, { 10, 9, 4, 4, 2 }, { 6, 13, 4, 4, 2 } } },
+    { -7668, 1345, 2072, 3, { { 7, 12, 4, 6, -1 }, { 7, 12, 2, 3, 2 }, { 9, 15, 2, 3, 2 } } },
+    { 2061, 2039, 2621, 2, { { 10, 11, 3, 1, -1 }, { 11, 11, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7513, 1909, 2549, 3, { { 9, 7, 2, 10, -1 }, { 9, 7, 1, 5, 2 }, { 10, 12, 1, 5, 2 } } },
+    { -25248, 956, 2139, 2, { { 8, 0, 6, 6, -1 }, { 10, 0, 2, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -22049, 485, 2023, 2, { { 3, 11, 2, 6, -1 }, { 3, 13, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 378, 2181, 1686, 2, { { 16, 12, 1, 2, -1 }, { 16, 13, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -18056, 2572, 1910, 3, { { 1, 14, 6, 6, -1 }, { 1, 14, 3, 3, 2 }, { 4, 17, 3, 3, 2 } } },
+    { -8249, 1394, 2150, 2, { { 13, 1, 3, 6, -1 }, { 14, 1, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -470, 1479, 2083, 2, { { 8, 8, 2, 2, -1 }, { 8, 9, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5818, 2001, 2541, 2, { { 9, 9, 3, 3, -1 }, { 10, 9, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7284, 1076, 2053, 2, { { 8, 7, 3, 3, -1 }, { 8, 8, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 142, 1778, 2305, 2, { { 14, 0, 2, 3, -1 }, { 14, 0, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -48109, 2666, 1924, 2, { { 1, 0, 18, 9, -1 }, { 7, 0, 6, 9, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -22631, 1567, 2166, 2, { { 11, 5, 4, 15, -1 }, { 11, 5, 2, 15, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -21191, 1324, 2079, 2, { { 5, 5, 4, 15, -1 }, { 7, 5, 2, 15, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 6134, 2121, 1839, 2, { { 14, 0, 2, 3, -1 }, { 14, 0, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -60, 1647, 2149, 2, { { 4, 0, 2, 3, -1 }, { 5, 0, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1207, 2587, 2009, 3, { { 11, 12, 2, 2, -1 }, { 12, 12, 1, 1, 2 }, { 11, 13, 1, 1, 2 } } },
+    { 2083, 1926, 2661, 3, { { 7, 12, 2, 2, -1 }, { 7, 12, 1, 1, 2 }, { 8, 13, 1, 1, 2 } } },
+    { -5528, 1495, 2141, 2, { { 12, 0, 3, 4, -1 }, { 13, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1328, 2116, 1588, 2, { { 4, 11, 3, 3, -1 }, { 4, 12, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -6598, 3021, 2058, 2, { { 12, 7, 4, 2, -1 }, { 12, 8, 4, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 706, 1812, 2251, 2, { { 8, 10, 3, 2, -1 }, { 9, 10, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1103, 2448, 1990, 2, { { 9, 9, 3, 2, -1 }, { 10, 9, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -464, 2440, 1802, 2, { { 8, 9, 3, 2, -1 }, { 9, 9, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1232, 2191, 1886, 2, { { 12, 0, 3, 4, -1 }, { 13, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5501, 2068, 1205, 2, { { 5, 0, 3, 4, -1 }, { 6, 0, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -25732, 1045, 2138, 3, { { 4, 14, 12, 4, -1 }, { 10, 14, 6, 2, 2 }, { 4, 16, 6, 2, 2 } } },
+    { 774, 1812, 2249, 2, { { 8, 13, 2, 3, -1 }, { 8, 14, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1493, 2179, 1672, 2, { { 10, 10, 3, 8, -1 }, { 10, 14, 3, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2532, 1674, 2146, 3, { { 8, 10, 4, 8, -1 }, { 8, 10, 2, 4, 2 }, { 10, 14, 2, 4, 2 } } },
+    { -1276, 2324, 2010, 2, { { 10, 8, 3, 1, -1 }, { 11, 8, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1304, 1691, 2153, 2, { { 9, 12, 1, 6, -1 }, { 9, 15, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 6495, 2073, 2996, 2, { { 10, 8, 3, 1, -1 }, { 11, 8, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1741, 2449, 1883, 2, { { 7, 8, 3, 1, -1 }, { 8, 8, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -28643, 1710, 2175, 2, { { 5, 2, 15, 14, -1 }, { 5, 9, 15, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1662, 2300, 1851, 3, { { 2, 1, 2, 10, -1 }, { 2, 1, 1, 5, 2 }, { 3, 6, 1, 5, 2 } } },
+    { -1627, 1670, 2196, 2, { { 14, 14, 2, 3, -1 }, { 14, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 403, 1781, 2224, 2, { { 2, 7, 3, 3, -1 }, { 3, 7, 1, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -15385, 680, 2108, 2, { { 17, 4, 3, 3, -1 }, { 17, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8557, 2032, 772, 2, { { 0, 4, 3, 3, -1 }, { 0, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1166, 1994, 2496, 3, { { 13, 5, 6, 2, -1 }, { 16, 5, 3, 1, 2 }, { 13, 6, 3, 1, 2 } } },
+    { -7613, 2574, 1921, 2, { { 4, 19, 12, 1, -1 }, { 8, 19, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -252, 2284, 1657, 2, { { 12, 12, 2, 4, -1 }, { 12, 14, 2, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -245, 1686, 2152, 2, { { 3, 15, 1, 3, -1 }, { 3, 16, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5844, 1937, 2331, 2, { { 11, 16, 6, 4, -1 }, { 11, 16, 3, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 32111, 2036, 713, 2, { { 2, 10, 3, 10, -1 }, { 3, 10, 1, 10, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 965, 2200, 1784, 2, { { 12, 8, 2, 4, -1 }, { 12, 8, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -46, 2198, 1781, 2, { { 6, 8, 2, 4, -1 }, { 7, 8, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -6968, 1407, 2114, 2, { { 10, 14, 2, 3, -1 }, { 10, 14, 1, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 45322, 1952, 2987, 2, { { 5, 1, 10, 3, -1 }, { 10, 1, 5, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2342, 2060, 2307, 2, { { 10, 7, 3, 2, -1 }, { 11, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3338, 1645, 2127, 2, { { 5, 6, 9, 2, -1 }, { 8, 6, 3, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -189, 1675, 2219, 2, { { 9, 8, 2, 2, -1 }, { 9, 9, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5551, 1669, 2148, 3, { { 2, 11, 16, 6, -1 }, { 2, 11, 8, 3, 2 }, { 10, 14, 8, 3, 2 } } },
+    { 1337, 2012, 2616, 3, { { 12, 7, 2, 2, -1 }, { 13, 7, 1, 1, 2 }, { 12, 8, 1, 1, 2 } } },
+    { 4549, 2061, 1207, 2, { { 9, 5, 2, 3, -1 }, { 9, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 8939, 2027, 2584, 2, { { 9, 7, 3, 2, -1 }, { 10, 7, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -988, 2182, 1755, 2, { { 5, 1, 8, 12, -1 }, { 5, 7, 8, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1427, 2045, 2434, 2, { { 13, 5, 2, 2, -1 }, { 13, 6, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 470, 1873, 2398, 2, { { 5, 5, 2, 2, -1 }, { 5, 6, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1401, 1886, 2396, 2, { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -639, 1626, 2142, 2, { { 4, 14, 2, 3, -1 }, { 4, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2481, 2379, 2006, 2, { { 12, 4, 3, 3, -1 }, { 12, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1126, 1782, 2241, 2, { { 5, 4, 3, 3, -1 }, { 5, 5, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2299, 2193, 1574, 3, { { 9, 14, 2, 6, -1 }, { 10, 14, 1, 3, 2 }, { 9, 17, 1, 3, 2 } } },
+    { 5764, 2055, 1158, 2, { { 8, 14, 3, 2, -1 }, { 9, 14, 1, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -79030, 502, 2109, 2, { { 9, 5, 6, 6, -1 }, { 11, 5, 2, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 26355, 1938, 2878, 2, { { 5, 5, 6, 6, -1 }, { 7, 5, 2, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -31, 2224, 1907, 2, { { 13, 13, 1, 2, -1 }, { 13, 14, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -612, 1651, 2126, 2, { { 0, 2, 10, 2, -1 }, { 0, 3, 10, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2793, 1765, 2114, 2, { { 13, 13, 1, 2, -1 }, { 13, 14, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -1447, 2548, 1923, 3, { { 5, 7, 2, 2, -1 }, { 5, 7, 1, 1, 2 }, { 6, 8, 1, 1, 2 } } },
+    { 1291, 2203, 1813, 2, { { 13, 5, 2, 7, -1 }, { 13, 5, 1, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -15, 2163, 1730, 2, { { 6, 13, 1, 2, -1 }, { 6, 14, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -13441, 1058, 2122, 2, { { 11, 0, 3, 7, -1 }, { 12, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 23962, 1957, 3117, 3, { { 0, 3, 2, 16, -1 }, { 0, 3, 1, 8, 2 }, { 1, 11, 1, 8, 2 } } },
+    { 863, 2188, 1914, 2, { { 11, 0, 3, 7, -1 }, { 12, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 13390, 2034, 603, 2, { { 6, 0, 3, 7, -1 }, { 7, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -52483, 2628, 2055, 2, { { 11, 16, 8, 4, -1 }, { 11, 16, 4, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 16542, 1852, 2329, 2, { { 1, 16, 8, 4, -1 }, { 5, 16, 4, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -19400, 1132, 2105, 2, { { 13, 5, 2, 7, -1 }, { 13, 5, 1, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2582, 2106, 1555, 2, { { 5, 5, 2, 7, -1 }, { 6, 5, 1, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 65972, 2073, 2695, 2, { { 18, 6, 2, 14, -1 }, { 18, 13, 2, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -23, 2128, 1647, 2, { { 6, 10, 3, 4, -1 }, { 6, 12, 3, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2221, 2033, 2439, 2, { { 14, 7, 1, 2, -1 }, { 14, 8, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -17443, 1539, 2120, 3, { { 0, 1, 18, 6, -1 }, { 0, 1, 9, 3, 2 }, { 9, 4, 9, 3, 2 } } },
+    { -3030, 2713, 2071, 2, { { 14, 7, 1, 2, -1 }, { 14, 8, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 80513, 1964, 3296, 2, { { 0, 6, 2, 14, -1 }, { 0, 13, 2, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 4107, 2023, 2343, 2, { { 17, 0, 3, 12, -1 }, { 18, 0, 1, 12, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -76201, 221, 2025, 2, { { 0, 6, 18, 3, -1 }, { 0, 7, 18, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 566645, 2101, 468, 2, { { 6, 0, 14, 16, -1 }, { 6, 8, 14, 8, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3094, 1855, 2334, 2, { { 0, 0, 3, 12, -1 }, { 1, 0, 1, 12, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3618, 2195, 1728, 2, { { 13, 0, 3, 7, -1 }, { 14, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -441, 2423, 1900, 2, { { 5, 7, 1, 2, -1 }, { 5, 8, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 3466, 2160, 1795, 2, { { 14, 4, 6, 6, -1 }, { 14, 6, 6, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 501, 1657, 2122, 2, { { 5, 7, 7, 2, -1 }, { 5, 8, 7, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -27188, 3052, 2085, 2, { { 8, 6, 6, 9, -1 }, { 8, 9, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -3117, 1350, 2072, 2, { { 5, 4, 6, 1, -1 }, { 7, 4, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6135, 1989, 2373, 3, { { 13, 0, 6, 4, -1 }, { 16, 0, 3, 2, 2 }, { 13, 2, 3, 2, 2 } } },
+    { -48200, 1766, 2204, 2, { { 1, 2, 18, 12, -1 }, { 1, 6, 18, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 163431, 2128, 690, 2, { { 3, 2, 17, 12, -1 }, { 3, 6, 17, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 15901, 1940, 2759, 2, { { 5, 14, 7, 3, -1 }, { 5, 15, 7, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1112, 2385, 1956, 2, { { 10, 14, 1, 3, -1 }, { 10, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 6971, 2048, 950, 2, { { 3, 14, 3, 3, -1 }, { 3, 15, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -12825, 1946, 2156, 2, { { 14, 4, 6, 6, -1 }, { 14, 6, 6, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5927, 2077, 1459, 2, { { 0, 4, 6, 6, -1 }, { 0, 6, 6, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 1361, 1997, 2302, 2, { { 12, 5, 4, 3, -1 }, { 12, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 11305, 1946, 2778, 2, { { 4, 5, 4, 3, -1 }, { 4, 6, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3005, 2173, 1757, 2, { { 18, 0, 2, 6, -1 }, { 18, 2, 2, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3006, 1851, 2269, 2, { { 8, 1, 4, 9, -1 }, { 10, 1, 2, 9, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -5451, 1699, 2226, 2, { { 6, 6, 8, 2, -1 }, { 6, 6, 4, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 5635, 1932, 2666, 3, { { 6, 5, 4, 2, -1 }, { 6, 5, 2, 1, 2 }, { 8, 6, 2, 1, 2 } } },
+    { -15353, 890, 2114, 2, { { 10, 5, 2, 3, -1 }, { 10, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -16, 2186, 1761, 2, { { 9, 5, 1, 3, -1 }, { 9, 6, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -125, 1886, 2287, 2, { { 9, 10, 2, 2, -1 }, { 9, 11, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 17821, 2026, 303, 2, { { 0, 8, 4, 3, -1 }, { 0, 9, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -36801, 2869, 2039, 2, { { 6, 0, 8, 6, -1 }, { 6, 3, 8, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2539, 1829, 2244, 3, { { 1, 0, 6, 4, -1 }, { 1, 0, 3, 2, 2 }, { 4, 2, 3, 2, 2 } } },
+    { -1010, 1931, 2176, 2, { { 13, 0, 3, 7, -1 }, { 14, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 172, 1774, 2188, 2, { { 9, 16, 2, 2, -1 }, { 9, 17, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -22168, 1083, 2132, 2, { { 11, 4, 6, 10, -1 }, { 11, 9, 6, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 920, 2133, 1701, 2, { { 0, 10, 19, 2, -1 }, { 0, 11, 19, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -29301, 2599, 2056, 2, { { 9, 5, 8, 9, -1 }, { 9, 8, 8, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 7057, 2069, 1434, 2, { { 4, 0, 3, 7, -1 }, { 5, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 24412, 2034, 2854, 3, { { 8, 6, 4, 12, -1 }, { 10, 6, 2, 6, 2 }, { 8, 12, 2, 6, 2 } } },
+    { -12211, 1352, 2068, 2, { { 0, 2, 6, 4, -1 }, { 0, 4, 6, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 16530, 2045, 2999, 2, { { 8, 15, 4, 3, -1 }, { 8, 16, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1427, 1602, 2114, 2, { { 8, 0, 3, 7, -1 }, { 9, 0, 1, 7, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -855, 2306, 2027, 2, { { 9, 5, 3, 4, -1 }, { 10, 5, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -630, 2398, 1864, 2, { { 8, 5, 3, 4, -1 }, { 9, 5, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 521, 1750, 2230, 2, { { 7, 6, 6, 1, -1 }, { 9, 6, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2462, 2107, 1592, 3, { { 7, 14, 4, 4, -1 }, { 7, 14, 2, 2, 2 }, { 9, 16, 2, 2, 2 } } },
+    { -9360, 2476, 2036, 3, { { 13, 14, 4, 6, -1 }, { 15, 14, 2, 3, 2 }, { 13, 17, 2, 3, 2 } } },
+    { -14596, 1058, 2048, 2, { { 7, 8, 1, 8, -1 }, { 7, 12, 1, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1071, 1990, 2278, 3, { { 16, 0, 2, 8, -1 }, { 17, 0, 1, 4, 2 }, { 16, 4, 1, 4, 2 } } },
+    { -2877, 2432, 1903, 3, { { 2, 0, 2, 8, -1 }, { 2, 0, 1, 4, 2 }, { 3, 4, 1, 4, 2 } } },
+    { -16987, 1296, 2127, 2, { { 6, 1, 14, 3, -1 }, { 6, 2, 14, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 4544, 2073, 1417, 2, { { 7, 9, 3, 10, -1 }, { 7, 14, 3, 5, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 613, 1957, 2404, 2, { { 9, 14, 2, 2, -1 }, { 9, 15, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2356, 1760, 2202, 2, { { 7, 7, 6, 8, -1 }, { 7, 11, 6, 4, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 2427, 2228, 1901, 2, { { 9, 7, 3, 6, -1 }, { 9, 10, 3, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 9194, 1936, 2774, 2, { { 7, 13, 3, 3, -1 }, { 7, 14, 3, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -235, 1732, 2223, 2, { { 9, 9, 2, 2, -1 }, { 9, 10, 2, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -7795, 2498, 1918, 2, { { 0, 1, 18, 2, -1 }, { 6, 1, 6, 2, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -2432, 2330, 1812, 2, { { 7, 1, 6, 14, -1 }, { 7, 8, 6, 7, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -2206, 1541, 2125, 2, { { 1, 9, 18, 1, -1 }, { 7, 9, 6, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 483, 1925, 2364, 2, { { 9, 7, 2, 2, -1 }, { 9, 7, 1, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 1106, 1829, 2294, 2, { { 9, 3, 2, 9, -1 }, { 10, 3, 1, 9, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 914, 2232, 1603, 2, { { 18, 14, 2, 3, -1 }, { 18, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 350, 1869, 2312, 2, { { 7, 11, 3, 1, -1 }, { 8, 11, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1557, 2354, 1922, 2, { { 10, 8, 3, 4, -1 }, { 11, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 3172, 2116, 1541, 2, { { 7, 14, 3, 6, -1 }, { 8, 14, 1, 6, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 5272, 2049, 2520, 2, { { 10, 8, 3, 4, -1 }, { 11, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -610, 2210, 1798, 2, { { 7, 8, 3, 4, -1 }, { 8, 8, 1, 4, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 47334, 2125, 845, 2, { { 7, 9, 6, 9, -1 }, { 7, 12, 6, 3, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -1132, 1599, 2104, 2, { { 0, 14, 2, 3, -1 }, { 0, 15, 2, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 168, 2005, 2223, 2, { { 11, 12, 1, 2, -1 }, { 11, 13, 1, 1, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -20300, 2857, 1955, 2, { { 4, 3, 8, 3, -1 }, { 8, 3, 4, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 217323, 2144, 1243, 2, { { 0, 4, 20, 6, -1 }, { 0, 4, 10, 6, 2 }, { 0, 0, 0, 0, 0 } } },
+    { -440, 2220, 1827, 2, { { 9, 14, 1, 3, -1 }, { 9, 15, 1, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { 2368, 1973, 2469, 2, { { 8, 14, 4, 3, -1 }, { 8, 15, 4, 1, 3 }, { 0, 0, 0, 0, 0 } } },
+    { -7111, 1630, 2123, 2, { { 0, 15, 14, 4, -1 }, { 0, 17, 14, 2, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 11696, 2225, 1716, 2, { { 1, 14, 18, 6, -1 }, { 1, 17, 18, 3, 2 }, { 0, 0, 0, 0, 0 } } },
+    { 45259, 1941, 2672, 3, { { 0, 0, 10, 6, -1 }, { 0, 0, 5, 3, 2 }, { 5, 3, 5, 3, 2 } } },
+};
@@ -0,0 +1,278 @@
+#include <math.h>
+#include <sys/param.h>
+#include <stdlib.h>
+#include <string.h>
+#include "face_detect.h"
+
+typedef struct {
+    uint8_t x, y, w, h;
+    int8_t weight;
+} face_rect_t;
+
+typedef struct {
+    int32_t threshold;      // Q(FACE_THRESHOLD_Q), relative to the window's norm factor
+    int32_t left;           // Q(FACE_LEAF_Q), taken when feature < threshold
+    int32_t right;
+    uint8_t nrects;
+    face_rect_t rect[3];
+} face_stump_t;
+
+typedef struct {
+    uint16_t first;
+    uint16_t count;
+    int32_t threshold;      // Q(FACE_LEAF_Q)
+} face_stage_t;
+
+#include "face_cascade_data.h"
+
+#define MAX_CANDIDATES  1024
+#define GROUP_EPS       0.2f
+#define GROUP_SCRATCH_BYTES     (MAX_CANDIDATES * (2 * sizeof(int) + 4 * sizeof(int32_t)))
+// Twice the cap: group_candidates appends the surviving clusters after the hits
+#define CANDIDATE_BYTES         (MAX_CANDIDATES * 2 * sizeof(face_box_t))
+
+typedef struct {
+    face_box_t *items;
+    int count;
+    int cap;
+} candidates_t;
+
+// Area of the variance window: the cascade window minus a one pixel border, as in OpenCV
+#define NORM_AREA ((FACE_CASCADE_WIDTH - 2) * (FACE_CASCADE_HEIGHT - 2))
+
+static inline uint32_t rect_sum(const uint32_t *p, int stride, int x, int y, int w, int h) {
+    const uint32_t *top = p + y * stride + x;
+    const uint32_t *bottom = top + h * stride;
+    return bottom[w] - bottom[0] - top[w] + top[0];
+}
+
+// Bilinear resize with pixel centres aligned, Q8 weights
+static void resize_gray(const uint8_t *src, int sw, int sh, uint8_t *dst, int dw, int dh) {
+    float sx = (float)sw / dw;
+    float sy = (float)sh / dh;
+    for (int y = 0; y < dh; y++) {
+        float fy = (y + 0.5f) * sy - 0.5f;
+        if (fy < 0) fy = 0;
+        int y0 = (int)fy;
+        int y1 = y0 + 1 < sh ? y0 + 1 : sh - 1;
+        int wy = (int)((fy - y0) * 256);
+        const uint8_t *r0 = src + y0 * sw;
+        const uint8_t *r1 = src + y1 * sw;
+        for (int x = 0; x < dw; x++) {
+            float fx = (x + 0.5f) * sx - 0.5f;
+            if (fx < 0) fx = 0;
+            int x0 = (int)fx;
+            int x1 = x0 + 1 < sw ? x0 + 1 : sw - 1;
+            int wx = (int)((fx - x0) * 256);
+            int top = r0[x0] * (256 - wx) + r0[x1] * wx;
+            int bottom = r1[x0] * (256 - wx) + r1[x1] * wx;
+            dst[y * dw + x] = (uint8_t)((top * (256 - wy) + bottom * wy + (1 << 15)) >> 16);
+        }
+    }
+}
+
+// The squared integral wraps past 2^32 on large images; rectangle sums taken from it are
+// still exact because every window's true sum fits in 32 bits.
+static void integrate(const uint8_t *img, int w, int h, uint32_t *sum, uint32_t *sqsum) {
+    int stride = w + 1;
+    memset(sum, 0, stride * sizeof(*sum));
+    memset(sqsum, 0, stride * sizeof(*sqsum));
+    for (int y = 0; y < h; y++) {
+        uint32_t row = 0, sqrow = 0;
+        uint32_t *s = sum + (y + 1) * stride;
+        uint32_t *q = sqsum + (y + 1) * stride;
+        s[0] = q[0] = 0;
+        for (int x = 0; x < w; x++) {
+            uint32_t v = img[y * w + x];
+            row += v;
+            sqrow += v * v;
+            s[x + 1] = s[x + 1 - stride] + row;
+            q[x + 1] = q[x + 1 - stride] + sqrow;
+        }
+    }
+}
+
+static int run_cascade(const uint32_t *sum, const uint32_t *sqsum, int stride, int x, int y) {
+    uint32_t s = rect_sum(sum, stride, x + 1, y + 1, FACE_CASCADE_WIDTH - 2, FACE_CASCADE_HEIGHT - 2);
+    uint32_t sq = rect_sum(sqsum, stride, x + 1, y + 1, FACE_CASCADE_WIDTH - 2, FACE_CASCADE_HEIGHT - 2);
+    int64_t var = (int64_t)NORM_AREA * sq - (int64_t)s * s;
+    int64_t nf = var > 0 ? (int64_t)(sqrtf((float)var) + 0.5f) : 1;
+
+    const uint32_t *origin = sum + y * stride + x;
+    for (int si = 0; si < FACE_CASCADE_STAGES; si++) {
+        const face_stage_t *stage = &face_cascade_stages[si];
+        const face_stump_t *stump = &face_cascade_stumps[stage->first];
+        int32_t total = 0;
+        for (int i = 0; i < stage->count; i++, stump++) {
+            int32_t f = 0;
+            for (int r = 0; r < stump->nrects; r++) {
+                const face_rect_t *rc = &stump->rect[r];
+                f += rc->weight * (int32_t)rect_sum(origin, stride, rc->x, rc->y, rc->w, rc->h);
+            }
+            total += ((int64_t)f << FACE_THRESHOLD_Q) < (int64_t)stump->threshold * nf ? stump->left : stump->right;
+        }
+        if (total < stage->threshold) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void push_candidate(candidates_t *c, int x, int y, int w, int h) {
+    if (c->count == c->cap) {
+        return;
+    }
+    face_box_t *b = &c->items[c->count++];
+    b->x = x;
+    b->y = y;
+    b->w = w;
+    b->h = h;
+    b->neighbors = 1;
+}
+
+static int similar(const face_box_t *a, const face_box_t *b) {
+    float delta = GROUP_EPS * (MIN(a->w, b->w) + MIN(a->h, b->h)) * 0.5f;
+    return abs(a->x - b->x) <= delta && abs(a->y - b->y) <= delta &&
+           abs(a->x + a->w - b->x - b->w) <= delta && abs(a->y + a->h - b->y - b->h) <= delta;
+}
+
+static int find_root(int *parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+static int cmp_area_desc(const void *a, const void *b) {
+    const face_box_t *fa = a, *fb = b;
+    return fb->w * fb->h - fa->w * fa->h;
+}
+
+// Cluster overlapping hits and average each cluster, then drop clusters nested inside a
+// stronger one (OpenCV's groupRectangles). scratch holds GROUP_SCRATCH_BYTES.
+static int group_candidates(candidates_t *c, int min_neighbors, int *scratch, face_box_t *boxes, int max_boxes) {
+    int n = c->count;
+    int *parent = scratch;
+    int *members = parent + n;
+    int32_t *acc = (int32_t *)(members + n);
+
+    for (int i = 0; i < n; i++) {
+        parent[i] = i;
+        members[i] = 0;
+    }
+    memset(acc, 0, n * 4 * sizeof(int32_t));
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            if (similar(&c->items[i], &c->items[j])) {
+                int ri = find_root(parent, i), rj = find_root(parent, j);
+                if (ri != rj) {
+                    parent[rj] = ri;
+                }
+            }
+        }
+    }
+
+    // Reuse the candidate array for the averaged clusters, indexed by root
+    for (int i = 0; i < n; i++) {
+        int r = find_root(parent, i);
+        members[r]++;
+        acc[r * 4 + 0] += c->items[i].x;
+        acc[r * 4 + 1] += c->items[i].y;
+        acc[r * 4 + 2] += c->items[i].w;
+        acc[r * 4 + 3] += c->items[i].h;
+    }
+    int clusters = 0;
+    for (int r = 0; r < n; r++) {
+        if (members[r] <= min_neighbors) {
+            continue;
+        }
+        face_box_t *b = &c->items[clusters++];
+        int m = members[r];
+        b->x = (acc[r * 4 + 0] + m / 2) / m;
+        b->y = (acc[r * 4 + 1] + m / 2) / m;
+        b->w = (acc[r * 4 + 2] + m / 2) / m;
+        b->h = (acc[r * 4 + 3] + m / 2) / m;
+        b->neighbors = m;
+    }
+
+    int found = 0;
+    for (int i = 0; i < clusters; i++) {
+        const face_box_t *r1 = &c->items[i];
+        int nested = 0;
+        for (int j = 0; j < clusters && !nested; j++) {
+            const face_box_t *r2 = &c->items[j];
+            int dx = (int)(r2->w * GROUP_EPS + 0.5f);
+            int dy = (int)(r2->h * GROUP_EPS + 0.5f);
+            nested = i != j &&
+                     r1->x >= r2->x - dx && r1->y >= r2->y - dy &&
+                     r1->x + r1->w <= r2->x + r2->w + dx && r1->y + r1->h <= r2->y + r2->h + dy &&
+                     (r2->neighbors > MAX(3, r1->neighbors) || r1->neighbors < 3);
+        }
+        if (!nested) {
+            c->items[clusters + found++] = *r1;
+        }
+    }
+    qsort(&c->items[clusters], found, sizeof(face_box_t), cmp_area_desc);
+    if (found > max_boxes) {
+        found = max_boxes;
+    }
+    memcpy(boxes, &c->items[clusters], found * sizeof(face_box_t));
+    return found;
+}
+
+// Workspace layout: integral and squared integral images, group_candidates' scratch, the
+// candidate list, then one pyramid level. Every part stays 4-byte aligned.
+size_t face_detect_workspace_size(int width, int height) {
+    return (size_t)(width + 1) * (height + 1) * 2 * sizeof(uint32_t) + GROUP_SCRATCH_BYTES +
+           CANDIDATE_BYTES + (size_t)width * height;
+}
+
+int face_detect(const uint8_t *gray, int width, int height, int min_size, int min_neighbors,
+                void *workspace, face_box_t *boxes, int max_boxes) {
+    if (width < FACE_CASCADE_WIDTH || height < FACE_CASCADE_HEIGHT) {
+        return 0;
+    }
+
+    size_t ints = (size_t)(width + 1) * (height + 1);
+    uint32_t *sum = workspace;
+    uint32_t *sqsum = sum + ints;
+    int *scratch = (int *)(sqsum + ints);
+    candidates_t cand = {
+        .items = (face_box_t *)((uint8_t *)scratch + GROUP_SCRATCH_BYTES),
+        .count = 0,
+        .cap = MAX_CANDIDATES,
+    };
+    uint8_t *level = (uint8_t *)cand.items + CANDIDATE_BYTES;
+
+    float factor = 1.0f;
+    while (FACE_CASCADE_WIDTH * factor < min_size) {
+        factor *= FACE_DETECT_SCALE_STEP;
+    }
+    for (; ; factor *= FACE_DETECT_SCALE_STEP) {
+        int lw = (int)(width / factor + 0.5f);
+        int lh = (int)(height / factor + 0.5f);
+        if (lw < FACE_CASCADE_WIDTH || lh < FACE_CASCADE_HEIGHT) {
+            break;
+        }
+        const uint8_t *img = gray;
+        if (lw != width || lh != height) {
+            resize_gray(gray, width, height, level, lw, lh);
+            img = level;
+        }
+        integrate(img, lw, lh, sum, sqsum);
+
+        // Two pixel stride on the finest levels, as OpenCV does; windows there overlap heavily
+        int step = factor > 2.0f ? 1 : 2;
+        int win_w = (int)(FACE_CASCADE_WIDTH * factor + 0.5f);
+        int win_h = (int)(FACE_CASCADE_HEIGHT * factor + 0.5f);
+        for (int y = 0; y + FACE_CASCADE_HEIGHT <= lh; y += step) {
+            for (int x = 0; x + FACE_CASCADE_WIDTH <= lw; x += step) {
+                if (run_cascade(sum, sqsum, lw + 1, x, y)) {
+                    push_candidate(&cand, (int)(x * factor + 0.5f), (int)(y * factor + 0.5f), win_w, win_h);
+                }
+            }
+        }
+    }
+    return group_candidates(&cand, min_neighbors, scratch, boxes, max_boxes);
+}
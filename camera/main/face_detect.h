@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Frontal face detector: OpenCV's haarcascade_frontalface_alt evaluated with integer
+// integral images and fixed-point stumps (tables generated by camera/tools/haar_to_c.py).
+// Meant for reduced grayscale frames (e.g. VGA decoded at 1/2 scale). Portable C with no
+// ESP-IDF dependencies so it also builds on the host.
+
+#define FACE_DETECT_SCALE_STEP  1.25f   // Pyramid factor between scanned window sizes
+#define FACE_DETECT_MIN_NEIGHBORS 3     // Raw hits a face needs to be reported
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    uint16_t neighbors;     // Raw window hits merged into this box
+} face_box_t;
+
+// Bytes of working memory face_detect needs for a width x height image, about 8 per pixel.
+// The caller allocates it, so it can come from PSRAM on the camera.
+size_t face_detect_workspace_size(int width, int height);
+
+// Find faces at least min_size pixels wide in gray (row-major, width*height bytes), using
+// workspace (face_detect_workspace_size bytes, 4-byte aligned). Writes up to max_boxes
+// boxes in image coordinates, largest first, and returns how many were written.
+int face_detect(const uint8_t *gray, int width, int height, int min_size, int min_neighbors,
+                void *workspace, face_box_t *boxes, int max_boxes);
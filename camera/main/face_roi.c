@@ -0,0 +1,215 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_jpg_decode.h"
+#include "img_converters.h"
+#include "face_roi.h"
+
+#define CHIP_BYTES  (FACE_CHIP_SIZE * FACE_CHIP_SIZE * 3)
+
+static const char *TAG = "ESP32S_Camera";
+
+typedef struct {
+    const uint8_t *jpg;
+    size_t len;
+} jpg_source_t;
+
+typedef struct {
+    jpg_source_t src;
+    uint8_t *gray;
+    size_t cap;
+    uint16_t width;
+    uint16_t height;
+} gray_decode_t;
+
+typedef struct {
+    jpg_source_t src;
+    face_chip_t *chips;
+    uint8_t *pixels[FACE_CHIP_MAX];     // BGR, FACE_CHIP_SIZE square
+    int count;
+} crop_decode_t;
+
+static size_t read_jpg(void *arg, size_t index, uint8_t *buf, size_t len) {
+    jpg_source_t *src = arg;
+    if (index >= src->len) {
+        return 0;
+    }
+    len = MIN(len, src->len - index);
+    if (buf) {
+        memcpy(buf, src->jpg + index, len);
+    }
+    return len;
+}
+
+// Decoder output is RGB888 tiles; keep the luma only
+static bool write_gray(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data) {
+    gray_decode_t *g = arg;
+    if (!data) {
+        if (x == 0 && y == 0) {
+            if ((size_t)w * h > g->cap) {
+                return false;
+            }
+            g->width = w;
+            g->height = h;
+        }
+        return true;
+    }
+    for (int row = 0; row < h; row++) {
+        uint8_t *dst = g->gray + (size_t)(y + row) * g->width + x;
+        for (int col = 0; col < w; col++, data += 3) {
+            dst[col] = (uint8_t)((77 * data[0] + 150 * data[1] + 29 * data[2]) >> 8);
+        }
+    }
+    return true;
+}
+
+// Nearest-neighbour resample of every chip that overlaps this tile
+static bool write_crops(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data) {
+    crop_decode_t *c = arg;
+    if (!data) {
+        return true;
+    }
+    for (int i = 0; i < c->count; i++) {
+        const face_box_t *b = &c->chips[i].box;
+        if (b->x >= x + w || b->x + b->w <= x || b->y >= y + h || b->y + b->h <= y) {
+            continue;
+        }
+        for (int v = 0; v < FACE_CHIP_SIZE; v++) {
+            int sy = b->y + v * b->h / FACE_CHIP_SIZE;
+            if (sy < y) {
+                continue;
+            }
+            if (sy >= y + h) {
+                break;
+            }
+            uint8_t *dst = c->pixels[i] + v * FACE_CHIP_SIZE * 3;
+            const uint8_t *src_row = data + (size_t)(sy - y) * w * 3;
+            for (int u = 0; u < FACE_CHIP_SIZE; u++) {
+                int sx = b->x + u * b->w / FACE_CHIP_SIZE;
+                if (sx < x) {
+                    continue;
+                }
+                if (sx >= x + w) {
+                    break;
+                }
+                const uint8_t *px = src_row + (sx - x) * 3;
+                dst[u * 3 + 0] = px[2];     // fmt2jpg reads RGB888 as B, G, R
+                dst[u * 3 + 1] = px[1];
+                dst[u * 3 + 2] = px[0];
+            }
+        }
+    }
+    return true;
+}
+
+// Grow a detection into a square crop with margin, kept inside the frame
+static face_box_t chip_area(const face_box_t *face, int frame_w, int frame_h) {
+    int side = MAX(face->w, face->h) * (100 + 2 * FACE_CHIP_MARGIN_PCT) / 100;
+    side = MIN(side, MIN(frame_w, frame_h));
+    int cx = face->x + face->w / 2;
+    int cy = face->y + face->h / 2;
+    face_box_t area = {
+        .x = MIN(MAX(cx - side / 2, 0), frame_w - side),
+        .y = MIN(MAX(cy - side / 2, 0), frame_h - side),
+        .w = side,
+        .h = side,
+        .neighbors = face->neighbors,
+    };
+    return area;
+}
+
+int face_roi_detect(const uint8_t *jpg, size_t len, uint16_t width, uint16_t height,
+                    face_box_t *faces, int max_faces) {
+    jpg_scale_t scale = JPG_SCALE_NONE;
+    while (scale < JPG_SCALE_MAX && (width >> scale) > FACE_DETECT_WIDTH) {
+        scale++;
+    }
+
+    // The gray image and the detector's workspace in one block, PSRAM first. Short of memory,
+    // detect on a smaller decode instead, losing the smallest faces, before giving up.
+    gray_decode_t g = { .src = { jpg, len } };
+    void *workspace = NULL;
+    for (; scale <= JPG_SCALE_MAX; scale++) {
+        int factor = 1 << scale;
+        int w = width / factor + 1, h = height / factor + 1;
+        g.cap = ((size_t)w * h + 3) & ~(size_t)3;
+        g.gray = heap_caps_malloc_prefer(g.cap + face_detect_workspace_size(w, h), 2,
+                                         MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT);
+        if (g.gray) {
+            workspace = g.gray + g.cap;
+            break;
+        }
+        ESP_LOGW(TAG, "No memory for face detection at 1/%d scale", factor);
+    }
+    if (!g.gray) {
+        return FACE_ROI_ERR_NOMEM;
+    }
+    int factor = 1 << scale;
+    if (esp_jpg_decode(len, scale, read_jpg, write_gray, &g) != ESP_OK) {
+        ESP_LOGW(TAG, "Face decode failed");
+        heap_caps_free(g.gray);
+        return FACE_ROI_ERR_DECODE;
+    }
+
+    int found = face_detect(g.gray, g.width, g.height, FACE_MIN_SIZE / factor, FACE_DETECT_MIN_NEIGHBORS,
+                            workspace, faces, max_faces);
+    heap_caps_free(g.gray);
+    for (int i = 0; i < found; i++) {
+        faces[i].x *= factor;
+        faces[i].y *= factor;
+        faces[i].w *= factor;
+        faces[i].h *= factor;
+    }
+    return found;
+}
+
+int face_roi_extract(const uint8_t *jpg, size_t len, uint16_t width, uint16_t height,
+                     face_chip_t *chips, int max_chips) {
+    face_box_t faces[FACE_CHIP_MAX];
+    int found = face_roi_detect(jpg, len, width, height, faces, MIN(max_chips, FACE_CHIP_MAX));
+    if (found <= 0) {
+        return found;
+    }
+
+    crop_decode_t c = { .src = { jpg, len }, .chips = chips, .count = found };
+    int res = found;
+    for (int i = 0; i < found; i++) {
+        chips[i].box = chip_area(&faces[i], width, height);
+        chips[i].jpg = NULL;
+        chips[i].len = 0;
+        c.pixels[i] = heap_caps_malloc_prefer(CHIP_BYTES, 2, MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT);
+        if (!c.pixels[i]) {
+            res = FACE_ROI_ERR_NOMEM;
+        }
+    }
+
+    // One full-resolution decode serves every chip
+    if (res > 0 && esp_jpg_decode(len, JPG_SCALE_NONE, read_jpg, write_crops, &c) != ESP_OK) {
+        ESP_LOGW(TAG, "Face crop decode failed");
+        res = FACE_ROI_ERR_DECODE;
+    }
+    for (int i = 0; i < found && res > 0; i++) {
+        if (!fmt2jpg(c.pixels[i], CHIP_BYTES, FACE_CHIP_SIZE, FACE_CHIP_SIZE, PIXFORMAT_RGB888,
+                     FACE_CHIP_QUALITY, &chips[i].jpg, &chips[i].len)) {
+            res = FACE_ROI_ERR_NOMEM;
+        }
+    }
+    for (int i = 0; i < found; i++) {
+        heap_caps_free(c.pixels[i]);
+    }
+    if (res < 0) {
+        face_roi_free(chips, found);
+    }
+    return res;
+}
+
+void face_roi_free(face_chip_t *chips, int count) {
+    for (int i = 0; i < count; i++) {
+        free(chips[i].jpg);
+        chips[i].jpg = NULL;
+        chips[i].len = 0;
+    }
+}
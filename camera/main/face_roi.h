@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "face_detect.h"
+
+// Face chips for /faces: detect on a reduced scale grayscale decode of the frame, then cut
+// a square around each face from one full-resolution decode, resample it to
+// FACE_CHIP_SIZE (the backend's IMG_SIZE) and JPEG encode it.
+
+#define FACE_DETECT_WIDTH       320     // Largest detection image; the decode scale is picked to fit
+#define FACE_MIN_SIZE           64      // Smallest face reported, in frame pixels
+#define FACE_CHIP_SIZE          160
+#define FACE_CHIP_MAX           4
+#define FACE_CHIP_MARGIN_PCT    15      // Added on each side of the detected box
+#define FACE_CHIP_QUALITY       85      // fmt2jpg quality, 1-100
+
+#define FACE_ROI_ERR_DECODE     -1      // The frame could not be decoded
+#define FACE_ROI_ERR_NOMEM      -2      // Not enough memory even at the smallest decode scale
+
+typedef struct {
+    face_box_t box;         // Crop area in frame pixels
+    uint8_t *jpg;           // FACE_CHIP_SIZE square JPEG, owned by the chip
+    size_t len;
+} face_chip_t;
+
+// Detect faces in a width x height JPEG frame; boxes are in frame pixels, largest first.
+// Returns the number found or a negative FACE_ROI_ERR_* code. Short of memory it detects
+// on a smaller decode of the frame, missing the smallest faces, rather than failing.
+int face_roi_detect(const uint8_t *jpg, size_t len, uint16_t width, uint16_t height,
+                    face_box_t *faces, int max_faces);
+
+// Fill up to max_chips chips from a width x height JPEG frame. Returns the number of
+// chips (0 when no face is found) or a negative FACE_ROI_ERR_* code. Release the chips
+// with face_roi_free.
+int face_roi_extract(const uint8_t *jpg, size_t len, uint16_t width, uint16_t height,
+                     face_chip_t *chips, int max_chips);
+
+void face_roi_free(face_chip_t *chips, int count);
@@ -0,0 +1,160 @@
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "lwip/sockets.h"
+#include "frame_ring.h"
+#include "metrics.h"
+#include "net_util.h"
+#include "frame_link.h"
+
+#define LINK_TASK_STACK     3072
+#define LISTEN_TASK_STACK   3072
+#define LINK_IDLE_TIMEOUT_S 60      // Close a link that sends no credit for this long
+
+static const char *TAG = "ESP32S_Camera";
+
+static SemaphoreHandle_t link_slots;
+
+static void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    put_u16(p, v);
+    put_u16(p + 2, v >> 16);
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void build_header(uint8_t *h, const frame_slot_t *slot, uint32_t skipped) {
+    put_u32(h, FRAME_LINK_FRAME_MAGIC);
+    put_u32(h + 4, slot->seq);
+    put_u32(h + 8, (uint32_t)slot->timestamp_us);
+    put_u32(h + 12, (uint32_t)((uint64_t)slot->timestamp_us >> 32));
+    put_u32(h + 16, slot->len);
+    put_u16(h + 20, slot->width);
+    put_u16(h + 22, slot->height);
+    h[24] = FRAME_LINK_FORMAT_JPEG;
+    h[25] = slot->changed ? FRAME_LINK_FLAG_CHANGED : 0;
+    put_u16(h + 26, slot->change_score);
+    put_u32(h + 28, skipped);
+}
+
+// One task per connection: wait for credit, send the newest frame, repeat
+static void link_client_task(void *arg) {
+    int fd = (int)(intptr_t)arg;
+    uint32_t credits = 0;
+    uint32_t last_seq = 0;
+    uint8_t msg[FRAME_LINK_CREDIT_LEN];
+    size_t msg_len = 0;
+    uint8_t header[FRAME_LINK_HEADER_LEN];
+
+    int nodelay = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+    struct timeval idle = { .tv_sec = LINK_IDLE_TIMEOUT_S };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &idle, sizeof(idle));
+
+    while (true) {
+        // Without credit, block for it; with credit, only collect what has already arrived
+        ssize_t n = recv(fd, msg + msg_len, sizeof(msg) - msg_len, credits ? MSG_DONTWAIT : 0);
+        if (n > 0) {
+            msg_len += n;
+            if (msg_len < sizeof(msg)) {
+                continue;
+            }
+            msg_len = 0;
+            if (get_u32(msg) != FRAME_LINK_CREDIT_MAGIC) {
+                ESP_LOGW(TAG, "Frame link: bad client message");
+                break;
+            }
+            uint32_t add = get_u32(msg + 4);
+            credits = add > FRAME_LINK_MAX_CREDITS - credits ? FRAME_LINK_MAX_CREDITS : credits + add;
+            continue;
+        }
+        if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK) || !credits) {
+            break;      // Closed, failed, or idle past the receive timeout
+        }
+
+        frame_slot_t *slot = frame_ring_acquire(last_seq, pdMS_TO_TICKS(1000));
+        if (!slot) {
+            continue;
+        }
+        build_header(header, slot, last_seq ? slot->seq - last_seq - 1 : 0);
+        struct iovec iov[2] = {
+            { .iov_base = header, .iov_len = sizeof(header) },
+            { .iov_base = slot->buf, .iov_len = slot->len },
+        };
+        last_seq = slot->seq;
+        esp_err_t res = send_iov(fd, iov, 2);
+        frame_ring_release(slot);
+        if (res != ESP_OK) {
+            break;
+        }
+        credits--;
+        metric_inc(&camera_metrics.link_frames_sent);
+    }
+
+    ESP_LOGI(TAG, "Frame link client disconnected");
+    metric_inc(&camera_metrics.link_disconnects);
+    close(fd);
+    xSemaphoreGive(link_slots);
+    vTaskDelete(NULL);
+}
+
+static void link_listen_task(void *arg) {
+    uint16_t port = (uint16_t)(uintptr_t)arg;
+    int listen_fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    int one = 1;
+    setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(port),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    if (listen_fd < 0 || bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+        listen(listen_fd, 2) != 0) {
+        ESP_LOGE(TAG, "Frame link: cannot listen on port %u (errno %d)", port, errno);
+        if (listen_fd >= 0) {
+            close(listen_fd);
+        }
+        vTaskDelete(NULL);
+        return;
+    }
+    ESP_LOGI(TAG, "Frame link listening on port %u", port);
+
+    while (true) {
+        int fd = accept(listen_fd, NULL, NULL);
+        if (fd < 0) {
+            vTaskDelay(pdMS_TO_TICKS(100));
+            continue;
+        }
+        if (xSemaphoreTake(link_slots, 0) != pdTRUE) {
+            ESP_LOGW(TAG, "Rejecting frame link client, %d already connected", FRAME_LINK_MAX_CLIENTS);
+            metric_inc(&camera_metrics.link_rejected);
+            close(fd);
+            continue;
+        }
+        if (xTaskCreatePinnedToCore(link_client_task, "frame_link", LINK_TASK_STACK,
+                                    (void *)(intptr_t)fd, 5, NULL, 1) != pdPASS) {
+            ESP_LOGE(TAG, "Failed to create frame link task");
+            close(fd);
+            xSemaphoreGive(link_slots);
+            continue;
+        }
+        metric_inc(&camera_metrics.link_connections);
+    }
+}
+
+void start_frame_link(uint16_t port) {
+    link_slots = xSemaphoreCreateCounting(FRAME_LINK_MAX_CLIENTS, FRAME_LINK_MAX_CLIENTS);
+    xTaskCreatePinnedToCore(link_listen_task, "frame_link_listen", LISTEN_TASK_STACK,
+                            (void *)(uintptr_t)port, 4, NULL, 1);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+
+// Frame link: a raw TCP stream of length-prefixed frames for machine consumers, with
+// credit-based flow control. The camera sends one frame per credit and always the newest
+// one, so a slow consumer gets fewer, fresher frames instead of a backlog.
+//
+// Camera -> client, per frame: FRAME_LINK_HEADER_LEN bytes, little-endian, then the JPEG
+//    0  u32  magic FRAME_LINK_FRAME_MAGIC ("FLK1")
+//    4  u32  frame sequence number (same as /capture's X-Frame-Seq)
+//    8  u64  capture timestamp, microseconds since boot
+//   16  u32  JPEG length in bytes
+//   20  u16  width
+//   22  u16  height
+//   24  u8   format, FRAME_LINK_FORMAT_JPEG
+//   25  u8   flags, FRAME_LINK_FLAG_CHANGED when the change detector flagged the frame
+//   26  u16  change score, per mille
+//   28  u32  ring frames skipped since the previous frame sent to this client
+//
+// Client -> camera: FRAME_LINK_CREDIT_LEN bytes
+//    0  u32  magic FRAME_LINK_CREDIT_MAGIC ("FLC1")
+//    4  u32  credits to add; the outstanding total is capped at FRAME_LINK_MAX_CREDITS
+//
+// Nothing is sent until the first credit arrives. Any other client message closes the link.
+
+#define FRAME_LINK_PORT         81
+#define FRAME_LINK_HEADER_LEN   32
+#define FRAME_LINK_CREDIT_LEN   8
+#define FRAME_LINK_FRAME_MAGIC  0x314B4C46u
+#define FRAME_LINK_CREDIT_MAGIC 0x31434C46u
+#define FRAME_LINK_FORMAT_JPEG  0
+#define FRAME_LINK_FLAG_CHANGED 0x01
+#define FRAME_LINK_MAX_CREDITS  4
+#define FRAME_LINK_MAX_CLIENTS  2
+#define FRAME_LINK_SOCKETS      (FRAME_LINK_MAX_CLIENTS + 1)    // Clients plus the listening socket
+
+// Listen for frame link clients on port (FRAME_LINK_PORT on the device)
+void start_frame_link(uint16_t port);
@@ -0,0 +1,431 @@
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "lwip/sockets.h"
+#include "lwip/netdb.h"
+#include "frame_ring.h"
+#include "metrics.h"
+#include "net_util.h"
+#include "frame_push.h"
+
+#define PUSH_TASK_STACK     4096
+#define PUSH_IO_TIMEOUT_S   10      // A send or response that stalls this long drops the connection
+#define PUSH_BACKOFF_MIN_MS 500
+#define PUSH_BACKOFF_MAX_MS 30000
+#define PUSH_RETRY_AFTER_MAX_S 30
+#define PUSH_KEEPALIVE_US   5000000 // changed_only still pushes a frame this often
+#define PUSH_PART_HEAD_LEN  192
+#define PUSH_RESPONSE_HEAD  512
+
+static const char *TAG = "ESP32S_Camera";
+
+typedef enum {
+    PUSH_FREE,
+    PUSH_FILLING,       // Collector is copying a frame in
+    PUSH_PENDING,
+    PUSH_SENDING,       // In the sender's current request; only the sender touches it
+} push_state_t;
+
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    size_t cap;
+    uint32_t seq;
+    int64_t timestamp_us;
+    uint16_t change_score;
+    frame_quality_t quality;
+    push_state_t state;
+} push_slot_t;
+
+static frame_push_config_t config;
+static char host[64];
+static char port_str[6];
+static char path[96];
+static push_slot_t push_slots[FRAME_PUSH_MAX_BATCH + 1];
+static int slot_count;
+static SemaphoreHandle_t slots_lock;
+static SemaphoreHandle_t pending_signal;
+
+// http://host[:port]/path into host, port_str and path
+static bool parse_url(const char *url) {
+    if (strncmp(url, "http://", 7) != 0) {
+        return false;
+    }
+    const char *h = url + 7;
+    const char *slash = strchr(h, '/');
+    const char *colon = strchr(h, ':');
+    size_t host_len = colon && (!slash || colon < slash) ? (size_t)(colon - h) : slash ? (size_t)(slash - h) : strlen(h);
+    if (host_len == 0 || host_len >= sizeof(host)) {
+        return false;
+    }
+    memcpy(host, h, host_len);
+    host[host_len] = '\0';
+    int port = 80;
+    if (colon && (!slash || colon < slash)) {
+        port = atoi(colon + 1);
+    }
+    if (port <= 0 || port > 65535) {
+        return false;
+    }
+    snprintf(port_str, sizeof(port_str), "%d", port);
+    snprintf(path, sizeof(path), "%s", slash ? slash : "/");
+    return true;
+}
+
+// Collector --------------------------------------------------------------
+
+// Free slot for a new frame, else the oldest pending one, whose frame is dropped
+static push_slot_t *claim_slot() {
+    push_slot_t *free_slot = NULL, *oldest = NULL;
+    xSemaphoreTake(slots_lock, portMAX_DELAY);
+    for (int i = 0; i < slot_count; i++) {
+        push_slot_t *s = &push_slots[i];
+        if (s->state == PUSH_FREE && !free_slot) {
+            free_slot = s;
+        } else if (s->state == PUSH_PENDING && (!oldest || s->seq < oldest->seq)) {
+            oldest = s;
+        }
+    }
+    push_slot_t *slot = free_slot ? free_slot : oldest;
+    if (slot) {
+        if (slot == oldest) {
+            metric_inc(&camera_metrics.push_frames_dropped);
+        }
+        slot->state = PUSH_FILLING;
+    }
+    xSemaphoreGive(slots_lock);
+    return slot;
+}
+
+static void push_collect_task(void *arg) {
+    uint32_t last_seq = 0;
+    int64_t last_taken_us = 0;
+    const int64_t interval_us = config.max_fps ? 1000000 / config.max_fps : 0;
+
+    while (true) {
+        frame_slot_t *frame = frame_ring_acquire(last_seq, pdMS_TO_TICKS(1000));
+        if (!frame) {
+            continue;
+        }
+        last_seq = frame->seq;
+        int64_t now = esp_timer_get_time();
+        if ((interval_us && now - last_taken_us < interval_us) ||
+            (config.changed_only && !frame->changed && now - last_taken_us < PUSH_KEEPALIVE_US)) {
+            frame_ring_release(frame);
+            continue;
+        }
+
+        push_slot_t *slot = claim_slot();
+        if (!slot) {
+            // Every slot is in the request being sent; the next frame will be newer anyway
+            metric_inc(&camera_metrics.push_frames_dropped);
+            frame_ring_release(frame);
+            continue;
+        }
+        if (slot->cap < frame->len) {
+            size_t cap = frame->len + frame->len / 4;
+            heap_caps_free(slot->buf);
+            slot->buf = heap_caps_malloc_prefer(cap, 2, MALLOC_CAP_SPIRAM, MALLOC_CAP_8BIT);
+            slot->cap = slot->buf ? cap : 0;
+        }
+        bool copied = slot->buf != NULL;
+        if (copied) {
+            memcpy(slot->buf, frame->buf, frame->len);
+            slot->len = frame->len;
+            slot->seq = frame->seq;
+            slot->timestamp_us = frame->timestamp_us;
+            slot->change_score = frame->change_score;
+            slot->quality = frame->quality;
+        } else {
+            metric_inc(&camera_metrics.dropped_no_memory);
+        }
+        frame_ring_release(frame);
+
+        xSemaphoreTake(slots_lock, portMAX_DELAY);
+        slot->state = copied ? PUSH_PENDING : PUSH_FREE;
+        xSemaphoreGive(slots_lock);
+        if (copied) {
+            last_taken_us = now;
+            xSemaphoreGive(pending_signal);
+        }
+    }
+}
+
+// Sender -----------------------------------------------------------------
+
+static int push_connect() {
+    struct addrinfo hints = { .ai_family = AF_INET, .ai_socktype = SOCK_STREAM };
+    struct addrinfo *res = NULL;
+    if (getaddrinfo(host, port_str, &hints, &res) != 0 || !res) {
+        ESP_LOGW(TAG, "Push: cannot resolve %s", host);
+        return -1;
+    }
+    int fd = socket(res->ai_family, res->ai_socktype, 0);
+    if (fd >= 0 && connect(fd, res->ai_addr, res->ai_addrlen) != 0) {
+        ESP_LOGW(TAG, "Push: cannot connect to %s:%s (errno %d)", host, port_str, errno);
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+    if (fd < 0) {
+        return -1;
+    }
+    int nodelay = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+    struct timeval timeout = { .tv_sec = PUSH_IO_TIMEOUT_S };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    metric_inc(&camera_metrics.push_connections);
+    return fd;
+}
+
+// Pending slots in sequence order, as many as fit the batch limits; marks them sending
+static int take_batch(push_slot_t **batch) {
+    int count = 0;
+    size_t bytes = 0;
+    xSemaphoreTake(slots_lock, portMAX_DELAY);
+    while (count < config.batch_max) {
+        push_slot_t *next = NULL;
+        for (int i = 0; i < slot_count; i++) {
+            push_slot_t *s = &push_slots[i];
+            if (s->state == PUSH_PENDING && (!next || s->seq < next->seq)) {
+                next = s;
+            }
+        }
+        if (!next || (count && bytes + next->len > config.batch_bytes)) {
+            break;
+        }
+        next->state = PUSH_SENDING;
+        bytes += next->len;
+        batch[count++] = next;
+    }
+    xSemaphoreGive(slots_lock);
+    return count;
+}
+
+static void finish_batch(push_slot_t **batch, int count, push_state_t state) {
+    xSemaphoreTake(slots_lock, portMAX_DELAY);
+    for (int i = 0; i < count; i++) {
+        batch[i]->state = state;
+    }
+    xSemaphoreGive(slots_lock);
+    if (state == PUSH_PENDING) {
+        xSemaphoreGive(pending_signal);
+    }
+}
+
+// Write one request for the batch with a single gathered send
+static esp_err_t send_batch(int fd, push_slot_t **batch, int count) {
+    static const char CRLF[] = "\r\n";
+    static const char CLOSING[] = "--" FRAME_PUSH_BOUNDARY "--\r\n";
+    char head[320];
+    char part_heads[FRAME_PUSH_MAX_BATCH][PUSH_PART_HEAD_LEN];
+    struct iovec iov[2 + 3 * FRAME_PUSH_MAX_BATCH];
+    size_t body_len = sizeof(CLOSING) - 1;
+    int n = 1;
+
+    for (int i = 0; i < count; i++) {
+        push_slot_t *s = batch[i];
+        int len = snprintf(part_heads[i], PUSH_PART_HEAD_LEN,
+                           "--" FRAME_PUSH_BOUNDARY "\r\n"
+                           "Content-Type: image/jpeg\r\n"
+                           "Content-Length: %u\r\n"
+                           "X-Frame-Seq: %u\r\n"
+                           "X-Timestamp: %lld\r\n"
+                           "X-Change-Score: %u\r\n"
+                           "X-Sharpness: %u\r\n"
+                           "X-Exposure: %u\r\n"
+                           "\r\n",
+                           (unsigned)s->len, (unsigned)s->seq, (long long)(s->timestamp_us / 1000),
+                           (unsigned)s->change_score, (unsigned)s->quality.sharpness,
+                           (unsigned)s->quality.exposure);
+        iov[n++] = (struct iovec){ .iov_base = part_heads[i], .iov_len = len };
+        iov[n++] = (struct iovec){ .iov_base = s->buf, .iov_len = s->len };
+        iov[n++] = (struct iovec){ .iov_base = (void *)CRLF, .iov_len = sizeof(CRLF) - 1 };
+        body_len += len + s->len + sizeof(CRLF) - 1;
+    }
+    iov[n++] = (struct iovec){ .iov_base = (void *)CLOSING, .iov_len = sizeof(CLOSING) - 1 };
+
+    iov[0].iov_base = head;
+    iov[0].iov_len = snprintf(head, sizeof(head),
+                              "POST %s HTTP/1.1\r\n"
+                              "Host: %s:%s\r\n"
+                              "Content-Type: multipart/mixed; boundary=" FRAME_PUSH_BOUNDARY "\r\n"
+                              "Content-Length: %u\r\n"
+                              "X-Camera: %s\r\n"
+                              "Connection: keep-alive\r\n"
+                              "\r\n",
+                              path, host, port_str, (unsigned)body_len, config.camera);
+    return send_iov(fd, iov, n);
+}
+
+typedef struct {
+    int status;
+    bool close;             // Connection: close, or a body without a Content-Length to skip by
+    int retry_after_s;
+} push_response_t;
+
+// Read the status line and headers, then discard a body of known length
+static esp_err_t read_response(int fd, push_response_t *out) {
+    char buf[PUSH_RESPONSE_HEAD + 1];
+    size_t len = 0;
+    char *end = NULL;
+    while (!end) {
+        if (len == PUSH_RESPONSE_HEAD) {
+            return ESP_FAIL;
+        }
+        ssize_t n = recv(fd, buf + len, PUSH_RESPONSE_HEAD - len, 0);
+        if (n <= 0) {
+            return ESP_FAIL;
+        }
+        len += n;
+        buf[len] = '\0';
+        end = strstr(buf, "\r\n\r\n");
+    }
+    *end = '\0';
+    size_t body_have = len - (end + 4 - buf);
+
+    out->status = strncmp(buf, "HTTP/1.", 7) == 0 ? atoi(buf + 9) : 0;
+    out->close = strncmp(buf, "HTTP/1.0", 8) == 0;
+    out->retry_after_s = 0;
+    long content_length = -1;
+    bool chunked = false;
+    for (char *line = strstr(buf, "\r\n"); line; line = strstr(line, "\r\n")) {
+        line += 2;
+        if (strncasecmp(line, "Content-Length:", 15) == 0) {
+            content_length = strtol(line + 15, NULL, 10);
+        } else if (strncasecmp(line, "Transfer-Encoding:", 18) == 0) {
+            chunked = true;         // Overrides any Content-Length
+        } else if (strncasecmp(line, "Retry-After:", 12) == 0) {
+            out->retry_after_s = atoi(line + 12);
+        } else if (strncasecmp(line, "Connection:", 11) == 0) {
+            const char *v = line + 11;
+            while (*v == ' ') {
+                v++;
+            }
+            out->close = strncasecmp(v, "close", 5) == 0;
+        }
+    }
+
+    bool bodyless = out->status == 204 || out->status == 304;
+    if (!bodyless && (chunked || content_length < 0 || (long)body_have > content_length)) {
+        // A chunked body, one that runs to the close, or bytes past the body: the next
+        // response cannot be found on this connection, so read no further and reopen it
+        out->close = true;
+        return out->status ? ESP_OK : ESP_FAIL;
+    }
+    long left = bodyless ? 0 : content_length - (long)body_have;
+    while (left > 0) {
+        ssize_t n = recv(fd, buf, left < PUSH_RESPONSE_HEAD ? left : PUSH_RESPONSE_HEAD, 0);
+        if (n <= 0) {
+            return ESP_FAIL;
+        }
+        left -= n;
+    }
+    return out->status ? ESP_OK : ESP_FAIL;
+}
+
+// Wait before reconnecting, doubling with each failure in a row up to PUSH_BACKOFF_MAX_MS
+static void push_backoff(int *failures) {
+    int delay_ms = PUSH_BACKOFF_MIN_MS << (*failures < 6 ? *failures : 6);
+    (*failures)++;
+    vTaskDelay(pdMS_TO_TICKS(delay_ms < PUSH_BACKOFF_MAX_MS ? delay_ms : PUSH_BACKOFF_MAX_MS));
+}
+
+static void push_send_task(void *arg) {
+    int fd = -1;
+    int failures = 0;
+    push_slot_t *batch[FRAME_PUSH_MAX_BATCH];
+
+    while (true) {
+        if (fd < 0) {
+            fd = push_connect();
+            if (fd < 0) {
+                metric_inc(&camera_metrics.push_errors);
+                push_backoff(&failures);
+                continue;
+            }
+            ESP_LOGI(TAG, "Push: connected to %s:%s%s", host, port_str, path);
+        }
+
+        int count = take_batch(batch);
+        if (count == 0) {
+            xSemaphoreTake(pending_signal, pdMS_TO_TICKS(1000));
+            continue;
+        }
+
+        int64_t start_us = esp_timer_get_time();
+        push_response_t response;
+        if (send_batch(fd, batch, count) != ESP_OK || read_response(fd, &response) != ESP_OK) {
+            // The backend never answered for these, so they go out again on a new connection.
+            // A backend that accepts and then resets is backed off like one that refuses.
+            ESP_LOGW(TAG, "Push: connection lost (errno %d)", errno);
+            metric_inc(&camera_metrics.push_errors);
+            finish_batch(batch, count, PUSH_PENDING);
+            close(fd);
+            fd = -1;
+            push_backoff(&failures);
+            continue;
+        }
+        metric_observe(&camera_metrics.push_request_us, (uint32_t)(esp_timer_get_time() - start_us));
+        metric_inc(&camera_metrics.push_requests);
+        failures = 0;
+        finish_batch(batch, count, PUSH_FREE);
+
+        if (response.status >= 200 && response.status < 300) {
+            for (int i = 0; i < count; i++) {
+                metric_inc(&camera_metrics.push_frames_sent);
+            }
+        } else if (response.status == 429 || response.status == 503) {
+            // Backpressure: this batch is dropped and newer frames replace it while we wait
+            for (int i = 0; i < count; i++) {
+                metric_inc(&camera_metrics.push_frames_dropped);
+            }
+            int wait_s = response.retry_after_s > 0 ? response.retry_after_s : 1;
+            wait_s = wait_s < PUSH_RETRY_AFTER_MAX_S ? wait_s : PUSH_RETRY_AFTER_MAX_S;
+            ESP_LOGI(TAG, "Push: backend busy (%d), pausing %d s", response.status, wait_s);
+            vTaskDelay(pdMS_TO_TICKS(wait_s * 1000));
+        } else {
+            ESP_LOGW(TAG, "Push: backend answered %d", response.status);
+            metric_inc(&camera_metrics.push_errors);
+            for (int i = 0; i < count; i++) {
+                metric_inc(&camera_metrics.push_frames_dropped);
+            }
+        }
+        if (response.close) {
+            close(fd);
+            fd = -1;
+        }
+    }
+}
+
+bool start_frame_push(const frame_push_config_t *cfg) {
+    if (!cfg->url || !parse_url(cfg->url)) {
+        ESP_LOGE(TAG, "Push: bad URL %s", cfg->url ? cfg->url : "(null)");
+        return false;
+    }
+    config = *cfg;
+    config.batch_max = cfg->batch_max < 1 ? 1 : cfg->batch_max > FRAME_PUSH_MAX_BATCH ? FRAME_PUSH_MAX_BATCH : cfg->batch_max;
+    config.camera = cfg->camera ? strdup(cfg->camera) : "camera";
+    config.url = NULL;
+    // One slot more than a batch, so the newest frame always has somewhere to go
+    slot_count = config.batch_max + 1;
+    slots_lock = xSemaphoreCreateMutex();
+    pending_signal = xSemaphoreCreateBinary();
+
+    ESP_LOGI(TAG, "Push mode: %s:%s%s as %s, up to %u frames / %u bytes per request",
+             host, port_str, path, config.camera, (unsigned)config.batch_max, (unsigned)config.batch_bytes);
+    xTaskCreatePinnedToCore(push_collect_task, "push_collect", PUSH_TASK_STACK, NULL, 5, NULL, 1);
+    xTaskCreatePinnedToCore(push_send_task, "push_send", PUSH_TASK_STACK, NULL, 5, NULL, 1);
+    return true;
+}
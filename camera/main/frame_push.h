@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Push mode: the camera POSTs its frames to a backend over one HTTP/1.1 keep-alive
+// connection, instead of waiting for the backend to pull /stream or /capture.
+//
+// A collector task copies frames from the ring into batch_max + 1 push slots. A sender task
+// POSTs every pending frame, up to batch_max of them and batch_bytes in total, as one
+// multipart/mixed request:
+//
+//   POST <path> HTTP/1.1
+//   Content-Type: multipart/mixed; boundary=FRAME_PUSH_BOUNDARY
+//   X-Camera: <camera>
+//
+//   --FRAME_PUSH_BOUNDARY
+//   Content-Type: image/jpeg
+//   Content-Length: <bytes>
+//   X-Frame-Seq: <seq>            same as /capture's X-Frame-Seq
+//   X-Timestamp: <ms since boot>  same as /stream's X-Timestamp
+//   X-Change-Score: <per mille>
+//   X-Sharpness: <frame_quality.h>
+//   X-Exposure: <frame_quality.h>
+//
+//   <JPEG>
+//   --FRAME_PUSH_BOUNDARY--
+//
+// While a request is in flight, newer frames take the free slot. When no slot is free, the
+// oldest pending frame is dropped. A slow backend or link therefore gets fewer, fresher
+// frames, never a backlog. A 429 or 503 answer drops the batch and pauses for its
+// Retry-After. A broken connection is reopened with backoff, and its batch is retried.
+
+#define FRAME_PUSH_BOUNDARY     "pushboundary5e2a"
+#define FRAME_PUSH_MAX_BATCH    4
+#define FRAME_PUSH_SOCKETS      1       // The one keep-alive connection
+
+typedef struct {
+    const char *url;            // http://host[:port]/path; IPv4 address or resolvable name
+    const char *camera;         // Sent as X-Camera so the backend can tell cameras apart
+    uint8_t batch_max;          // Frames per request, 1..FRAME_PUSH_MAX_BATCH
+    uint32_t batch_bytes;       // A frame joins a batch only while the batch stays under this
+    uint32_t max_fps;           // Frames taken from the ring per second, 0 = every frame
+    bool changed_only;          // Push only frames the change detector flagged, plus a keepalive
+} frame_push_config_t;
+
+// Start the collector and sender tasks; the config is copied. Returns false for a bad URL.
+bool start_frame_push(const frame_push_config_t *config);
@@ -0,0 +1,69 @@
+#include <string.h>
+#include "frame_quality.h"
+
+#define CLIP_MARGIN         4       // Luma this close to 0 or 255 counts as clipped
+#define SPREAD_LOW_PERMILLE 20      // Percentiles that bound the histogram spread
+#define SPREAD_HIGH_PERMILLE 980
+
+// Smallest value with more than permille of the pixels at or below it
+static int percentile(const uint32_t *hist, uint32_t count, uint32_t permille) {
+    uint32_t target = (uint32_t)((uint64_t)count * permille / 1000);
+    uint32_t seen = 0;
+    for (int v = 0; v < 256; v++) {
+        seen += hist[v];
+        if (seen > target) {
+            return v;
+        }
+    }
+    return 255;
+}
+
+void frame_quality_score(const uint8_t *img, uint16_t width, uint16_t height, frame_quality_t *out) {
+    memset(out, 0, sizeof(*out));
+    if (width < 3 || height < 3) {
+        return;
+    }
+
+    // Laplacian over the interior; |L| <= 1020, so L^2 < 2^20 and the sums fit 64 bits easily
+    int64_t sum = 0;
+    uint64_t sum_sq = 0;
+    for (int y = 1; y < height - 1; y++) {
+        const uint8_t *row = img + (size_t)y * width;
+        for (int x = 1; x < width - 1; x++) {
+            int l = 4 * row[x] - row[x - 1] - row[x + 1] - row[x - width] - row[x + width];
+            sum += l;
+            sum_sq += (uint32_t)(l * l);
+        }
+    }
+    uint32_t n = (uint32_t)(width - 2) * (height - 2);
+    uint64_t mean = (uint64_t)((sum < 0 ? -sum : sum) / n);
+    uint64_t variance = sum_sq / n - mean * mean;
+    out->sharpness = variance > UINT32_MAX ? UINT32_MAX : (uint32_t)variance;
+
+    uint32_t hist[256] = { 0 };
+    uint32_t count = (uint32_t)width * height;
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        hist[img[i]]++;
+        total += img[i];
+    }
+    uint32_t clipped = 0;
+    for (int v = 0; v <= CLIP_MARGIN; v++) {
+        clipped += hist[v] + hist[255 - v];
+    }
+    out->mean = (uint8_t)(total / count);
+    out->clipped = (uint16_t)((uint64_t)clipped * 1000 / count);
+
+    // Spread alone would favour a flat image pushed towards white, so a mean away from
+    // mid-grey costs up to half the score as well
+    int spread = percentile(hist, count, SPREAD_HIGH_PERMILLE) - percentile(hist, count, SPREAD_LOW_PERMILLE);
+    uint32_t off_centre = (uint32_t)(out->mean > 128 ? out->mean - 128 : 128 - out->mean) * 1000 / 256;
+    uint32_t exposure = (uint32_t)spread * FRAME_EXPOSURE_MAX / 255;
+    exposure = exposure * (1000 - out->clipped) / 1000 * (1000 - off_centre) / 1000;
+    out->exposure = (uint16_t)exposure;
+}
+
+uint32_t frame_quality_rank(const frame_quality_t *q) {
+    uint64_t rank = (uint64_t)q->sharpness * q->exposure / FRAME_EXPOSURE_MAX;
+    return rank > UINT32_MAX ? UINT32_MAX : (uint32_t)rank;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+// Focus and exposure scores of a reduced-scale luma image (see jpeg_dc.h), for picking the
+// best of several frames of the same scene. Integer arithmetic only.
+// Portable C with no ESP-IDF dependencies so it also builds on the host.
+
+#define FRAME_EXPOSURE_MAX  1000
+
+typedef struct {
+    uint32_t sharpness;     // Variance of the 4-neighbour Laplacian; motion blur and defocus lower it
+    uint16_t exposure;      // 0..FRAME_EXPOSURE_MAX: 2nd..98th percentile spread, less clipped
+                            // pixels and less for a mean away from mid-grey
+    uint16_t clipped;       // Pixels within 4 of black or white, per mille
+    uint8_t mean;           // Mean luma
+} frame_quality_t;
+
+// Score a width x height 8-bit image. Images under 3x3 score all zeros.
+void frame_quality_score(const uint8_t *img, uint16_t width, uint16_t height, frame_quality_t *out);
+
+// Single figure for ranking frames of one scene: sharpness weighted by exposure.
+// Not comparable across scenes, since sharpness depends on how much detail there is.
+uint32_t frame_quality_rank(const frame_quality_t *q);
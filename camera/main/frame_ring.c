@@ -0,0 +1,203 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_camera.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "jpeg_dc.h"
+#include "change_detect.h"
+#include "frame_quality.h"
+#include "metrics.h"
+#include "frame_ring.h"
+
+#define MIN_FRAME_LEN       1500    // Smaller JPEGs are corrupt or badly exposed
+#define CAPTURE_TASK_STACK  4096
+#define FRAME_READY_BIT     BIT0
+#define CHANGE_PIXEL_THRESHOLD  12  // Block mean difference that counts as changed
+#define CHANGE_LEARN_SHIFT      4   // Background follows 1/16 of each frame
+
+static const char *TAG = "ESP32S_Camera";
+
+static frame_slot_t frame_ring[FRAME_RING_SLOTS];
+static int latest_slot = -1;
+static uint32_t frame_seq = 0;
+static SemaphoreHandle_t ring_lock;
+static EventGroupHandle_t ring_events;
+
+static change_detector_t detector;
+static uint8_t *dc_image;           // 1/8 scale luma of the frame being scored
+static size_t dc_cap;
+static motion_status_t motion = { .last_change_us = -1 };
+
+void frame_ring_init() {
+    ring_lock = xSemaphoreCreateMutex();
+    ring_events = xEventGroupCreate();
+    change_detect_init(&detector, CHANGE_PIXEL_THRESHOLD, CHANGE_LEARN_SHIFT);
+}
+
+// Pick a slot the producer may overwrite: not the latest frame and not pinned by any client
+static int frame_ring_claim() {
+    int idx = -1;
+    xSemaphoreTake(ring_lock, portMAX_DELAY);
+    for (int i = 0; i < FRAME_RING_SLOTS; i++) {
+        if (i != latest_slot && frame_ring[i].refs == 0) {
+            idx = i;
+            break;
+        }
+    }
+    xSemaphoreGive(ring_lock);
+    return idx;
+}
+
+// Score a slot against the background model, and its focus and exposure, from its DC-only decode
+static void score_frame(frame_slot_t *slot) {
+    int64_t start_us = esp_timer_get_time();
+    size_t need = (size_t)JPEG_DC_SCALED(slot->width) * JPEG_DC_SCALED(slot->height);
+    if (dc_cap < need) {
+        free(dc_image);
+        dc_image = malloc(need);
+        dc_cap = dc_image ? need : 0;
+    }
+
+    uint16_t w, h;
+    int score = -1;
+    int err = dc_image ? jpeg_dc_decode(slot->buf, slot->len, dc_image, dc_cap, &w, &h) : JPEG_DC_ERR_SIZE;
+    if (err == JPEG_DC_OK) {
+        score = change_detect_update(&detector, dc_image, w, h);
+        frame_quality_score(dc_image, w, h, &slot->quality);
+    } else {
+        memset(&slot->quality, 0, sizeof(slot->quality));
+        ESP_LOGD(TAG, "Reduced decode failed: %d", err);
+    }
+
+    // A frame we can't score is passed on as changed
+    slot->change_score = score < 0 ? CHANGE_SCORE_MAX : (uint16_t)score;
+    slot->changed = slot->change_score >= CHANGE_SCORE_THRESHOLD;
+    motion.decode_us = (uint32_t)(esp_timer_get_time() - start_us);
+}
+
+// Make a filled slot the latest frame and wake every waiting client
+static void frame_ring_publish(int idx) {
+    frame_slot_t *slot = &frame_ring[idx];
+    xSemaphoreTake(ring_lock, portMAX_DELAY);
+    slot->seq = ++frame_seq;
+    latest_slot = idx;
+    motion.seq = slot->seq;
+    motion.score = slot->change_score;
+    motion.changed = slot->changed;
+    if (slot->changed) {
+        motion.last_change_us = slot->timestamp_us;
+    }
+    xSemaphoreGive(ring_lock);
+
+    // Setting the bit releases all current waiters; clearing it right away re-arms the broadcast
+    xEventGroupSetBits(ring_events, FRAME_READY_BIT);
+    xEventGroupClearBits(ring_events, FRAME_READY_BIT);
+}
+
+frame_slot_t *frame_ring_acquire(uint32_t after_seq, TickType_t timeout) {
+    TickType_t start = xTaskGetTickCount();
+    while (true) {
+        frame_slot_t *slot = NULL;
+        xSemaphoreTake(ring_lock, portMAX_DELAY);
+        if (latest_slot >= 0 && frame_ring[latest_slot].seq > after_seq) {
+            slot = &frame_ring[latest_slot];
+            slot->refs++;
+        }
+        xSemaphoreGive(ring_lock);
+        if (slot) {
+            return slot;
+        }
+
+        TickType_t waited = xTaskGetTickCount() - start;
+        if (waited >= timeout) {
+            return NULL;
+        }
+        xEventGroupWaitBits(ring_events, FRAME_READY_BIT, pdFALSE, pdFALSE, timeout - waited);
+    }
+}
+
+void frame_ring_motion(motion_status_t *out) {
+    xSemaphoreTake(ring_lock, portMAX_DELAY);
+    *out = motion;
+    xSemaphoreGive(ring_lock);
+}
+
+void frame_ring_release(frame_slot_t *slot) {
+    xSemaphoreTake(ring_lock, portMAX_DELAY);
+    slot->refs--;
+    xSemaphoreGive(ring_lock);
+}
+
+// Dedicated producer: the only place that talks to the camera driver
+static void capture_task(void *arg) {
+    ESP_LOGI(TAG, "Capture task started on core %d", xPortGetCoreID());
+
+    while (true) {
+        int64_t wait_start_us = esp_timer_get_time();
+        camera_fb_t *fb = esp_camera_fb_get();
+        metric_observe(&camera_metrics.fb_get_us, (uint32_t)(esp_timer_get_time() - wait_start_us));
+        if (!fb) {
+            metric_inc(&camera_metrics.capture_failures);
+            ESP_LOGE(TAG, "Camera capture failed");
+            vTaskDelay(pdMS_TO_TICKS(33));
+            continue;
+        }
+
+        // Validate frame size (accept smaller frames while fixing exposure)
+        metric_observe(&camera_metrics.frame_bytes, fb->len);
+        if (fb->len < MIN_FRAME_LEN || fb->format != PIXFORMAT_JPEG) {
+            metric_inc(fb->format != PIXFORMAT_JPEG ? &camera_metrics.dropped_not_jpeg
+                                                    : &camera_metrics.dropped_too_small);
+            ESP_LOGW(TAG, "Dropping frame: len=%zu, format=%d", fb->len, fb->format);
+            esp_camera_fb_return(fb);
+            vTaskDelay(pdMS_TO_TICKS(33));
+            continue;
+        }
+
+        // Every slot pinned by slow clients: drop this exposure rather than wait for them
+        int idx = frame_ring_claim();
+        if (idx < 0) {
+            metric_inc(&camera_metrics.dropped_ring_full);
+            esp_camera_fb_return(fb);
+            continue;
+        }
+
+        frame_slot_t *slot = &frame_ring[idx];
+        if (slot->cap < fb->len) {
+            // Grow with headroom so quality changes don't reallocate every frame
+            size_t cap = fb->len + fb->len / 4;
+            heap_caps_free(slot->buf);
+            slot->buf = heap_caps_malloc_prefer(cap, 2, MALLOC_CAP_SPIRAM, MALLOC_CAP_8BIT);
+            slot->cap = slot->buf ? cap : 0;
+            if (!slot->buf) {
+                metric_inc(&camera_metrics.dropped_no_memory);
+                ESP_LOGE(TAG, "Out of memory for %zu byte frame slot", cap);
+                esp_camera_fb_return(fb);
+                vTaskDelay(pdMS_TO_TICKS(100));
+                continue;
+            }
+        }
+
+        memcpy(slot->buf, fb->buf, fb->len);
+        slot->len = fb->len;
+        slot->width = fb->width;
+        slot->height = fb->height;
+        slot->timestamp_us = esp_timer_get_time();
+        esp_camera_fb_return(fb);
+
+        score_frame(slot);
+        frame_ring_publish(idx);
+        metric_inc(&camera_metrics.frames_captured);
+        boot_mark(BOOT_FIRST_FRAME);
+    }
+}
+
+void start_capture_task() {
+    xTaskCreatePinnedToCore(capture_task, "capture", CAPTURE_TASK_STACK, NULL, 6, NULL, 0);
+}
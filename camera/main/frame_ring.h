@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "frame_quality.h"
+
+// Latest frame + frames pinned by clients + one being filled
+#define FRAME_RING_SLOTS    4
+
+// Changed blocks per mille (see change_detect.h) at which a frame counts as changed
+#define CHANGE_SCORE_THRESHOLD  20
+
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    size_t cap;
+    uint16_t width;
+    uint16_t height;
+    uint32_t seq;           // 0 = never filled
+    int64_t timestamp_us;   // esp_timer time the frame left the driver
+    int refs;               // Clients currently sending this frame
+    uint16_t change_score;  // Changed blocks per mille against the background model
+    bool changed;           // change_score reached CHANGE_SCORE_THRESHOLD
+    frame_quality_t quality;    // Focus and exposure from the same reduced decode; zeros if it failed
+} frame_slot_t;
+
+typedef struct {
+    uint32_t seq;           // Latest frame
+    uint16_t score;
+    bool changed;
+    int64_t last_change_us; // Timestamp of the last changed frame, -1 if none yet
+    uint32_t decode_us;     // Cost of the last reduced decode and score
+} motion_status_t;
+
+// Set up the frame ring before the capture task or the server touch it
+void frame_ring_init();
+
+// Start the producer task on core 0, the only caller of esp_camera_fb_get()
+void start_capture_task();
+
+// Pin the newest frame with a sequence number above after_seq, waiting up to timeout for one
+frame_slot_t *frame_ring_acquire(uint32_t after_seq, TickType_t timeout);
+
+// Change detection state of the latest frame
+void frame_ring_motion(motion_status_t *out);
+
+// Unpin a frame returned by frame_ring_acquire()
+void frame_ring_release(frame_slot_t *slot);
@@ -0,0 +1,366 @@
+#include <stdbool.h>
+#include <string.h>
+#include "jpeg_dc.h"
+
+#define MAX_COMPONENTS  4
+#define LOOKAHEAD       9       // Huffman codes up to this length decode with one table lookup
+
+typedef struct {
+    uint16_t lut[1 << LOOKAHEAD];   // (code length << 8) | symbol, 0 = code is longer
+    int32_t maxcode[17];            // Largest code of each length, -1 if none
+    int32_t valoffset[17];          // Code of a given length minus its symbol index
+    uint8_t symbols[256];
+    bool defined;
+} huff_table_t;
+
+typedef struct {
+    uint8_t id;
+    uint8_t h;
+    uint8_t v;
+    uint8_t tq;
+    uint8_t td;
+    uint8_t ta;
+    int pred;
+} component_t;
+
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    uint32_t acc;       // Left-aligned bit buffer
+    int count;          // Valid bits in acc
+} bit_reader_t;
+
+typedef struct {
+    huff_table_t dc[4];
+    huff_table_t ac[4];
+    uint16_t qdc[4];    // DC entry of each quantization table
+    component_t comp[MAX_COMPONENTS];
+    int ncomp;
+    uint16_t width;
+    uint16_t height;
+    uint16_t restart;
+} decoder_t;
+
+static inline uint16_t be16(const uint8_t *p) {
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+// Top the buffer up to at least 25 bits, undoing 0xFF00 stuffing. At a marker the
+// reader stops advancing and feeds zeros, so corrupt data can't run past the scan.
+static void fill(bit_reader_t *br) {
+    while (br->count <= 24) {
+        uint32_t byte = 0;
+        if (br->p < br->end) {
+            byte = *br->p;
+            if (byte != 0xFF) {
+                br->p++;
+            } else if (br->p + 1 < br->end && br->p[1] == 0x00) {
+                br->p += 2;
+            } else {
+                byte = 0;
+            }
+        }
+        br->acc |= byte << (24 - br->count);
+        br->count += 8;
+    }
+}
+
+static inline uint32_t get_bits(bit_reader_t *br, int n) {
+    if (br->count < n) {
+        fill(br);
+    }
+    uint32_t v = br->acc >> (32 - n);
+    br->acc <<= n;
+    br->count -= n;
+    return v;
+}
+
+static int decode_huff(bit_reader_t *br, const huff_table_t *t) {
+    fill(br);
+    uint16_t e = t->lut[br->acc >> (32 - LOOKAHEAD)];
+    if (e) {
+        br->acc <<= e >> 8;
+        br->count -= e >> 8;
+        return e & 0xFF;
+    }
+    for (int l = LOOKAHEAD + 1; l <= 16; l++) {
+        int32_t code = (int32_t)(br->acc >> (32 - l));
+        if (code <= t->maxcode[l]) {
+            br->acc <<= l;
+            br->count -= l;
+            return t->symbols[code - t->valoffset[l]];
+        }
+    }
+    return -1;
+}
+
+// JPEG F.2.2.1: s-bit magnitude category to signed value
+static inline int extend(uint32_t v, int s) {
+    return v < (1u << (s - 1)) ? (int)v - (1 << s) + 1 : (int)v;
+}
+
+static int build_huff(huff_table_t *t, const uint8_t *counts, const uint8_t *symbols, int total) {
+    memset(t, 0, sizeof(*t));
+    memcpy(t->symbols, symbols, total);
+
+    int32_t code = 0;
+    int k = 0;
+    for (int l = 1; l <= 16; l++) {
+        t->valoffset[l] = code - k;
+        for (int i = 0; i < counts[l - 1]; i++, k++, code++) {
+            // Over-subscribed code space: checked before the fill, which would index past lut
+            if (code >= (1 << l)) {
+                return JPEG_DC_ERR_FORMAT;
+            }
+            if (l <= LOOKAHEAD) {
+                int shift = LOOKAHEAD - l;
+                for (int suffix = 0; suffix < (1 << shift); suffix++) {
+                    t->lut[(code << shift) | suffix] = (uint16_t)((l << 8) | symbols[k]);
+                }
+            }
+        }
+        t->maxcode[l] = counts[l - 1] ? code - 1 : -1;
+        code <<= 1;
+    }
+    t->defined = true;
+    return JPEG_DC_OK;
+}
+
+static int parse_dht(decoder_t *d, const uint8_t *seg, size_t n) {
+    while (n >= 17) {
+        int tc = seg[0] >> 4;
+        int th = seg[0] & 15;
+        int total = 0;
+        for (int i = 1; i <= 16; i++) {
+            total += seg[i];
+        }
+        if (tc > 1 || th > 3 || total > 256 || n < 17 + (size_t)total) {
+            return JPEG_DC_ERR_FORMAT;
+        }
+        huff_table_t *t = tc ? &d->ac[th] : &d->dc[th];
+        int err = build_huff(t, seg + 1, seg + 17, total);
+        if (err) {
+            return err;
+        }
+        seg += 17 + total;
+        n -= 17 + total;
+    }
+    return JPEG_DC_OK;
+}
+
+static int parse_dqt(decoder_t *d, const uint8_t *seg, size_t n) {
+    while (n >= 65) {
+        int pq = seg[0] >> 4;
+        int tq = seg[0] & 15;
+        size_t size = 1 + 64 * (pq ? 2 : 1);
+        if (tq > 3 || n < size) {
+            return JPEG_DC_ERR_FORMAT;
+        }
+        // Entry 0 in zigzag order is the DC quantizer
+        d->qdc[tq] = pq ? be16(seg + 1) : seg[1];
+        seg += size;
+        n -= size;
+    }
+    return JPEG_DC_OK;
+}
+
+static int parse_sof(decoder_t *d, const uint8_t *seg, size_t n) {
+    if (n < 6 || seg[0] != 8) {
+        return n < 6 ? JPEG_DC_ERR_FORMAT : JPEG_DC_ERR_UNSUPPORTED;
+    }
+    d->height = be16(seg + 1);
+    d->width = be16(seg + 3);
+    d->ncomp = seg[5];
+    if (d->ncomp < 1 || d->ncomp > MAX_COMPONENTS || n < 6 + 3 * (size_t)d->ncomp ||
+        d->width == 0 || d->height == 0) {
+        return JPEG_DC_ERR_FORMAT;
+    }
+    for (int i = 0; i < d->ncomp; i++) {
+        const uint8_t *c = seg + 6 + 3 * i;
+        d->comp[i].id = c[0];
+        d->comp[i].h = c[1] >> 4;
+        d->comp[i].v = c[1] & 15;
+        d->comp[i].tq = c[2] & 3;
+        if (d->comp[i].h < 1 || d->comp[i].h > 4 || d->comp[i].v < 1 || d->comp[i].v > 4) {
+            return JPEG_DC_ERR_FORMAT;
+        }
+    }
+    return JPEG_DC_OK;
+}
+
+static int decode_scan(decoder_t *d, const uint8_t *seg, size_t n, const uint8_t *data, const uint8_t *end,
+                       uint8_t *out, size_t out_cap, uint16_t *width, uint16_t *height) {
+    if (d->ncomp == 0 || n < 1 || n < 1 + 2 * (size_t)seg[0]) {
+        return JPEG_DC_ERR_FORMAT;
+    }
+    // One interleaved scan carrying every component, as baseline encoders (and the camera) write
+    if (seg[0] != d->ncomp) {
+        return JPEG_DC_ERR_UNSUPPORTED;
+    }
+    for (int i = 0; i < d->ncomp; i++) {
+        const uint8_t *s = seg + 1 + 2 * i;
+        if (s[0] != d->comp[i].id) {
+            return JPEG_DC_ERR_UNSUPPORTED;
+        }
+        d->comp[i].td = s[1] >> 4;
+        d->comp[i].ta = s[1] & 15;
+        d->comp[i].pred = 0;
+        if (d->comp[i].td > 3 || d->comp[i].ta > 3 ||
+            !d->dc[d->comp[i].td].defined || !d->ac[d->comp[i].ta].defined) {
+            return JPEG_DC_ERR_FORMAT;
+        }
+    }
+
+    int hmax = 1, vmax = 1;
+    for (int i = 0; i < d->ncomp; i++) {
+        hmax = d->comp[i].h > hmax ? d->comp[i].h : hmax;
+        vmax = d->comp[i].v > vmax ? d->comp[i].v : vmax;
+    }
+    component_t *luma = &d->comp[0];
+    if (d->ncomp == 1) {
+        // Non-interleaved: one block per MCU regardless of the declared sampling factors
+        luma->h = luma->v = 1;
+        hmax = vmax = 1;
+    } else if (luma->h != hmax || luma->v != vmax) {
+        return JPEG_DC_ERR_UNSUPPORTED;
+    }
+
+    int ow = JPEG_DC_SCALED(d->width);
+    int oh = JPEG_DC_SCALED(d->height);
+    if ((size_t)ow * oh > out_cap) {
+        return JPEG_DC_ERR_SIZE;
+    }
+    int mcux = (d->width + 8 * hmax - 1) / (8 * hmax);
+    int mcuy = (d->height + 8 * vmax - 1) / (8 * vmax);
+    int q0 = d->qdc[luma->tq];
+
+    bit_reader_t br = { .p = data, .end = end };
+    for (int m = 0; m < mcux * mcuy; m++) {
+        if (d->restart && m > 0 && m % d->restart == 0) {
+            // Drop the padding bits and step over the RSTn marker
+            br.acc = 0;
+            br.count = 0;
+            while (br.p + 1 < br.end && !(br.p[0] == 0xFF && (br.p[1] & 0xF8) == 0xD0)) {
+                br.p++;
+            }
+            br.p += 2;
+            for (int i = 0; i < d->ncomp; i++) {
+                d->comp[i].pred = 0;
+            }
+        }
+
+        int mx = m % mcux;
+        int my = m / mcux;
+        for (int i = 0; i < d->ncomp; i++) {
+            component_t *c = &d->comp[i];
+            const huff_table_t *dc = &d->dc[c->td];
+            const huff_table_t *ac = &d->ac[c->ta];
+            for (int b = 0; b < c->h * c->v; b++) {
+                int s = decode_huff(&br, dc);
+                if (s < 0 || s > 11) {
+                    return JPEG_DC_ERR_FORMAT;
+                }
+                if (s) {
+                    c->pred += extend(get_bits(&br, s), s);
+                }
+
+                for (int k = 1; k < 64;) {
+                    int rs = decode_huff(&br, ac);
+                    if (rs < 0) {
+                        return JPEG_DC_ERR_FORMAT;
+                    }
+                    int r = rs >> 4;
+                    s = rs & 15;
+                    if (s) {
+                        get_bits(&br, s);
+                        k += r + 1;
+                    } else if (r == 15) {
+                        k += 16;
+                    } else {
+                        break;
+                    }
+                }
+
+                if (i == 0) {
+                    int x = mx * c->h + b % c->h;
+                    int y = my * c->v + b / c->h;
+                    if (x < ow && y < oh) {
+                        // The DC term is 8x the block mean after the -128 level shift
+                        int v = 128 + c->pred * q0 / 8;
+                        out[y * ow + x] = (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+                    }
+                }
+            }
+        }
+    }
+
+    *width = (uint16_t)ow;
+    *height = (uint16_t)oh;
+    return JPEG_DC_OK;
+}
+
+int jpeg_dc_decode(const uint8_t *jpg, size_t len, uint8_t *out, size_t out_cap,
+                   uint16_t *width, uint16_t *height) {
+    if (len < 4 || jpg[0] != 0xFF || jpg[1] != 0xD8) {
+        return JPEG_DC_ERR_FORMAT;
+    }
+
+    // Huffman tables are large; keep them off the caller's (task) stack
+    static decoder_t d;
+    memset(&d, 0, sizeof(d));
+
+    size_t pos = 2;
+    while (pos + 4 <= len) {
+        if (jpg[pos] != 0xFF) {
+            return JPEG_DC_ERR_FORMAT;
+        }
+        uint8_t marker = jpg[pos + 1];
+        pos += 2;
+        if (marker == 0xFF) {
+            pos--;              // Fill byte
+            continue;
+        }
+        if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8)) {
+            continue;           // Markers without a length
+        }
+        if (marker == 0xD9) {
+            break;
+        }
+
+        size_t seglen = be16(jpg + pos);
+        if (seglen < 2 || pos + seglen > len) {
+            return JPEG_DC_ERR_FORMAT;
+        }
+        const uint8_t *seg = jpg + pos + 2;
+        size_t n = seglen - 2;
+        int err = JPEG_DC_OK;
+
+        switch (marker) {
+        case 0xC0:
+        case 0xC1:
+            err = parse_sof(&d, seg, n);
+            break;
+        case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7:
+        case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+            return JPEG_DC_ERR_UNSUPPORTED;
+        case 0xC4:
+            err = parse_dht(&d, seg, n);
+            break;
+        case 0xDB:
+            err = parse_dqt(&d, seg, n);
+            break;
+        case 0xDD:
+            d.restart = n >= 2 ? be16(seg) : 0;
+            break;
+        case 0xDA:
+            return decode_scan(&d, seg, n, jpg + pos + seglen, jpg + len, out, out_cap, width, height);
+        default:
+            break;              // APPn, COM and friends
+        }
+        if (err) {
+            return err;
+        }
+        pos += seglen;
+    }
+    return JPEG_DC_ERR_FORMAT;
+}
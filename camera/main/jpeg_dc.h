@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Reduced-scale JPEG decoder: reads only the luma DC coefficient of each 8x8 block,
+// giving a 1/8 scale grayscale image without any IDCT. AC coefficients are Huffman
+// decoded only to skip them. Baseline (SOF0/SOF1) Huffman JPEGs only, any subsampling.
+// Portable C with no ESP-IDF dependencies so it also builds on the host.
+
+#define JPEG_DC_OK              0
+#define JPEG_DC_ERR_FORMAT      -1  // Not a JPEG, truncated or corrupt
+#define JPEG_DC_ERR_UNSUPPORTED -2  // Progressive, arithmetic or 12-bit JPEG
+#define JPEG_DC_ERR_SIZE        -3  // Output buffer too small
+
+// Output size in pixels for an image of the given size
+#define JPEG_DC_SCALED(px)      (((px) + 7) / 8)
+
+// Decode jpg into out (row-major, width*height bytes, out_cap bytes available).
+// width and height receive the 1/8 scale output size. Not re-entrant: the Huffman
+// tables live in a static workspace, so call it from one task only.
+int jpeg_dc_decode(const uint8_t *jpg, size_t len, uint8_t *out, size_t out_cap,
+                   uint16_t *width, uint16_t *height);
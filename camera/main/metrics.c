@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include "esp_timer.h"
+#include "metrics.h"
+
+#define COUNT_OF(a) (sizeof(a) / sizeof((a)[0]))
+
+// 100 us .. 1 s: sub-millisecond header work up to a stalled WiFi send or sensor
+static const uint32_t LATENCY_BOUNDS_US[] = {
+    100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000,
+};
+
+static const uint32_t FRAME_SIZE_BOUNDS[] = {
+    4096, 8192, 16384, 24576, 32768, 49152, 65536, 98304, 131072, 262144,
+};
+
+#define LATENCY_HISTOGRAM { .bounds = LATENCY_BOUNDS_US, .bound_count = COUNT_OF(LATENCY_BOUNDS_US) }
+
+camera_metrics_t camera_metrics = {
+    .fb_get_us = LATENCY_HISTOGRAM,
+    .frame_bytes = { .bounds = FRAME_SIZE_BOUNDS, .bound_count = COUNT_OF(FRAME_SIZE_BOUNDS) },
+    .frame_wait_us = LATENCY_HISTOGRAM,
+    .part_format_us = LATENCY_HISTOGRAM,
+    .part_send_us = LATENCY_HISTOGRAM,
+    .push_request_us = LATENCY_HISTOGRAM,
+};
+
+// Microseconds since esp_timer start, 0 until reached; 32 bits cover the first 71 minutes
+static atomic_uint_least32_t boot_phases_us[BOOT_PHASE_COUNT];
+
+static const char *const BOOT_PHASE_NAMES[BOOT_PHASE_COUNT] = {
+    [BOOT_NVS_READY] = "nvs_ready",
+    [BOOT_WIFI_STARTED] = "wifi_started",
+    [BOOT_CAMERA_READY] = "camera_ready",
+    [BOOT_SENSOR_CONFIGURED] = "sensor_configured",
+    [BOOT_WIFI_CONNECTED] = "wifi_connected",
+    [BOOT_GOT_IP] = "got_ip",
+    [BOOT_SERVER_READY] = "server_ready",
+    [BOOT_FIRST_FRAME] = "first_frame",
+};
+
+void boot_mark(boot_phase_t phase) {
+    // Cheap for callers on a hot path, such as the capture task marking the first frame
+    if (atomic_load_explicit(&boot_phases_us[phase], memory_order_relaxed)) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    uint32_t us = now < 1 ? 1 : now > UINT32_MAX ? UINT32_MAX : (uint32_t)now;
+    uint_least32_t unset = 0;
+    atomic_compare_exchange_strong_explicit(&boot_phases_us[phase], &unset, us,
+                                            memory_order_relaxed, memory_order_relaxed);
+}
+
+int64_t boot_phase_us(boot_phase_t phase) {
+    uint32_t us = atomic_load_explicit(&boot_phases_us[phase], memory_order_relaxed);
+    return us ? (int64_t)us : -1;
+}
+
+const char *boot_phase_name(boot_phase_t phase) {
+    return BOOT_PHASE_NAMES[phase];
+}
+
+void metric_add64(metric_counter64_t *counter, uint32_t value) {
+    uint32_t old = atomic_fetch_add_explicit(&counter->lo, value, memory_order_relaxed);
+    if ((uint32_t)(old + value) < old) {
+        atomic_fetch_add_explicit(&counter->hi, 1, memory_order_relaxed);
+    }
+}
+
+uint64_t metric_read64(const metric_counter64_t *counter) {
+    uint32_t hi, lo;
+    do {
+        hi = atomic_load_explicit(&counter->hi, memory_order_relaxed);
+        lo = atomic_load_explicit(&counter->lo, memory_order_relaxed);
+    } while (hi != atomic_load_explicit(&counter->hi, memory_order_relaxed));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+void metric_observe(metric_histogram_t *h, uint32_t value) {
+    int i = 0;
+    while (i < h->bound_count && value > h->bounds[i]) {
+        i++;
+    }
+    atomic_fetch_add_explicit(&h->buckets[i], 1, memory_order_relaxed);
+    metric_add64(&h->sum, value);
+}
+
+int metric_format_histogram(char *buf, size_t cap, const char *name, const char *help,
+                            const metric_histogram_t *h, double scale) {
+    size_t len = 0;
+    uint32_t cumulative = 0;
+
+#define APPEND(...) do { \
+        int n = snprintf(buf + len, cap - len, __VA_ARGS__); \
+        len = (n < 0 || (size_t)n >= cap - len) ? cap - 1 : len + n; \
+    } while (0)
+
+    APPEND("# HELP %s %s\n# TYPE %s histogram\n", name, help, name);
+    for (int i = 0; i < h->bound_count; i++) {
+        cumulative += atomic_load_explicit(&h->buckets[i], memory_order_relaxed);
+        APPEND("%s_bucket{le=\"%g\"} %u\n", name, h->bounds[i] * scale, (unsigned)cumulative);
+    }
+    cumulative += atomic_load_explicit(&h->buckets[h->bound_count], memory_order_relaxed);
+    APPEND("%s_bucket{le=\"+Inf\"} %u\n", name, (unsigned)cumulative);
+    APPEND("%s_sum %.9g\n", name, metric_read64(&h->sum) * scale);
+    APPEND("%s_count %u\n", name, (unsigned)cumulative);
+
+#undef APPEND
+    return (int)len;
+}
+
+int metric_format_boot_phases(char *buf, size_t cap) {
+    size_t len = 0;
+    int n = snprintf(buf, cap, "# HELP camera_boot_phase_seconds Time from boot to each startup phase\n"
+                               "# TYPE camera_boot_phase_seconds gauge\n");
+    len = (n < 0 || (size_t)n >= cap) ? cap - 1 : (size_t)n;
+    for (int i = 0; i < BOOT_PHASE_COUNT && len < cap - 1; i++) {
+        int64_t us = boot_phase_us(i);
+        if (us < 0) {
+            continue;
+        }
+        n = snprintf(buf + len, cap - len, "camera_boot_phase_seconds{phase=\"%s\"} %.6f\n",
+                     BOOT_PHASE_NAMES[i], us / 1e6);
+        len = (n < 0 || (size_t)n >= cap - len) ? cap - 1 : len + n;
+    }
+    return (int)len;
+}
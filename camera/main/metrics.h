@@ -0,0 +1,101 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Fixed-size counters and histograms for /metrics. Updates are relaxed 32-bit atomics, so
+// the capture and stream tasks never take a lock for them and a scrape never blocks either.
+// Portable C with no ESP-IDF dependencies so it also builds on the host.
+
+#define METRIC_MAX_BUCKETS  16      // Finite bucket bounds per histogram; +Inf is extra
+
+// 64-bit counter from two 32-bit atomics: the low word carries into the high word.
+// A read racing a carry can come back 2^32 low once; Prometheus rate() shrugs that off.
+typedef struct {
+    atomic_uint_least32_t lo;
+    atomic_uint_least32_t hi;
+} metric_counter64_t;
+
+typedef struct {
+    const uint32_t *bounds;         // Ascending upper bounds, in the observed unit
+    uint8_t bound_count;
+    atomic_uint_least32_t buckets[METRIC_MAX_BUCKETS + 1];  // Not cumulative; last is +Inf
+    metric_counter64_t sum;
+} metric_histogram_t;
+
+typedef struct {
+    // Capture task
+    metric_histogram_t fb_get_us;       // Wait inside esp_camera_fb_get
+    metric_histogram_t frame_bytes;     // Size of every JPEG the sensor delivered
+    atomic_uint_least32_t frames_captured;
+    atomic_uint_least32_t capture_failures;
+    atomic_uint_least32_t dropped_too_small;
+    atomic_uint_least32_t dropped_not_jpeg;
+    atomic_uint_least32_t dropped_ring_full;
+    atomic_uint_least32_t dropped_no_memory;
+
+    // Stream tasks
+    metric_histogram_t frame_wait_us;   // Waiting on the ring for a newer frame
+    metric_histogram_t part_format_us;  // Patching the part header
+    metric_histogram_t part_send_us;    // Gathered write of header, JPEG and boundary
+    atomic_uint_least32_t stream_connections;
+    atomic_uint_least32_t stream_rejected;
+    atomic_uint_least32_t stream_disconnects;
+
+    // /capture
+    atomic_uint_least32_t capture_sent;
+    atomic_uint_least32_t capture_not_modified;
+
+    // Frame link
+    atomic_uint_least32_t link_connections;
+    atomic_uint_least32_t link_rejected;
+    atomic_uint_least32_t link_disconnects;
+    atomic_uint_least32_t link_frames_sent;
+
+    // Push mode
+    metric_histogram_t push_request_us; // POST of one batch until its response
+    atomic_uint_least32_t push_connections;
+    atomic_uint_least32_t push_requests;
+    atomic_uint_least32_t push_frames_sent;
+    atomic_uint_least32_t push_frames_dropped;  // Replaced while pending, or refused by the backend
+    atomic_uint_least32_t push_errors;
+} camera_metrics_t;
+
+extern camera_metrics_t camera_metrics;
+
+static inline void metric_inc(atomic_uint_least32_t *counter) {
+    atomic_fetch_add_explicit(counter, 1, memory_order_relaxed);
+}
+
+void metric_add64(metric_counter64_t *counter, uint32_t value);
+uint64_t metric_read64(const metric_counter64_t *counter);
+void metric_observe(metric_histogram_t *h, uint32_t value);
+
+// Boot phases in the order they usually complete; camera and network phases run concurrently
+typedef enum {
+    BOOT_NVS_READY,
+    BOOT_WIFI_STARTED,      // esp_wifi_start returned; association runs in the background
+    BOOT_CAMERA_READY,      // esp_camera_init returned
+    BOOT_SENSOR_CONFIGURED,
+    BOOT_WIFI_CONNECTED,    // Associated with the AP
+    BOOT_GOT_IP,
+    BOOT_SERVER_READY,      // HTTP server and frame link listening
+    BOOT_FIRST_FRAME,       // First frame published to the ring
+    BOOT_PHASE_COUNT
+} boot_phase_t;
+
+// Record the esp_timer time a phase completed; only the first call per phase counts
+void boot_mark(boot_phase_t phase);
+
+// Microseconds from esp_timer start to the phase, or -1 if it has not happened yet
+int64_t boot_phase_us(boot_phase_t phase);
+const char *boot_phase_name(boot_phase_t phase);
+
+// Render a histogram in Prometheus text format, multiplying bounds and sum by scale
+// (e.g. 1e-6 to export microseconds as seconds). Returns the length written, at most cap - 1.
+int metric_format_histogram(char *buf, size_t cap, const char *name, const char *help,
+                            const metric_histogram_t *h, double scale);
+
+// Render the reached boot phases as a camera_boot_phase_seconds gauge
+int metric_format_boot_phases(char *buf, size_t cap);
@@ -0,0 +1,24 @@
+#include <stdint.h>
+#include "net_util.h"
+
+esp_err_t send_iov(int fd, struct iovec *iov, int iovcnt) {
+    struct msghdr msg = { 0 };
+    while (iovcnt > 0) {
+        msg.msg_iov = iov;
+        msg.msg_iovlen = iovcnt;
+        ssize_t sent = sendmsg(fd, &msg, 0);
+        if (sent <= 0) {
+            return ESP_FAIL;
+        }
+        while (iovcnt > 0 && (size_t)sent >= iov->iov_len) {
+            sent -= iov->iov_len;
+            iov++;
+            iovcnt--;
+        }
+        if (iovcnt > 0) {
+            iov->iov_base = (uint8_t *)iov->iov_base + sent;
+            iov->iov_len -= sent;
+        }
+    }
+    return ESP_OK;
+}
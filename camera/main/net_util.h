@@ -0,0 +1,8 @@
+#pragma once
+
+#include "esp_err.h"
+#include "lwip/sockets.h"
+
+// Gathered blocking send that survives partial writes; returns ESP_OK once every byte is out.
+// Advances iov in place.
+esp_err_t send_iov(int fd, struct iovec *iov, int iovcnt);
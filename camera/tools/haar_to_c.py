@@ -0,0 +1,109 @@
+"""Convert an OpenCV Haar cascade (stump-based, new XML format) into the fixed-point C
+tables used by camera/main/face_detect.c.
+
+    python camera/tools/haar_to_c.py \
+        "$(python -c 'import cv2; print(cv2.data.haarcascades)')haarcascade_frontalface_alt.xml" \
+        camera/main/face_cascade_data.h
+
+opencv-python is already a backend dependency, so the cascade XMLs ship with it.
+"""
+import argparse
+import re
+import xml.etree.ElementTree as ET
+
+THRESHOLD_Q = 20    # Stump thresholds, compared against feature * 2^Q / variance norm
+LEAF_Q = 12         # Leaf values and stage thresholds
+
+
+def fixed(value, q):
+    return int(round(float(value) * (1 << q)))
+
+
+def read_cascade(path):
+    root = ET.parse(path).getroot().find('cascade')
+    if root.findtext('featureType').strip() != 'HAAR':
+        raise SystemExit('only HAAR cascades are supported')
+    width = int(root.findtext('width'))
+    height = int(root.findtext('height'))
+
+    features = []
+    for feature in root.find('features'):
+        if feature.findtext('tilted', '0').strip() not in ('0', ''):
+            raise SystemExit('tilted features are not supported')
+        rects = []
+        for rect in feature.find('rects'):
+            x, y, w, h, weight = rect.text.split()
+            if float(weight) != int(float(weight)):
+                raise SystemExit(f'non-integer rect weight {weight}')
+            rects.append((int(x), int(y), int(w), int(h), int(float(weight))))
+        features.append(rects)
+
+    stages = []
+    for stage in root.find('stages'):
+        stumps = []
+        for weak in stage.find('weakClassifiers'):
+            nodes = weak.findtext('internalNodes').split()
+            leaves = weak.findtext('leafValues').split()
+            if len(nodes) != 4:
+                raise SystemExit('only stump (single node) classifiers are supported')
+            stumps.append((int(nodes[2]), nodes[3], leaves[0], leaves[1]))
+        stages.append((stage.findtext('stageThreshold'), stumps))
+    return width, height, features, stages
+
+
+def license_comment(path):
+    with open(path, encoding='utf-8') as f:
+        head = f.read(8192)
+    match = re.search(r'<!--(.*?)-->', head, re.S)
+    return match.group(1).strip('\n') if match else ''
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('cascade_xml')
+    parser.add_argument('output_h')
+    args = parser.parse_args()
+
+    width, height, features, stages = read_cascade(args.cascade_xml)
+    stump_count = sum(len(stumps) for _, stumps in stages)
+
+    out = []
+    out.append('// Generated by camera/tools/haar_to_c.py from %s - do not edit.' % args.cascade_xml.replace('\\', '/').split('/')[-1])
+    out.append('// Included by face_detect.c only.')
+    out.append('/*')
+    out.extend(line.rstrip() for line in license_comment(args.cascade_xml).splitlines())
+    out.append('*/')
+    out.append('#pragma once')
+    out.append('')
+    out.append(f'#define FACE_CASCADE_WIDTH      {width}')
+    out.append(f'#define FACE_CASCADE_HEIGHT     {height}')
+    out.append(f'#define FACE_CASCADE_STAGES     {len(stages)}')
+    out.append(f'#define FACE_CASCADE_STUMPS     {stump_count}')
+    out.append(f'#define FACE_THRESHOLD_Q        {THRESHOLD_Q}')
+    out.append(f'#define FACE_LEAF_Q             {LEAF_Q}')
+    out.append('')
+
+    out.append('static const face_stage_t face_cascade_stages[FACE_CASCADE_STAGES] = {')
+    first = 0
+    for threshold, stumps in stages:
+        out.append(f'    {{ {first}, {len(stumps)}, {fixed(threshold, LEAF_Q)} }},')
+        first += len(stumps)
+    out.append('};')
+    out.append('')
+
+    out.append('static const face_stump_t face_cascade_stumps[FACE_CASCADE_STUMPS] = {')
+    for _, stumps in stages:
+        for feature_idx, threshold, left, right in stumps:
+            rects = features[feature_idx] + [(0, 0, 0, 0, 0)] * (3 - len(features[feature_idx]))
+            rect_src = ', '.join('{ %d, %d, %d, %d, %d }' % r for r in rects)
+            out.append(f'    {{ {fixed(threshold, THRESHOLD_Q)}, {fixed(left, LEAF_Q)}, {fixed(right, LEAF_Q)}, '
+                       f'{len(features[feature_idx])}, {{ {rect_src} }} }},')
+    out.append('};')
+
+    with open(args.output_h, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(out) + '\n')
+    print(f'{args.output_h}: {len(stages)} stages, {stump_count} stumps')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,225 @@
+"""Packed LFW training set: pre-resized uint8 images in memory-mapped shards, and a threaded loader.
+
+Packing runs once and applies train.py's filtering (classes with at least MIN_IMAGES_PER_CLASS
+images) and label encoding, then stores every image already resized to IMG_SIZE x IMG_SIZE,
+the output of train.py's first transform, so an epoch no longer opens or decodes a JPEG:
+
+    python packed_dataset.py pack images/lfw-deepfunneled images/lfw-packed
+    python packed_dataset.py bench images/lfw-packed
+
+Layout of the packed directory:
+
+    index.json          classes, label per image, source path per image, shard sizes
+    shard-00000.npy     (n, IMG_SIZE, IMG_SIZE, 3) uint8, opened with mmap_mode='r'
+
+PackedLoader shuffles, runs the remaining augmentations and assembles batches on a thread
+pool, keeping `prefetch` batches in flight ahead of the training loop. Threads rather than
+DataLoader worker processes: PIL releases the GIL in its image operations, nothing is pickled
+between processes, and train.py needs no __main__ guard on Windows.
+"""
+import argparse
+import json
+import os
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+from PIL import Image
+
+IMG_SIZE = 224
+MIN_IMAGES_PER_CLASS = 20
+SHARD_IMAGES = 1024         # About 150 MB per shard at 224 x 224
+
+
+def collect(data_dir, min_images_per_class=MIN_IMAGES_PER_CLASS):
+    """(image_paths, labels, class_counts) exactly as train.py collects them."""
+    image_paths, labels = [], []
+    class_counts = {}
+    for label in os.listdir(data_dir):
+        label_dir = os.path.join(data_dir, label)
+        if not os.path.isdir(label_dir):
+            continue
+        img_names = os.listdir(label_dir)
+        if len(img_names) < min_images_per_class:
+            continue
+        for img_name in img_names:
+            image_paths.append(os.path.join(label_dir, img_name))
+            labels.append(label)
+        class_counts[label] = len(img_names)
+    return image_paths, labels, class_counts
+
+
+def pack(data_dir, out_dir, min_images_per_class=MIN_IMAGES_PER_CLASS, size=IMG_SIZE, threads=None):
+    image_paths, labels, class_counts = collect(data_dir, min_images_per_class)
+    classes = sorted(class_counts)      # LabelEncoder's order
+    encode = {c: i for i, c in enumerate(classes)}
+    os.makedirs(out_dir, exist_ok=True)
+
+    def load(path):
+        # Same decode and resize as transforms.Resize((size, size)) on the PIL image
+        return np.asarray(Image.open(path).convert('RGB').resize((size, size), Image.BILINEAR))
+
+    shards = []
+    with ThreadPoolExecutor(threads or os.cpu_count()) as pool:
+        for start in range(0, len(image_paths), SHARD_IMAGES):
+            chunk = image_paths[start:start + SHARD_IMAGES]
+            name = f'shard-{len(shards):05d}.npy'
+            shard = np.lib.format.open_memmap(os.path.join(out_dir, name + '.tmp'), mode='w+',
+                                              dtype=np.uint8, shape=(len(chunk), size, size, 3))
+            for n, pixels in enumerate(pool.map(load, chunk)):
+                shard[n] = pixels
+            shard.flush()
+            del shard
+            os.replace(os.path.join(out_dir, name + '.tmp'), os.path.join(out_dir, name))
+            shards.append([name, len(chunk)])
+
+    index = {
+        'size': size,
+        'min_images_per_class': min_images_per_class,
+        'classes': classes,
+        'class_counts': class_counts,
+        'labels': [encode[label] for label in labels],
+        'paths': image_paths,
+        'shards': shards,
+    }
+    # Written last: a directory with an index is a complete pack
+    with open(os.path.join(out_dir, 'index.json'), 'w', encoding='utf-8') as f:
+        json.dump(index, f)
+    return index
+
+
+class PackedImages:
+    """Random access to a packed directory: image(i) is an HWC uint8 view, labels[i] its class."""
+
+    def __init__(self, packed_dir):
+        with open(os.path.join(packed_dir, 'index.json'), encoding='utf-8') as f:
+            self.index = json.load(f)
+        self.classes = self.index['classes']
+        self.class_counts = self.index['class_counts']
+        self.labels = np.asarray(self.index['labels'], dtype=np.int64)
+        self.shards = [np.load(os.path.join(packed_dir, name), mmap_mode='r') for name, _ in self.index['shards']]
+        self.starts = np.cumsum([0] + [count for _, count in self.index['shards']])
+
+    def __len__(self):
+        return len(self.labels)
+
+    def image(self, i):
+        shard = np.searchsorted(self.starts, i, side='right') - 1
+        return self.shards[shard][i - self.starts[shard]]
+
+
+class PackedLoader:
+    """Batches of (images, labels) for a subset of a PackedImages, built on a thread pool.
+
+    transform maps a PIL image to a CHW tensor, as torchvision transforms do; collate turns the
+    lists of transformed images and labels into the batch.
+    """
+
+    def __init__(self, images, indices, transform, batch_size, shuffle=False, threads=None,
+                 prefetch=4, collate=None, seed=None):
+        self.images = images
+        self.indices = np.asarray(indices)
+        self.transform = transform
+        self.batch_size = batch_size
+        self.shuffle = shuffle
+        self.prefetch = prefetch
+        self.collate = collate or torch_collate
+        self.rng = np.random.default_rng(seed)
+        self.pool = ThreadPoolExecutor(threads or os.cpu_count())
+        self.dataset = self.indices     # len(loader.dataset), as train.py uses with a DataLoader
+
+    def __len__(self):
+        return (len(self.indices) + self.batch_size - 1) // self.batch_size
+
+    def _batch(self, indices):
+        samples = [self.transform(Image.fromarray(np.asarray(self.images.image(i)))) for i in indices]
+        return self.collate(samples, self.images.labels[indices])
+
+    def __iter__(self):
+        order = self.rng.permutation(self.indices) if self.shuffle else self.indices
+        batches = [order[i:i + self.batch_size] for i in range(0, len(order), self.batch_size)]
+        # Each batch's images are transformed across the pool; later batches start early
+        pending = []
+        for batch in batches:
+            pending.append(self.pool.submit(self._batch, batch))
+            if len(pending) > self.prefetch:
+                yield pending.pop(0).result()
+        for future in pending:
+            yield future.result()
+
+
+def torch_collate(samples, labels):
+    import torch
+    return torch.stack(samples), torch.from_numpy(labels)
+
+
+# Benchmark ------------------------------------------------------------------
+
+def augmentations(size=IMG_SIZE, resize=True):
+    """train.py's train_transform; without the leading Resize for images that were packed."""
+    from torchvision import transforms
+    steps = [transforms.Resize((size, size))] if resize else []
+    return transforms.Compose(steps + [
+        transforms.RandomHorizontalFlip(),
+        transforms.RandomRotation(20),
+        transforms.ColorJitter(brightness=0.2, contrast=0.2, saturation=0.2, hue=0.1),
+        transforms.RandomResizedCrop(size, scale=(0.8, 1.0)),
+        transforms.ToTensor(),
+        transforms.Normalize([0.485, 0.456, 0.406], [0.229, 0.224, 0.225])
+    ])
+
+
+def bench(args):
+    """images/s of train.py's JPEG DataLoader against PackedLoader, same train augmentations."""
+    import torch
+    from torch.utils.data import DataLoader, Dataset
+
+    class JpegDataset(Dataset):     # train.py's FaceDataset
+        def __init__(self, paths, labels, transform):
+            self.paths, self.labels, self.transform = paths, labels, transform
+
+        def __len__(self):
+            return len(self.paths)
+
+        def __getitem__(self, idx):
+            return self.transform(Image.open(self.paths[idx]).convert('RGB')), torch.tensor(self.labels[idx])
+
+    packed_images = PackedImages(args.packed_dir)
+    count = min(args.images, len(packed_images))
+    jpeg = DataLoader(JpegDataset(packed_images.index['paths'][:count], packed_images.labels[:count],
+                                  augmentations(packed_images.index['size'])),
+                      batch_size=args.batch_size, shuffle=True)
+    packed = PackedLoader(packed_images, np.arange(count), augmentations(packed_images.index['size'], resize=False),
+                          args.batch_size, shuffle=True, threads=args.threads)
+    for name, loader in (('JPEG DataLoader', jpeg), (f'packed, {packed.pool._max_workers} threads', packed)):
+        start, seen = time.perf_counter(), 0
+        for imgs, _ in loader:
+            seen += len(imgs)
+        print(f'{name:>24}: {seen / (time.perf_counter() - start):.1f} images/s')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    sub = parser.add_subparsers(dest='command', required=True)
+    p = sub.add_parser('pack', help='pack a LFW-style directory')
+    p.add_argument('data_dir')
+    p.add_argument('out_dir')
+    p.add_argument('--min-images', type=int, default=MIN_IMAGES_PER_CLASS)
+    p.add_argument('--size', type=int, default=IMG_SIZE)
+    b = sub.add_parser('bench', help='images/s against the JPEG DataLoader')
+    b.add_argument('packed_dir')
+    b.add_argument('--images', type=int, default=2048)
+    b.add_argument('--batch-size', type=int, default=64)
+    b.add_argument('--threads', type=int, default=None)
+    args = parser.parse_args()
+    if args.command == 'pack':
+        start = time.perf_counter()
+        index = pack(args.data_dir, args.out_dir, args.min_images, args.size)
+        print(f'packed {len(index["labels"])} images of {len(index["classes"])} classes into '
+              f'{len(index["shards"])} shards in {time.perf_counter() - start:.1f} s')
+    else:
+        bench(args)
+
+
+if __name__ == '__main__':
+    main()
@@ -12,6 +12,8 @@ from torchvision import models, transforms
 from PIL import Image
 
 DATA_DIR = 'images/lfw-deepfunneled'
+PACKED_DIR = 'images/lfw-packed'    # Written by: python packed_dataset.py pack images/lfw-deepfunneled images/lfw-packed
+LOADER_THREADS = os.cpu_count()
 IMG_SIZE = 224
 BATCH_SIZE = 64
 EPOCHS = 10
@@ -35,22 +37,31 @@ class FaceDataset(Dataset):
 
 # Filter out classes with fewer than min_images_per_class
 min_images_per_class = 20
-image_paths, labels = [], []
-class_counts = {}
-for label in os.listdir(DATA_DIR):
-    label_dir = os.path.join(DATA_DIR, label)
-    if not os.path.isdir(label_dir):
-        continue
-    img_names = os.listdir(label_dir)
-    if len(img_names) < min_images_per_class:
-        continue
-    for img_name in img_names:
-        img_path = os.path.join(label_dir, img_name)
-        image_paths.append(img_path)
-        labels.append(label)
-    class_counts[label] = len(img_names)
-image_paths = np.array(image_paths)
-labels = np.array(labels)
+packed = None
+if os.path.exists(os.path.join(PACKED_DIR, 'index.json')):
+    from packed_dataset import PackedImages, PackedLoader
+    packed = PackedImages(PACKED_DIR)
+    print(f"Using packed dataset {PACKED_DIR} ({len(packed)} images)")
+    class_counts = packed.class_counts
+    image_paths = np.arange(len(packed))    # Split by index; same length, so the same split
+    labels = np.array(packed.classes)[packed.labels]
+else:
+    image_paths, labels = [], []
+    class_counts = {}
+    for label in os.listdir(DATA_DIR):
+        label_dir = os.path.join(DATA_DIR, label)
+        if not os.path.isdir(label_dir):
+            continue
+        img_names = os.listdir(label_dir)
+        if len(img_names) < min_images_per_class:
+            continue
+        for img_name in img_names:
+            img_path = os.path.join(label_dir, img_name)
+            image_paths.append(img_path)
+            labels.append(label)
+        class_counts[label] = len(img_names)
+    image_paths = np.array(image_paths)
+    labels = np.array(labels)
 
 # Encode string labels to integers
 
@@ -84,12 +95,21 @@ test_transform = transforms.Compose([
     transforms.Normalize([0.485, 0.456, 0.406], [0.229, 0.224, 0.225])
 ])
 
-train_dataset = FaceDataset(X_train, y_train, transform=train_transform)
-val_dataset = FaceDataset(X_val, y_val, transform=test_transform)
-test_dataset = FaceDataset(X_test, y_test, transform=test_transform)
-train_loader = DataLoader(train_dataset, batch_size=BATCH_SIZE, shuffle=True)
-val_loader = DataLoader(val_dataset, batch_size=BATCH_SIZE, shuffle=False)
-test_loader = DataLoader(test_dataset, batch_size=BATCH_SIZE, shuffle=False)
+if packed:
+    # Packed images are already IMG_SIZE x IMG_SIZE, so everything after the Resize
+    train_loader = PackedLoader(packed, X_train, transforms.Compose(train_transform.transforms[1:]),
+                                BATCH_SIZE, shuffle=True, threads=LOADER_THREADS)
+    val_loader = PackedLoader(packed, X_val, transforms.Compose(test_transform.transforms[1:]),
+                              BATCH_SIZE, threads=LOADER_THREADS)
+    test_loader = PackedLoader(packed, X_test, transforms.Compose(test_transform.transforms[1:]),
+                               BATCH_SIZE, threads=LOADER_THREADS)
+else:
+    train_dataset = FaceDataset(X_train, y_train, transform=train_transform)
+    val_dataset = FaceDataset(X_val, y_val, transform=test_transform)
+    test_dataset = FaceDataset(X_test, y_test, transform=test_transform)
+    train_loader = DataLoader(train_dataset, batch_size=BATCH_SIZE, shuffle=True)
+    val_loader = DataLoader(val_dataset, batch_size=BATCH_SIZE, shuffle=False)
+    test_loader = DataLoader(test_dataset, batch_size=BATCH_SIZE, shuffle=False)
 
 # Load pre-trained ResNet18 and fine-tune
 